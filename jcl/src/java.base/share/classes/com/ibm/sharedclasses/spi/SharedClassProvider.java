@@ -216,6 +216,38 @@ public interface SharedClassProvider {
 	 * 					The free space of the shared classes cache.
 	 */
 	public long getFreeSpace();
+
+	/**
+	 * <p>Returns the number of cache lookups made by this JVM which had the given result.</p>
+	 *
+	 * @param		operation int.
+	 *					The kind of lookup.
+	 * @param		result int.
+	 *					The result of the lookup.
+	 * @return 		long.
+	 * 					The number of lookups.
+	 */
+	public long getLookupCount(int operation, int result);
+
+	/**
+	 * <p>Returns the total time in microseconds spent in the cache lookups made by this JVM.</p>
+	 *
+	 * @param		operation int.
+	 *					The kind of lookup.
+	 * @return 		long.
+	 * 					The time in microseconds.
+	 */
+	public long getLookupMicros(int operation);
+
+	/**
+	 * <p>Returns the latency histogram of the cache lookups made by this JVM.</p>
+	 *
+	 * @param		operation int.
+	 *					The kind of lookup.
+	 * @return 		long[].
+	 * 					The number of lookups in each latency bucket.
+	 */
+	public long[] getLookupLatencyHistogram(int operation);
 	
 	/**
 	 * <p>Constructs a new instance of SharedClassPermission which is a sub-class of BasicPermission.</p>
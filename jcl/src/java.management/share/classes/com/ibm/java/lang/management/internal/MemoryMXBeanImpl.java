@@ -78,6 +78,10 @@ public class MemoryMXBeanImpl extends LazyDelegatingNotifier implements MemoryMX
 
 	private static final MemoryMXBeanImpl instance = new MemoryMXBeanImpl();
 
+	/* Number of lookup operations and results counted by com.ibm.oti.shared.SharedClassStatistics */
+	private static final int SHARED_CLASS_CACHE_LOOKUP_OPERATIONS = 4;
+	private static final int SHARED_CLASS_CACHE_LOOKUP_RESULTS = 7;
+
 	private static final Constructor<MemoryUsage> memUsageConstructor;
 
 	static {
@@ -131,6 +135,21 @@ public class MemoryMXBeanImpl extends LazyDelegatingNotifier implements MemoryMX
 			return 0;
 		}
 
+		@Override
+		public long getLookupCount(int operation, int result) {
+			return 0;
+		}
+
+		@Override
+		public long[] getLookupLatencyHistogram(int operation) {
+			return new long[0];
+		}
+
+		@Override
+		public long getLookupMicros(int operation) {
+			return 0;
+		}
+
 		@Override
 		public long getMaxAotBytes() {
 			return -1;
@@ -767,6 +786,55 @@ public class MemoryMXBeanImpl extends LazyDelegatingNotifier implements MemoryMX
 		/*[ENDIF]*/
 	}
 
+	/**
+	 * {@inheritDoc}
+	 */
+	public long getSharedClassCacheLookupCount(int operation, int result) {
+		checkSharedClassCacheLookupOperation(operation);
+		if ((result < 0) || (result >= SHARED_CLASS_CACHE_LOOKUP_RESULTS)) {
+			throw new IllegalArgumentException();
+		}
+		/*[IF Sidecar19-SE]*/
+		return sharedClassProviderHolder.get().getLookupCount(operation, result);
+		/*[ELSE]
+		return SharedClassStatistics.lookupCount(operation, result);
+		/*[ENDIF]*/
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	public long getSharedClassCacheLookupMicros(int operation) {
+		checkSharedClassCacheLookupOperation(operation);
+		/*[IF Sidecar19-SE]*/
+		return sharedClassProviderHolder.get().getLookupMicros(operation);
+		/*[ELSE]
+		return SharedClassStatistics.lookupMicros(operation);
+		/*[ENDIF]*/
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	public long[] getSharedClassCacheLookupLatencyHistogram(int operation) {
+		checkSharedClassCacheLookupOperation(operation);
+		/*[IF Sidecar19-SE]*/
+		return sharedClassProviderHolder.get().getLookupLatencyHistogram(operation);
+		/*[ELSE]
+		return SharedClassStatistics.lookupLatencyHistogram(operation);
+		/*[ENDIF]*/
+	}
+
+	/*
+	 * The operations and results are checked here rather than by SharedClassStatistics,
+	 * which is not called when the JVM is not connected to a shared class cache.
+	 */
+	private static void checkSharedClassCacheLookupOperation(int operation) {
+		if ((operation < 0) || (operation >= SHARED_CLASS_CACHE_LOOKUP_OPERATIONS)) {
+			throw new IllegalArgumentException();
+		}
+	}
+
 	/**
 	 * {@inheritDoc}
 	 */
@@ -239,6 +239,45 @@ public interface MemoryMXBean extends java.lang.management.MemoryMXBean {
      * @return the number of bytes free in the shared class cache.
      */
     public long getSharedClassCacheFreeSpace();
+
+    /**
+     * Returns the number of shared class cache lookups made by this JVM which had
+     * the given result. See com.ibm.oti.shared.SharedClassStatistics for the values
+     * of the operation and result parameters.
+     * 
+     * @param operation the kind of lookup, such as finding a class or an AOT method.
+     * @param result the result of the lookup, such as a hit or a stale entry.
+     * @return the number of lookups, or 0 if the JVM is not connected to a shared class cache.
+     * @throws IllegalArgumentException
+     *             if <code>operation</code> or <code>result</code> is not a valid value.
+     */
+    public long getSharedClassCacheLookupCount(int operation, int result);
+
+    /**
+     * Returns the total time in microseconds spent in the shared class cache lookups
+     * made by this JVM. See com.ibm.oti.shared.SharedClassStatistics for the values
+     * of the operation parameter.
+     * 
+     * @param operation the kind of lookup, such as finding a class or an AOT method.
+     * @return the time in microseconds, or 0 if the JVM is not connected to a shared class cache.
+     * @throws IllegalArgumentException
+     *             if <code>operation</code> is not a valid value.
+     */
+    public long getSharedClassCacheLookupMicros(int operation);
+
+    /**
+     * Returns the latency histogram of the shared class cache lookups made by this JVM.
+     * Element 0 counts the lookups which took less than 1 microsecond, element i counts
+     * those which took at least 4^(i-1) and less than 4^i microseconds, the last element
+     * counts the rest.
+     * 
+     * @param operation the kind of lookup, such as finding a class or an AOT method.
+     * @return the number of lookups in each latency bucket, or an empty array if the JVM
+     * is not connected to a shared class cache.
+     * @throws IllegalArgumentException
+     *             if <code>operation</code> is not a valid value.
+     */
+    public long[] getSharedClassCacheLookupLatencyHistogram(int operation);
 	
 	/**
 	 * Returns the current GC mode as a human-readable string.  
@@ -29,6 +29,53 @@ package com.ibm.oti.shared;
  */
 public class SharedClassStatistics {
 
+	/** Lookups of ROMClasses made by the class loaders */
+	public static final int LOOKUP_FIND_ROMCLASS = 0;
+	/** Lookups of AOT compiled methods */
+	public static final int LOOKUP_FIND_COMPILED_METHOD = 1;
+	/** Stores of AOT compiled methods */
+	public static final int LOOKUP_STORE_COMPILED_METHOD = 2;
+	/** Lookups of data attached to methods, such as JIT profile data and hints */
+	public static final int LOOKUP_FIND_ATTACHED_DATA = 3;
+
+	/** The data was found, or was stored */
+	public static final int RESULT_HIT = 0;
+	/** The data is not in the cache */
+	public static final int RESULT_NOT_FOUND = 1;
+	/** The data is in the cache, but the classpath entry it was stored from has changed */
+	public static final int RESULT_STALE = 2;
+	/** The data is in the cache, but it failed validation or is corrupt */
+	public static final int RESULT_INVALIDATED = 3;
+	/** The data was not stored because it is already in the cache */
+	public static final int RESULT_EXISTS = 4;
+	/** The data was not stored because the cache is full */
+	public static final int RESULT_FULL = 5;
+	/** The lookup failed */
+	public static final int RESULT_ERROR = 6;
+
+	/** ROMClass lookups made by the bootstrap class loader */
+	public static final int LOADER_BOOTSTRAP = 0;
+	/** ROMClass lookups made by class loaders with a classpath */
+	public static final int LOADER_CLASSPATH = 1;
+	/** ROMClass lookups made by class loaders using a URL helper */
+	public static final int LOADER_URL = 2;
+	/** ROMClass lookups made by class loaders using a token helper */
+	public static final int LOADER_TOKEN = 3;
+
+	private static final int LOOKUP_OPERATIONS = 4;
+	private static final int LOOKUP_RESULTS = 7;
+	private static final int LOOKUP_LOADERS = 4;
+	private static final int LATENCY_BUCKETS = 8;
+	private static final int CLASSPATH_INDICES = 16;
+
+	/* Offsets of the counters in the array returned by lookupStatsImpl() */
+	private static final int RESULTS_OFFSET = 0;
+	private static final int LATENCY_OFFSET = RESULTS_OFFSET + (LOOKUP_OPERATIONS * LOOKUP_RESULTS);
+	private static final int MICROS_OFFSET = LATENCY_OFFSET + (LOOKUP_OPERATIONS * LATENCY_BUCKETS);
+	private static final int LOADER_RESULTS_OFFSET = MICROS_OFFSET + LOOKUP_OPERATIONS;
+	private static final int CLASSPATH_INDEX_OFFSET = LOADER_RESULTS_OFFSET + (LOOKUP_LOADERS * LOOKUP_RESULTS);
+	private static final int LOOKUP_STATS_LENGTH = CLASSPATH_INDEX_OFFSET + CLASSPATH_INDICES;
+
 	/**
 	 * Returns the size of the shared cache that the JVM is currently connected to
 	 * <p>
@@ -97,6 +144,97 @@ public class SharedClassStatistics {
     	return maxJitDataBytesImpl();
     }
 
+
+	/**
+	 * Returns the number of shared cache lookups made by this JVM which had the given result.
+	 * <p>
+	 * @param operation One of the LOOKUP_ constants
+	 * @param result One of the RESULT_ constants
+	 * @return the number of lookups, or 0 if the JVM is not connected to a shared cache
+	 * @throws IllegalArgumentException if operation or result is out of range
+	 */
+	public static long lookupCount(int operation, int result) {
+		checkOperation(operation);
+		checkResult(result);
+		return lookupStats()[RESULTS_OFFSET + (operation * LOOKUP_RESULTS) + result];
+	}
+
+	/**
+	 * Returns the total time spent in the shared cache lookups made by this JVM.
+	 * <p>
+	 * @param operation One of the LOOKUP_ constants
+	 * @return the time in microseconds, or 0 if the JVM is not connected to a shared cache
+	 * @throws IllegalArgumentException if operation is out of range
+	 */
+	public static long lookupMicros(int operation) {
+		checkOperation(operation);
+		return lookupStats()[MICROS_OFFSET + operation];
+	}
+
+	/**
+	 * Returns the latency histogram of the shared cache lookups made by this JVM.
+	 * Element 0 counts the lookups which took less than 1 microsecond, element i counts
+	 * those which took at least 4^(i-1) and less than 4^i microseconds, the last element counts the rest.
+	 * <p>
+	 * @param operation One of the LOOKUP_ constants
+	 * @return the number of lookups in each latency bucket
+	 * @throws IllegalArgumentException if operation is out of range
+	 */
+	public static long[] lookupLatencyHistogram(int operation) {
+		checkOperation(operation);
+		long[] histogram = new long[LATENCY_BUCKETS];
+		System.arraycopy(lookupStats(), LATENCY_OFFSET + (operation * LATENCY_BUCKETS), histogram, 0, LATENCY_BUCKETS);
+		return histogram;
+	}
+
+	/**
+	 * Returns the number of ROMClass lookups made by this JVM for the given kind of class loader
+	 * which had the given result.
+	 * <p>
+	 * @param loader One of the LOADER_ constants
+	 * @param result One of the RESULT_ constants
+	 * @return the number of lookups, or 0 if the JVM is not connected to a shared cache
+	 * @throws IllegalArgumentException if loader or result is out of range
+	 */
+	public static long romClassLookupCount(int loader, int result) {
+		if ((loader < 0) || (loader >= LOOKUP_LOADERS)) {
+			throw new IllegalArgumentException();
+		}
+		checkResult(result);
+		return lookupStats()[LOADER_RESULTS_OFFSET + (loader * LOOKUP_RESULTS) + result];
+	}
+
+	/**
+	 * Returns the number of ROMClasses found at each index of the classpath of the class loaders.
+	 * The last element also counts the classes found at any later index.
+	 * <p>
+	 * @return the number of ROMClasses found at each classpath index
+	 */
+	public static long[] romClassHitsByClasspathIndex() {
+		long[] hits = new long[CLASSPATH_INDICES];
+		System.arraycopy(lookupStats(), CLASSPATH_INDEX_OFFSET, hits, 0, CLASSPATH_INDICES);
+		return hits;
+	}
+
+	private static void checkOperation(int operation) {
+		if ((operation < 0) || (operation >= LOOKUP_OPERATIONS)) {
+			throw new IllegalArgumentException();
+		}
+	}
+
+	private static void checkResult(int result) {
+		if ((result < 0) || (result >= LOOKUP_RESULTS)) {
+			throw new IllegalArgumentException();
+		}
+	}
+
+	private static long[] lookupStats() {
+		long[] stats = lookupStatsImpl();
+		if ((null == stats) || (LOOKUP_STATS_LENGTH > stats.length)) {
+			stats = new long[LOOKUP_STATS_LENGTH];
+		}
+		return stats;
+	}
 	
 	private static native long maxSizeBytesImpl();
 
@@ -111,4 +249,6 @@ public class SharedClassStatistics {
 	private static native long minJitDataBytesImpl();
 	
 	private static native long maxJitDataBytesImpl();
+
+	private static native long[] lookupStatsImpl();
 }
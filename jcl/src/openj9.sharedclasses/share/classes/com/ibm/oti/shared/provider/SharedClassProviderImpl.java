@@ -197,6 +197,30 @@ public class SharedClassProviderImpl implements SharedClassProvider {
 		}
 	}
 	@Override
+	public long getLookupCount(int operation, int result) {
+		if (isSharedClassEnabled()) {
+			return SharedClassStatistics.lookupCount(operation, result);
+		} else {
+			return 0;
+		}
+	}
+	@Override
+	public long getLookupMicros(int operation) {
+		if (isSharedClassEnabled()) {
+			return SharedClassStatistics.lookupMicros(operation);
+		} else {
+			return 0;
+		}
+	}
+	@Override
+	public long[] getLookupLatencyHistogram(int operation) {
+		if (isSharedClassEnabled()) {
+			return SharedClassStatistics.lookupLatencyHistogram(operation);
+		} else {
+			return new long[0];
+		}
+	}
+	@Override
 	public BasicPermission createPermission(String classLoaderClassName, String actions) {
 		if (!isSharedClassEnabled()) {
 			return null;
@@ -142,6 +142,9 @@ mergeClasses(J9BytecodeVerificationData *verifyData, U_8* firstClass, UDATA firs
 	J9Class *sourceRAM, *targetRAM;
 	UDATA sourceDepth, targetDepth;
 
+	/* The merged class depends on the whole hierarchy of both classes, which a verification record does not replay */
+	discardVerificationRecord(verifyData);
+
 	/* Go get the ROM class for the source and target.  Check if it returns null immediately to prevent
 	 * having to load the second class in an error case */
 	sourceRAM = j9rtv_verifierGetRAMClass( verifyData, verifyData->classLoader, firstClass, firstLength, reasonCode);
@@ -2398,12 +2401,22 @@ j9bcv_verifyBytecodes (J9PortLibrary * portLib, J9Class * clazz, J9ROMClass * ro
 	
 	verifyData->romClassInSharedClasses = j9shr_Query_IsAddressInCache(verifyData->javaVM, romClass, romClass->romSize);
 
+	/* The record of an enclosing verification was saved by j9rtv_verifierGetRAMClass */
+	verifyData->verificationRecord = NULL;
+	verifyData->verificationRecordSize = 0;
+	verifyData->verificationRecordLength = 0;
+	verifyData->verificationRecordState = J9_VERIFICATION_RECORD_INACTIVE;
+
 	/* List is used for the whole class */
 	initializeClassNameList(verifyData);
 
 
 	romMethod = (J9ROMMethod *) J9ROMCLASS_ROMMETHODS(romClass);
 
+	if (replayVerificationRecord(verifyData, clazz, romClass)) {
+		goto _done;
+	}
+
 	if (verboseVerification) {
 		ALWAYS_TRIGGER_J9HOOK_VM_CLASS_VERIFICATION_START(verifyData->javaVM->hookInterface, verifyData, newFormat);
 	}
@@ -2607,6 +2620,11 @@ _fallBack:
 	}
 
 _done:
+	if (BCV_SUCCESS == result) {
+		storeVerificationRecord(verifyData, romClass);
+	}
+	releaseVerificationRecord(verifyData);
+
 	verifyData->vmStruct->omrVMThread->vmState = oldState;
 	if (result == BCV_ERR_INSUFFICIENT_MEMORY) {
 		Trc_BCV_j9bcv_verifyBytecodes_OutOfMemory(verifyData->vmStruct, 
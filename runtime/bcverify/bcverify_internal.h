@@ -40,6 +40,11 @@
 extern "C" {
 #endif
 
+/* J9BytecodeVerificationData->verificationRecordState */
+#define J9_VERIFICATION_RECORD_INACTIVE 0
+#define J9_VERIFICATION_RECORD_ACTIVE 1
+#define J9_VERIFICATION_RECORD_DISCARDED 2
+
 /**
  * Store verification failure info to the J9BytecodeVerificationData
  * structure for outputting detailed error message.
@@ -53,6 +58,55 @@ extern "C" {
 void
 storeVerifyErrorData (J9BytecodeVerificationData * verifyData, I_16 errorDetailCode, U_32 errorCurrentFramePosition, UDATA errorTargetType, UDATA errorTempData, IDATA currentPC);
 
+/* ---------------- verifycache.c ---------------- */
+
+/**
+ * Replay the verification record attached to a shared ROMClass. If there is no record or
+ * one of its constraints no longer holds, start building a new record for the verification.
+ * @param verifyData - pointer to J9BytecodeVerificationData
+ * @param clazz - the J9Class being verified, or NULL
+ * @param romClass - the ROMClass being verified
+ * @return TRUE if the class is verified by the record, FALSE if its bytecodes must be verified
+ */
+BOOLEAN
+replayVerificationRecord(J9BytecodeVerificationData *verifyData, J9Class *clazz, J9ROMClass *romClass);
+
+/**
+ * Add the result of a check which depends on other classes to the record being built.
+ * @param verifyData - pointer to J9BytecodeVerificationData
+ * @param sourceName - name of the class being assigned
+ * @param sourceLength - length of sourceName
+ * @param targetName - name of the class assigned to
+ * @param targetLength - length of targetName
+ * @param arrayInterfaceOnly - TRUE if the source is an array
+ * @param result - the result of the check
+ * @param reasonCode - the reason code set by the check
+ */
+void
+addVerificationConstraint(J9BytecodeVerificationData *verifyData, U_8 *sourceName, UDATA sourceLength, U_8 *targetName, UDATA targetLength, UDATA arrayInterfaceOnly, IDATA result, IDATA reasonCode);
+
+/**
+ * Stop building the record, the verification depends on a check which cannot be replayed.
+ * @param verifyData - pointer to J9BytecodeVerificationData
+ */
+void
+discardVerificationRecord(J9BytecodeVerificationData *verifyData);
+
+/**
+ * Attach the record built by a successful verification to the ROMClass in the shared class cache.
+ * @param verifyData - pointer to J9BytecodeVerificationData
+ * @param romClass - the ROMClass which was verified
+ */
+void
+storeVerificationRecord(J9BytecodeVerificationData *verifyData, J9ROMClass *romClass);
+
+/**
+ * Free the record and stop building it.
+ * @param verifyData - pointer to J9BytecodeVerificationData
+ */
+void
+releaseVerificationRecord(J9BytecodeVerificationData *verifyData);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,339 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "bcverify.h"
+#include "bcverify_internal.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "shcflags.h"
+#include "ut_j9bcverify.h"
+
+/*
+ * A verification record is attached to a ROMClass in the shared class cache
+ * (J9SHR_ATTACHED_DATA_TYPE_VERIFICATION) after the class has been verified successfully.
+ * It holds the complete verification flags and the runtime options the class was verified with, and
+ * every check of the verification which depended on other classes: a J9VerificationRecordHeader followed
+ * by constraintCount J9VerificationConstraint, each one followed by the source and target class names
+ * padded to a U_16.
+ * A later verification of the same ROMClass only has to find that each constraint gives the same
+ * result in the current class loader; the checks which depend only on the ROMClass are not repeated.
+ */
+typedef struct J9VerificationRecordHeader {
+	U_32 verificationFlags;
+	U_32 runtimeFlags;
+	U_32 constraintCount;
+} J9VerificationRecordHeader;
+
+typedef struct J9VerificationConstraint {
+	U_16 kind;
+	U_16 sourceLength;
+	U_16 targetLength;
+} J9VerificationConstraint;
+
+#define VERIFICATION_CONSTRAINT_ARRAY_INTERFACE_ONLY 0x1
+#define VERIFICATION_CONSTRAINT_COMPATIBLE 0x2
+
+/* Runtime options, other than the verification flags, which change the outcome of verifying the same bytecodes */
+#define VERIFICATION_RECORD_CLASS_RELATIONSHIP_VERIFIER 0x1
+
+#define VERIFICATION_RECORD_DEFAULT_SIZE 512
+#define VERIFICATION_RECORD_MAX_SIZE (64 * 1024)
+
+#define VERIFICATION_CONSTRAINT_LENGTH(sourceLength, targetLength) \
+	(sizeof(J9VerificationConstraint) + ((((sourceLength) + (targetLength)) + 1) & ~(UDATA)1))
+
+static U_32 getVerificationRecordRuntimeFlags (J9BytecodeVerificationData *verifyData);
+static BOOLEAN isVerificationRecordUsable (J9BytecodeVerificationData *verifyData, J9Class *clazz, J9ROMClass *romClass);
+static BOOLEAN replayConstraints (J9BytecodeVerificationData *verifyData, J9ROMClass *romClass, U_8 *record, UDATA recordLength);
+
+
+static U_32
+getVerificationRecordRuntimeFlags(J9BytecodeVerificationData *verifyData)
+{
+	U_32 flags = 0;
+
+	if (J9_ARE_ANY_BITS_SET(verifyData->javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_ENABLE_CLASS_RELATIONSHIP_VERIFIER)) {
+		flags |= VERIFICATION_RECORD_CLASS_RELATIONSHIP_VERIFIER;
+	}
+	return flags;
+}
+
+
+/*
+ * A record is only used for an unmodified shared ROMClass which is verified completely (a J9Class is
+ * provided) and without the checks whose results are not recorded (protected access checks) or whose
+ * side effects would be lost (verbose verification output). The record does not hold the name of the
+ * attribute excluded by -Xverify:excludeattribute=, so it is not used with that option either.
+ */
+static BOOLEAN
+isVerificationRecordUsable(J9BytecodeVerificationData *verifyData, J9Class *clazz, J9ROMClass *romClass)
+{
+	J9JavaVM *vm = verifyData->javaVM;
+
+	return (NULL != clazz)
+		&& verifyData->romClassInSharedClasses
+		&& (NULL != vm->sharedClassConfig)
+		&& (NULL != vm->sharedClassConfig->findAttachedData)
+		&& (0 == verifyData->redefinedClassesCount)
+		&& !J9ROMCLASS_HAS_MODIFIED_BYTECODES(romClass)
+		&& J9_ARE_NO_BITS_SET(vm->runtimeFlags, J9RuntimeFlagXfuture)
+		&& J9_ARE_NO_BITS_SET(verifyData->verificationFlags, J9_VERIFY_DO_PROTECTED_ACCESS_CHECK | J9_VERIFY_VERBOSE_VERIFICATION | J9_VERIFY_EXCLUDE_ATTRIBUTE);
+}
+
+
+/*
+ * returns TRUE if every constraint in the record gives the result it gave when the record was built
+ * returns FALSE otherwise
+ */
+static BOOLEAN
+replayConstraints(J9BytecodeVerificationData *verifyData, J9ROMClass *romClass, U_8 *record, UDATA recordLength)
+{
+	J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+	J9VerificationRecordHeader *header = (J9VerificationRecordHeader *)record;
+	U_8 *cursor = record + sizeof(J9VerificationRecordHeader);
+	U_8 *end = record + recordLength;
+	U_32 i = 0;
+
+	if (recordLength < sizeof(J9VerificationRecordHeader)) {
+		Trc_BCV_replayVerificationRecord_Invalid(verifyData->vmStruct, (UDATA) J9UTF8_LENGTH(className), J9UTF8_DATA(className), (U_32)recordLength);
+		return FALSE;
+	}
+
+	/* A record built with other verification options says nothing about the outcome with the current ones */
+	if ((header->verificationFlags != (U_32)verifyData->verificationFlags)
+		|| (header->runtimeFlags != getVerificationRecordRuntimeFlags(verifyData))
+	) {
+		Trc_BCV_replayVerificationRecord_FlagsDiffer(verifyData->vmStruct, (UDATA) J9UTF8_LENGTH(className), J9UTF8_DATA(className),
+				header->verificationFlags, header->runtimeFlags, (U_32)verifyData->verificationFlags, getVerificationRecordRuntimeFlags(verifyData));
+		return FALSE;
+	}
+
+	for (i = 0; i < header->constraintCount; i++) {
+		J9VerificationConstraint *constraint = (J9VerificationConstraint *)cursor;
+		U_8 *sourceName = NULL;
+		U_8 *targetName = NULL;
+		IDATA reasonCode = 0;
+		IDATA rc = 0;
+
+		if (((UDATA)(end - cursor) < sizeof(J9VerificationConstraint))
+			|| ((UDATA)(end - cursor) < VERIFICATION_CONSTRAINT_LENGTH(constraint->sourceLength, constraint->targetLength))
+		) {
+			Trc_BCV_replayVerificationRecord_Invalid(verifyData->vmStruct, (UDATA) J9UTF8_LENGTH(className), J9UTF8_DATA(className), (U_32)recordLength);
+			return FALSE;
+		}
+		sourceName = cursor + sizeof(J9VerificationConstraint);
+		targetName = sourceName + constraint->sourceLength;
+
+		rc = isClassNameCompatible(verifyData, sourceName, constraint->sourceLength, targetName, constraint->targetLength,
+				J9_ARE_ANY_BITS_SET(constraint->kind, VERIFICATION_CONSTRAINT_ARRAY_INTERFACE_ONLY), &reasonCode);
+		if ((((IDATA) FALSE) != rc) != J9_ARE_ANY_BITS_SET(constraint->kind, VERIFICATION_CONSTRAINT_COMPATIBLE)) {
+			Trc_BCV_replayVerificationRecord_Mismatch(verifyData->vmStruct, (UDATA) J9UTF8_LENGTH(className), J9UTF8_DATA(className), i);
+			return FALSE;
+		}
+		cursor += VERIFICATION_CONSTRAINT_LENGTH(constraint->sourceLength, constraint->targetLength);
+	}
+
+	Trc_BCV_replayVerificationRecord_Replayed(verifyData->vmStruct, (UDATA) J9UTF8_LENGTH(className), J9UTF8_DATA(className), header->constraintCount);
+	return TRUE;
+}
+
+
+BOOLEAN
+replayVerificationRecord(J9BytecodeVerificationData *verifyData, J9Class *clazz, J9ROMClass *romClass)
+{
+	J9VMThread *currentThread = verifyData->vmStruct;
+	J9SharedClassConfig *sharedClassConfig = verifyData->javaVM->sharedClassConfig;
+	J9SharedDataDescriptor descriptor;
+	IDATA corruptOffset = -1;
+	const U_8 *found = NULL;
+	BOOLEAN replayed = FALSE;
+
+	if (!isVerificationRecordUsable(verifyData, clazz, romClass)) {
+		return FALSE;
+	}
+
+	descriptor.address = NULL;
+	descriptor.length = 0;
+	descriptor.type = J9SHR_ATTACHED_DATA_TYPE_VERIFICATION;
+	descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+	found = sharedClassConfig->findAttachedData(currentThread, romClass, &descriptor, &corruptOffset);
+	if ((J9SHR_RESOURCE_MAX_ERROR_VALUE < (UDATA)found) && (-1 == corruptOffset)) {
+		replayed = replayConstraints(verifyData, romClass, descriptor.address, descriptor.length);
+	}
+	sharedClassConfig->freeAttachedDataDescriptor(currentThread, &descriptor);
+
+	if (!replayed && (NULL == currentThread->currentException)) {
+		/* Build a new record while the class is verified */
+		verifyData->verificationRecordLength = sizeof(J9VerificationRecordHeader);
+		verifyData->verificationRecordState = J9_VERIFICATION_RECORD_ACTIVE;
+	}
+	return replayed;
+}
+
+
+void
+addVerificationConstraint(J9BytecodeVerificationData *verifyData, U_8 *sourceName, UDATA sourceLength, U_8 *targetName, UDATA targetLength, UDATA arrayInterfaceOnly, IDATA result, IDATA reasonCode)
+{
+	UDATA constraintLength = VERIFICATION_CONSTRAINT_LENGTH(sourceLength, targetLength);
+	UDATA newLength = verifyData->verificationRecordLength + constraintLength;
+	U_16 kind = 0;
+	U_8 *cursor = NULL;
+	U_8 *end = NULL;
+	J9VerificationConstraint *constraint = NULL;
+
+	PORT_ACCESS_FROM_PORT(verifyData->portLib);
+
+	/* A check which failed to complete does not have a result to replay */
+	if ((BCV_ERR_INSUFFICIENT_MEMORY == reasonCode)
+		|| (NULL != verifyData->vmStruct->currentException)
+		|| (newLength > VERIFICATION_RECORD_MAX_SIZE)
+	) {
+		discardVerificationRecord(verifyData);
+		return;
+	}
+
+	if (arrayInterfaceOnly) {
+		kind |= VERIFICATION_CONSTRAINT_ARRAY_INTERFACE_ONLY;
+	}
+	if ((IDATA) FALSE != result) {
+		kind |= VERIFICATION_CONSTRAINT_COMPATIBLE;
+	}
+
+	/* The same check is usually made many times while a class is verified, record it once */
+	if (NULL != verifyData->verificationRecord) {
+		cursor = verifyData->verificationRecord + sizeof(J9VerificationRecordHeader);
+		end = verifyData->verificationRecord + verifyData->verificationRecordLength;
+		while (cursor < end) {
+			constraint = (J9VerificationConstraint *)cursor;
+			if ((constraint->kind == kind)
+				&& (constraint->sourceLength == sourceLength)
+				&& (constraint->targetLength == targetLength)
+				&& (0 == memcmp(cursor + sizeof(J9VerificationConstraint), sourceName, sourceLength))
+				&& (0 == memcmp(cursor + sizeof(J9VerificationConstraint) + sourceLength, targetName, targetLength))
+			) {
+				return;
+			}
+			cursor += VERIFICATION_CONSTRAINT_LENGTH(constraint->sourceLength, constraint->targetLength);
+		}
+	}
+
+	if (newLength > verifyData->verificationRecordSize) {
+		UDATA newSize = OMR_MAX(newLength, 2 * verifyData->verificationRecordSize);
+		U_8 *newRecord = NULL;
+
+		newSize = OMR_MAX(newSize, VERIFICATION_RECORD_DEFAULT_SIZE);
+		newRecord = j9mem_reallocate_memory(verifyData->verificationRecord, newSize, J9MEM_CATEGORY_CLASSES);
+		if (NULL == newRecord) {
+			discardVerificationRecord(verifyData);
+			return;
+		}
+		verifyData->verificationRecord = newRecord;
+		verifyData->verificationRecordSize = newSize;
+	}
+
+	cursor = verifyData->verificationRecord + verifyData->verificationRecordLength;
+	constraint = (J9VerificationConstraint *)cursor;
+	constraint->kind = kind;
+	constraint->sourceLength = (U_16)sourceLength;
+	constraint->targetLength = (U_16)targetLength;
+	cursor += sizeof(J9VerificationConstraint);
+	memcpy(cursor, sourceName, sourceLength);
+	memcpy(cursor + sourceLength, targetName, targetLength);
+	verifyData->verificationRecordLength = newLength;
+}
+
+
+void
+discardVerificationRecord(J9BytecodeVerificationData *verifyData)
+{
+	if (J9_VERIFICATION_RECORD_ACTIVE == verifyData->verificationRecordState) {
+		J9UTF8 *className = J9ROMCLASS_CLASSNAME(verifyData->romClass);
+
+		Trc_BCV_discardVerificationRecord_Discarded(verifyData->vmStruct, (UDATA) J9UTF8_LENGTH(className), J9UTF8_DATA(className));
+		verifyData->verificationRecordState = J9_VERIFICATION_RECORD_DISCARDED;
+	}
+}
+
+
+void
+storeVerificationRecord(J9BytecodeVerificationData *verifyData, J9ROMClass *romClass)
+{
+	J9SharedClassConfig *sharedClassConfig = verifyData->javaVM->sharedClassConfig;
+	J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+	J9VerificationRecordHeader header;
+	J9SharedDataDescriptor descriptor;
+	U_8 *cursor = NULL;
+	U_8 *end = NULL;
+	UDATA rc = 0;
+
+	PORT_ACCESS_FROM_PORT(verifyData->portLib);
+
+	if (J9_VERIFICATION_RECORD_ACTIVE != verifyData->verificationRecordState) {
+		return;
+	}
+
+	/* A class which depends on no other class still needs a record to skip verification */
+	if (NULL == verifyData->verificationRecord) {
+		verifyData->verificationRecord = j9mem_allocate_memory(VERIFICATION_RECORD_DEFAULT_SIZE, J9MEM_CATEGORY_CLASSES);
+		if (NULL == verifyData->verificationRecord) {
+			return;
+		}
+		verifyData->verificationRecordSize = VERIFICATION_RECORD_DEFAULT_SIZE;
+	}
+
+	header.verificationFlags = (U_32)verifyData->verificationFlags;
+	header.runtimeFlags = getVerificationRecordRuntimeFlags(verifyData);
+	header.constraintCount = 0;
+	cursor = verifyData->verificationRecord + sizeof(J9VerificationRecordHeader);
+	end = verifyData->verificationRecord + verifyData->verificationRecordLength;
+	while (cursor < end) {
+		J9VerificationConstraint *constraint = (J9VerificationConstraint *)cursor;
+
+		header.constraintCount += 1;
+		cursor += VERIFICATION_CONSTRAINT_LENGTH(constraint->sourceLength, constraint->targetLength);
+	}
+	memcpy(verifyData->verificationRecord, &header, sizeof(J9VerificationRecordHeader));
+
+	descriptor.address = verifyData->verificationRecord;
+	descriptor.length = verifyData->verificationRecordLength;
+	descriptor.type = J9SHR_ATTACHED_DATA_TYPE_VERIFICATION;
+	descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+	rc = sharedClassConfig->storeAttachedData(verifyData->vmStruct, romClass, &descriptor, TRUE);
+
+	Trc_BCV_storeVerificationRecord_Stored(verifyData->vmStruct, (UDATA) J9UTF8_LENGTH(className), J9UTF8_DATA(className),
+			header.constraintCount, (U_32)descriptor.length, (U_32)rc);
+}
+
+
+void
+releaseVerificationRecord(J9BytecodeVerificationData *verifyData)
+{
+	PORT_ACCESS_FROM_PORT(verifyData->portLib);
+
+	j9mem_free_memory(verifyData->verificationRecord);
+	verifyData->verificationRecord = NULL;
+	verifyData->verificationRecordSize = 0;
+	verifyData->verificationRecordLength = 0;
+	verifyData->verificationRecordState = J9_VERIFICATION_RECORD_INACTIVE;
+}
@@ -451,13 +451,9 @@ isClassCompatible(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDA
 { 
 	UDATA sourceIndex, targetIndex;
 	UDATA sourceArity, targetArity;
-	IDATA rc;
 	U_8 *sourceName, *targetName;
 	UDATA sourceLength, targetLength;
 
-	/* Record class relationship if -XX:+ClassRelationshipVerifier is used */
-	BOOLEAN classRelationshipVerifierEnabled = J9_ARE_ANY_BITS_SET(verifyData->vmStruct->javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_ENABLE_CLASS_RELATIONSHIP_VERIFIER);
-
 	*reasonCode = 0;
 
 	/* if they are identical, then we're done */
@@ -536,14 +532,8 @@ isClassCompatible(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDA
 		if (((CLONEABLE_CLASS_NAME_LENGTH == targetLength) && ((0 == strncmp((const char*)targetName, CLONEABLE_CLASS_NAME, CLONEABLE_CLASS_NAME_LENGTH))))
 		|| ((SERIALIZEABLE_CLASS_NAME_LENGTH == targetLength) && (0 == strncmp((const char*)targetName, SERIALIZEABLE_CLASS_NAME, SERIALIZEABLE_CLASS_NAME_LENGTH)))
 		) {
-			rc = isInterfaceClass(verifyData, targetName, targetLength, reasonCode);
-
-			if ((classRelationshipVerifierEnabled) && (BCV_ERR_CLASS_RELATIONSHIP_RECORD_REQUIRED == *reasonCode)) {
-				getNameAndLengthFromClassNameList (verifyData, sourceIndex, &sourceName, &sourceLength);
-				rc = j9bcv_recordClassRelationship (verifyData->vmStruct, verifyData->classLoader, sourceName, sourceLength, targetName, targetLength, reasonCode);
-			}
-
-			return rc;
+			getNameAndLengthFromClassNameList (verifyData, sourceIndex, &sourceName, &sourceLength);
+			return isClassNameCompatible(verifyData, sourceName, sourceLength, targetName, targetLength, TRUE, reasonCode);
 		}
 
 		return (IDATA) FALSE;
@@ -560,30 +550,52 @@ isClassCompatible(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDA
 	}
 
 	getNameAndLengthFromClassNameList (verifyData, targetIndex, &targetName, &targetLength);
+	getNameAndLengthFromClassNameList (verifyData, sourceIndex, &sourceName, &sourceLength);
+
+	return isClassNameCompatible(verifyData, sourceName, sourceLength, targetName, targetLength, FALSE, reasonCode);
+}
+
+
+/*
+ * Answer whether the class named sourceName can be assigned to the class named targetName
+ * in the class loader being verified. This is the part of isClassCompatible() which depends
+ * on other classes, so it is also used to replay the constraints of a cached verification record.
+ * If arrayInterfaceOnly is set, the source is an array and the target must be an interface.
+ *
+ * returns TRUE if class are compatible
+ * returns FALSE if class are NOT compatible
+ *  		isInterfaceClass() or isRAMClassCompatible() sets reasonCode to BCV_ERR_INSUFFICIENT_MEMORY in OOM
+ */
+IDATA
+isClassNameCompatible(J9BytecodeVerificationData *verifyData, U_8 *sourceName, UDATA sourceLength, U_8 *targetName, UDATA targetLength, UDATA arrayInterfaceOnly, IDATA *reasonCode)
+{
+	IDATA rc;
+
+	/* Record class relationship if -XX:+ClassRelationshipVerifier is used */
+	BOOLEAN classRelationshipVerifierEnabled = J9_ARE_ANY_BITS_SET(verifyData->vmStruct->javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_ENABLE_CLASS_RELATIONSHIP_VERIFIER);
 
 	/* if the target is an interface, be permissive */
 	rc = isInterfaceClass(verifyData, targetName, targetLength, reasonCode);
 
-	getNameAndLengthFromClassNameList (verifyData, sourceIndex, &sourceName, &sourceLength);
-
 	/* classRelationshipVerifierEnabled and target not already loaded, so record the class relationship */
 	if ((classRelationshipVerifierEnabled) && (BCV_ERR_CLASS_RELATIONSHIP_RECORD_REQUIRED == *reasonCode)) {
 		rc = j9bcv_recordClassRelationship(verifyData->vmStruct, verifyData->classLoader, sourceName, sourceLength, targetName, targetLength, reasonCode);
 	}
 
-	if ((IDATA) FALSE != rc) {
-		return rc;
-	}
+	if (!arrayInterfaceOnly
+		&& ((IDATA) FALSE == rc)
+		&& (NULL == verifyData->vmStruct->currentException)
+	) {
+		rc = isRAMClassCompatible(verifyData, targetName, targetLength , sourceName, sourceLength, reasonCode);
 
-	if (NULL != verifyData->vmStruct->currentException) {
-		return (IDATA) FALSE;
+		/* classRelationshipVerifierEnabled and source and/or target not already loaded, so record the class relationship */
+		if ((classRelationshipVerifierEnabled) && (BCV_ERR_CLASS_RELATIONSHIP_RECORD_REQUIRED == *reasonCode)) {
+			rc = j9bcv_recordClassRelationship(verifyData->vmStruct, verifyData->classLoader, sourceName, sourceLength, targetName, targetLength, reasonCode);
+		}
 	}
 
-	rc = isRAMClassCompatible(verifyData, targetName, targetLength , sourceName, sourceLength, reasonCode);
-
-	/* classRelationshipVerifierEnabled and source and/or target not already loaded, so record the class relationship */
-	if ((classRelationshipVerifierEnabled) && (BCV_ERR_CLASS_RELATIONSHIP_RECORD_REQUIRED == *reasonCode)) {
-		rc = j9bcv_recordClassRelationship(verifyData->vmStruct, verifyData->classLoader, sourceName, sourceLength, targetName, targetLength, reasonCode);
+	if (J9_VERIFICATION_RECORD_ACTIVE == verifyData->verificationRecordState) {
+		addVerificationConstraint(verifyData, sourceName, sourceLength, targetName, targetLength, arrayInterfaceOnly, rc, *reasonCode);
 	}
 
 	return rc;
@@ -28,6 +28,8 @@
 #include "ModronAssertions.h"
 
 #include "ArrayletLeafIterator.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapIteratorAPIRootIterator.hpp"
 #include "HeapIteratorAPIBufferedIterator.hpp"
@@ -37,11 +39,13 @@
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapWorkUnitIterator.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "MixedObjectIterator.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "OwnableSynchronizerObjectList.hpp"
+#include "ParallelTask.hpp"
 #include "PointerArrayIterator.hpp"
 #include "SlotObject.hpp"
 #include "VMInterface.hpp"
@@ -84,6 +88,62 @@ iterateRegionObjects(
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
 	void *userData);
 
+static jvmtiIterationControl
+iterateBufferedObjects(
+	J9JavaVM *vm,
+	J9MM_IterateRegionDescriptor *region,
+	HeapIteratorAPI_BufferedIterator *objectHeapIterator,
+	UDATA flags,
+	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
+	void *userData);
+
+/**
+ * Regions larger than this are split, at object boundaries, into several units for the parallel walk.
+ */
+#define HEAPITERATORAPI_PARALLEL_WORK_UNIT_SIZE ((UDATA)4 * 1024 * 1024)
+
+/**
+ * Walks the object heap work units on the GC threads, calling back with the user data of the walking thread.
+ */
+class MM_HeapIteratorAPIParallelTask : public MM_ParallelTask
+{
+	/* Data Members */
+private:
+	J9JavaVM *_javaVM;
+	UDATA _flags;
+	jvmtiIterationControl (*_func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData);
+	void **_userData; /**< User data indexed by GC thread ID */
+	GC_HeapWorkUnitIterator *_units; /**< Hands out the units to walk, splitting regions as they are claimed */
+	omrthread_monitor_t _unitsMutex; /**< Serializes the claims on _units */
+	UDATA _vmState; /**< The VM state of the thread which requested the walk */
+	volatile bool _aborted; /**< Set once any callback has asked for the walk to stop */
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	virtual UDATA getVMStateID(void) { return _vmState; }
+	virtual void run(MM_EnvironmentBase *env);
+
+	bool wasAborted() { return _aborted; }
+
+	MM_HeapIteratorAPIParallelTask(J9JavaVM *javaVM, MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData), void **userData, GC_HeapWorkUnitIterator *units, omrthread_monitor_t unitsMutex)
+		: MM_ParallelTask(env, dispatcher)
+		, _javaVM(javaVM)
+		, _flags(flags)
+		, _func(func)
+		, _userData(userData)
+		, _units(units)
+		, _unitsMutex(unitsMutex)
+		, _vmState(env->getOmrVMThread()->vmState)
+		, _aborted(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 extern "C" {
 
 /* used by j9mm_iterate_all_objects */
@@ -282,6 +342,49 @@ j9mm_iterate_region_objects(
 	return returnCode;
 }
 
+/**
+ * Answer the end of the unit of about unitSize bytes of the given region which starts at base.
+ *
+ * @param region The descriptor (or a copy of the descriptor) of the region to split
+ * @param base The start of the region, or the end of a previous unit
+ * @param unitSize The size of the units, in bytes
+ */
+void *
+j9mm_find_region_unit_top(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *base, UDATA unitSize)
+{
+	/* only the splitting helpers of the iterator are used, so it does not need to collect the heap's regions */
+	GC_HeapWorkUnitIterator splitter(vm, unitSize);
+	return splitter.findUnitTop(region, base);
+}
+
+/**
+ * Walk the objects of the given region which start in [base, top), call user provided function.
+ *
+ * @param region The descriptor (or a copy of the descriptor) of the region that should be walked
+ * @param base The first object to walk, an object boundary
+ * @param top The end of the range to walk
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor.
+ * @param userData Pointer to storage for userData.
+ */
+jvmtiIterationControl
+j9mm_iterate_region_range_objects(
+	J9JavaVM *vm,
+	J9PortLibrary *portLibrary,
+	J9MM_IterateRegionDescriptor *region,
+	void *base,
+	void *top,
+	UDATA flags,
+	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
+	void *userData)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	MM_HeapRegionDescriptor *heapRegion = (MM_HeapRegionDescriptor *)region->id;
+	HeapIteratorAPI_BufferedIterator objectHeapIterator(vm, PORTLIB, heapRegion, base, top, true);
+
+	return iterateBufferedObjects(vm, region, &objectHeapIterator, flags, func, userData);
+}
+
 jvmtiIterationControl static
 iterateObjectSlotDo(
 		J9JavaVM *javaVM,
@@ -483,6 +586,61 @@ internalIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void
 	return j9mm_iterate_region_objects(vm, data->portLibrary, region, data->flags, data->func, data->userData);
 }
 
+/**
+ * Answer the number of threads j9mm_iterate_all_objects_parallel calls back on.
+ * Answers 1 if the heap can only be walked serially.
+ */
+UDATA
+j9mm_get_parallel_iteration_thread_count(J9JavaVM *vm)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm->omrVM);
+	MM_Dispatcher *dispatcher = extensions->dispatcher;
+
+	/* metronome threads are driven by the alarm thread and can't be borrowed outside of a time slice */
+	if ((NULL == dispatcher) || extensions->isMetronomeGC()) {
+		return 1;
+	}
+	return dispatcher->threadCountMaximum();
+}
+
+/**
+ * Walk all objects reachable under the given VM on the GC threads, call user provided function.
+ * The walk falls back to j9mm_iterate_all_objects, using userData[0], if it can't be split.
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor, possibly concurrently.
+ * @param userData One user data pointer per thread reported by j9mm_get_parallel_iteration_thread_count.
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData), void **userData)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm->omrVM);
+
+	if (1 == j9mm_get_parallel_iteration_thread_count(vm)) {
+		return j9mm_iterate_all_objects(vm, portLibrary, flags, func, userData[0]);
+	}
+
+	GC_HeapWorkUnitIterator units(vm, HEAPITERATORAPI_PARALLEL_WORK_UNIT_SIZE);
+	omrthread_monitor_t unitsMutex = NULL;
+	if (!units.initialize() || (0 != omrthread_monitor_init_with_name(&unitsMutex, 0, "HeapIteratorAPI parallel work units"))) {
+		units.tearDown();
+		return j9mm_iterate_all_objects(vm, portLibrary, flags, func, userData[0]);
+	}
+
+	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	MM_HeapIteratorAPIParallelTask iterateTask(vm, env, extensions->dispatcher, flags, func, userData, &units, unitsMutex);
+	extensions->dispatcher->run(env, &iterateTask);
+	if (iterateTask.wasAborted()) {
+		returnCode = JVMTI_ITERATION_ABORT;
+	}
+
+	omrthread_monitor_destroy(unitsMutex);
+	units.tearDown();
+
+	return returnCode;
+}
+
 /**
  * Walk all ownable synchronizer object, call user provided function.
  * @param flags The flags describing the walk (unused currently)
@@ -694,13 +852,29 @@ iterateRegionObjects(
 	void *userData)
 {
 	PORT_ACCESS_FROM_JAVAVM(vm);
-	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
 	/* Iterate over live and dead objects */
 	MM_HeapRegionDescriptor* heapRegion = (MM_HeapRegionDescriptor*)region->id;
-	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(vm->omrVM);
 	HeapIteratorAPI_BufferedIterator objectHeapIterator(vm, PORTLIB, heapRegion, true);
+
+	return iterateBufferedObjects(vm, region, &objectHeapIterator, flags, func, userData);
+}
+
+/**
+ * Report the objects (and holes, if requested) found by the given iterator to the user function.
+ */
+static jvmtiIterationControl
+iterateBufferedObjects(
+	J9JavaVM *vm,
+	J9MM_IterateRegionDescriptor *region,
+	HeapIteratorAPI_BufferedIterator *objectHeapIterator,
+	UDATA flags,
+	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
+	void *userData)
+{
+	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(vm->omrVM);
 	J9Object* object = NULL;
-	while(NULL != (object = objectHeapIterator.nextObject())) {
+	while(NULL != (object = objectHeapIterator->nextObject())) {
 		J9MM_IterateObjectDescriptor objectDescriptor;
 		if ((extensions->objectModel.isDeadObject(object)) || (0 != (J9CLASS_FLAGS(J9GC_J9OBJECT_CLAZZ_VM(object, vm)) & J9AccClassDying))) {
 			if (0 != (flags & j9mm_iterator_flag_include_holes)) {
@@ -730,6 +904,29 @@ iterateRegionObjects(
 	return returnCode;
 }
 
+void
+MM_HeapIteratorAPIParallelTask::run(MM_EnvironmentBase *env)
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	void *userData = _userData[env->getSlaveID()];
+	GC_HeapWorkUnit unit;
+
+	while (!_aborted) {
+		omrthread_monitor_enter(_unitsMutex);
+		bool claimed = _units->nextUnit(&unit);
+		omrthread_monitor_exit(_unitsMutex);
+		if (!claimed) {
+			break;
+		}
+
+		MM_HeapRegionDescriptor *heapRegion = (MM_HeapRegionDescriptor *)unit.regionDesc.id;
+		HeapIteratorAPI_BufferedIterator objectHeapIterator(_javaVM, PORTLIB, heapRegion, unit.base, unit.top, true);
+		if (JVMTI_ITERATION_ABORT == iterateBufferedObjects(_javaVM, &unit.regionDesc, &objectHeapIterator, _flags, _func, userData)) {
+			_aborted = true;
+		}
+	}
+}
+
 /**
  * Find the Region that the pointer belongs too.
  * Returns true if region found.
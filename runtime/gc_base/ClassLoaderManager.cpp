@@ -27,6 +27,7 @@
 #include "j9consts.h"
 #include "segment.h"
 #include "ModronAssertions.h"
+#include "modronnls.h"
 #include "vmhook_internal.h" /* this file triggers a VM hook, so we need the internal version */
 
 #include "ClassLoaderManager.hpp"
@@ -41,6 +42,7 @@
 #include "GlobalCollector.hpp"
 #include "HeapMap.hpp"
 #include "ClassLoaderRememberedSet.hpp"
+#include "VMInterface.hpp"
 
 #if defined(J9VM_GC_REALTIME)
 extern "C" {
@@ -77,6 +79,11 @@ MM_ClassLoaderManager::tearDown(MM_EnvironmentBase *env)
 		omrthread_monitor_destroy(_undeadSegmentListMonitor);
 		_undeadSegmentListMonitor = NULL;
 	}
+
+	if (NULL != _classUnloadingThreadMonitor) {
+		omrthread_monitor_destroy(_classUnloadingThreadMonitor);
+		_classUnloadingThreadMonitor = NULL;
+	}
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	
 	if (_classLoaderListMonitor) {
@@ -109,6 +116,10 @@ MM_ClassLoaderManager::initialize(MM_EnvironmentBase *env)
 	if (0 != omrthread_monitor_init_with_name(&_undeadSegmentListMonitor, 0, "Undead Segment List Monitor")) {		
 		return false;
 	}
+
+	if (0 != omrthread_monitor_init_with_name(&_classUnloadingThreadMonitor, 0, "GC Class Unloading Thread Monitor")) {
+		return false;
+	}
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	
 	if (0 != omrthread_monitor_init_with_name(&_classLoaderListMonitor, 0, "Class Loader List Monitor")) {		
@@ -161,6 +172,12 @@ MM_ClassLoaderManager::flushUndeadSegments(MM_EnvironmentBase *env)
 	_firstUndeadSegment = NULL;
 	_undeadSegmentsTotalSize = 0;
 	omrthread_monitor_exit(_undeadSegmentListMonitor);
+
+	if (isClassUnloadingDeferred()) {
+		/* the heap no longer refers to the dead classes, so the concurrent class unloading thread can free their memory after the collection */
+		deferUndeadSegmentsFree(walker);
+		walker = NULL;
+	}
 	
 	while (NULL != walker) {
 		J9MemorySegment *thisWalk = walker;
@@ -680,6 +697,160 @@ MM_ClassLoaderManager::exitClassUnloadMutex(MM_EnvironmentBase *env)
 #endif /* J9VM_JIT_CLASS_UNLOAD_RWMONITOR */
 }
 
+/**
+ * Entry point of the concurrent class unloading thread.
+ */
+static int J9THREAD_PROC
+classUnloadingThreadProc(void *arg)
+{
+	MM_ClassLoaderManager *classLoaderManager = (MM_ClassLoaderManager *)arg;
+	classLoaderManager->classUnloadingThreadMain();
+	return 0;
+}
+
+bool
+MM_ClassLoaderManager::startUpClassUnloadingThread(MM_EnvironmentBase *env)
+{
+	omrthread_t thread = NULL;
+	bool result = false;
+
+	omrthread_monitor_enter(_classUnloadingThreadMonitor);
+	_classUnloadingThreadState = CLASS_UNLOADING_THREAD_STARTING;
+	if (0 == omrthread_create(&thread, _javaVM->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, 0, classUnloadingThreadProc, (void *)this)) {
+		while (CLASS_UNLOADING_THREAD_STARTING == _classUnloadingThreadState) {
+			omrthread_monitor_wait(_classUnloadingThreadMonitor);
+		}
+		result = (CLASS_UNLOADING_THREAD_RUNNING == _classUnloadingThreadState);
+	} else {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		_classUnloadingThreadState = CLASS_UNLOADING_THREAD_NONE;
+		j9nls_printf(PORTLIB, J9NLS_WARNING, J9NLS_GC_FAILED_TO_START_CLASS_UNLOADING_THREAD);
+	}
+	omrthread_monitor_exit(_classUnloadingThreadMonitor);
+
+	return result;
+}
+
+void
+MM_ClassLoaderManager::shutDownClassUnloadingThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_classUnloadingThreadMonitor);
+	if (CLASS_UNLOADING_THREAD_RUNNING == _classUnloadingThreadState) {
+		_classUnloadingThreadState = CLASS_UNLOADING_THREAD_SHUTDOWN;
+		omrthread_monitor_notify_all(_classUnloadingThreadMonitor);
+		while (CLASS_UNLOADING_THREAD_TERMINATED != _classUnloadingThreadState) {
+			omrthread_monitor_wait(_classUnloadingThreadMonitor);
+		}
+	}
+	omrthread_monitor_exit(_classUnloadingThreadMonitor);
+}
+
+void
+MM_ClassLoaderManager::classUnloadingThreadMain()
+{
+	J9VMThread *vmThread = NULL;
+	J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+
+	if (JNI_OK != vmFuncs->attachSystemDaemonThread(_javaVM, &vmThread, "GC Class Unloading")) {
+		PORT_ACCESS_FROM_JAVAVM(_javaVM);
+		/* class segments keep being freed in the collection */
+		j9nls_printf(PORTLIB, J9NLS_WARNING, J9NLS_GC_FAILED_TO_START_CLASS_UNLOADING_THREAD);
+		omrthread_monitor_enter(_classUnloadingThreadMonitor);
+		_classUnloadingThreadState = CLASS_UNLOADING_THREAD_TERMINATED;
+		omrthread_monitor_notify_all(_classUnloadingThreadMonitor);
+		omrthread_exit(_classUnloadingThreadMonitor);
+	}
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+
+	omrthread_monitor_enter(_classUnloadingThreadMonitor);
+	_classUnloadingThreadState = CLASS_UNLOADING_THREAD_RUNNING;
+	omrthread_monitor_notify_all(_classUnloadingThreadMonitor);
+	while (true) {
+		if (NULL != _deferredFreeSegments) {
+			J9MemorySegment *segments = _deferredFreeSegments;
+			_deferredFreeSegments = NULL;
+			omrthread_monitor_exit(_classUnloadingThreadMonitor);
+			vmFuncs->internalAcquireVMAccess(vmThread);
+			freeDeferredSegments(env, segments);
+			vmFuncs->internalReleaseVMAccess(vmThread);
+			omrthread_monitor_enter(_classUnloadingThreadMonitor);
+		} else if (CLASS_UNLOADING_THREAD_SHUTDOWN == _classUnloadingThreadState) {
+			/* all the pending work is done */
+			break;
+		} else {
+			omrthread_monitor_wait(_classUnloadingThreadMonitor);
+		}
+	}
+	omrthread_monitor_exit(_classUnloadingThreadMonitor);
+
+	vmFuncs->DetachCurrentThread((JavaVM *)_javaVM);
+
+	omrthread_monitor_enter(_classUnloadingThreadMonitor);
+	_classUnloadingThreadState = CLASS_UNLOADING_THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_classUnloadingThreadMonitor);
+	omrthread_exit(_classUnloadingThreadMonitor);
+}
+
+void
+MM_ClassLoaderManager::deferUndeadSegmentsFree(J9MemorySegment *segments)
+{
+	omrthread_monitor_enter(_classUnloadingThreadMonitor);
+	while (NULL != segments) {
+		J9MemorySegment *segment = segments;
+		segments = segment->nextSegmentInClassLoader;
+		segment->nextSegmentInClassLoader = _deferredFreeSegments;
+		_deferredFreeSegments = segment;
+	}
+	omrthread_monitor_notify_all(_classUnloadingThreadMonitor);
+	omrthread_monitor_exit(_classUnloadingThreadMonitor);
+}
+
+void
+MM_ClassLoaderManager::freeDeferredSegments(MM_EnvironmentBase *env, J9MemorySegment *segments)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	J9VMThread *vmThread = (J9VMThread *)env->getLanguageVMThread();
+	J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+	UDATA segmentsFreed = 0;
+	UDATA bytesFreed = 0;
+
+	U_64 startTime = j9time_hires_clock();
+	while (NULL != segments) {
+		J9MemorySegment *segment = segments;
+		segments = segment->nextSegmentInClassLoader;
+		segmentsFreed += 1;
+		bytesFreed += segment->size;
+		/* the class walkers (allClassesStartDo) follow the class segment list holding only the class table mutex,
+		 * so take it as well as the segment mutex (taken by freeMemorySegment) to unlink and free the segment
+		 */
+		GC_VMInterface::lockClassTable(_extensions);
+		vmFuncs->freeMemorySegment(_javaVM, segment, TRUE);
+		GC_VMInterface::unlockClassTable(_extensions);
+
+		/* let a pending exclusive access request in between segments */
+		if (J9_ARE_ANY_BITS_SET(vmThread->publicFlags, J9_PUBLIC_FLAGS_HALT_THREAD_ANY)) {
+			vmFuncs->internalReleaseVMAccess(vmThread);
+			vmFuncs->internalAcquireVMAccess(vmThread);
+		}
+	}
+	U_64 endTime = j9time_hires_clock();
+
+	omrthread_monitor_enter(_classUnloadingThreadMonitor);
+	_concurrentClassUnloadStats._segmentsFreed += segmentsFreed;
+	_concurrentClassUnloadStats._bytesFreed += bytesFreed;
+	_concurrentClassUnloadStats._segmentTime += j9time_hires_delta(startTime, endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	omrthread_monitor_exit(_classUnloadingThreadMonitor);
+}
+
+void
+MM_ClassLoaderManager::consumeConcurrentClassUnloadStats(MM_ConcurrentClassUnloadStats *stats)
+{
+	omrthread_monitor_enter(_classUnloadingThreadMonitor);
+	*stats = _concurrentClassUnloadStats;
+	_concurrentClassUnloadStats.clear();
+	omrthread_monitor_exit(_classUnloadingThreadMonitor);
+}
+
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 
@@ -34,6 +34,7 @@
 
 
 #include "BaseNonVirtual.hpp"
+#include "ConcurrentClassUnloadStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 
@@ -56,6 +57,21 @@ private:
 	UDATA _undeadSegmentsTotalSize;
 	UDATA _lastUnloadNumOfClassLoaders;  /**< number of class loaders last seen during a dynamic class unloading pass */
 	UDATA _lastUnloadNumOfAnonymousClasses; /**< number of anonymous classes last seen during a dynamic class unloading pass */
+
+	/**
+	 * States of the thread which performs the concurrent part of class unloading.
+	 */
+	enum ClassUnloadingThreadState {
+		CLASS_UNLOADING_THREAD_NONE = 0, /**< the thread has not been started (class segments are freed in the collection) */
+		CLASS_UNLOADING_THREAD_STARTING, /**< the thread has been created but has not yet attached to the VM */
+		CLASS_UNLOADING_THREAD_RUNNING, /**< the thread is attached and accepts segments to free */
+		CLASS_UNLOADING_THREAD_SHUTDOWN, /**< the thread has been asked to finish the pending work and exit */
+		CLASS_UNLOADING_THREAD_TERMINATED /**< the thread has exited (or failed to attach) */
+	};
+	omrthread_monitor_t _classUnloadingThreadMonitor; /**< protects the deferred segment list, stats and the thread state */
+	volatile ClassUnloadingThreadState _classUnloadingThreadState; /**< state of the concurrent class unloading thread */
+	J9MemorySegment *_deferredFreeSegments; /**< undead class segments flushed by a collection which the thread still has to free, connected through the nextSegmentInClassLoader field */
+	MM_ConcurrentClassUnloadStats _concurrentClassUnloadStats; /**< work done by the concurrent class unloading thread since it was last reported */
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	MM_GlobalCollector *_globalCollector; /**< Pointer to the global collector.  Used for yielding */
 	J9ClassLoader *_classLoaders; /**< Linked list of classloaders */
@@ -75,6 +91,10 @@ public:
 		,_undeadSegmentsTotalSize(0)
 		,_lastUnloadNumOfClassLoaders(0)
 		,_lastUnloadNumOfAnonymousClasses(0)
+		,_classUnloadingThreadMonitor(NULL)
+		,_classUnloadingThreadState(CLASS_UNLOADING_THREAD_NONE)
+		,_deferredFreeSegments(NULL)
+		,_concurrentClassUnloadStats()
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		,_globalCollector(globalCollector)
 		,_classLoaders(NULL)
@@ -93,7 +113,8 @@ public:
 	void enqueueUndeadClassSegments(J9MemorySegment *listRoot);
 	
 	/**
-	 * Flushes the cached list of segments by calling the VM's freeMemorySegment method
+	 * Flushes the cached list of segments by calling the VM's freeMemorySegment method, or by handing them to the
+	 * concurrent class unloading thread when one is running.  The heap must not refer to any of the segments' classes.
 	 * @param env The environment
 	 */
 	void flushUndeadSegments(MM_EnvironmentBase *env);
@@ -219,6 +240,36 @@ public:
 	 */
 	void cleanUpSegmentsInAnonymousClassLoader(MM_EnvironmentBase *env, J9MemorySegment **reclaimedSegments);
 
+	/**
+	 * Start the thread which frees the undead class segments after the collection (-Xgc:concurrentClassUnloading).
+	 * @param env[in] the current thread
+	 * @return true if the thread was started, false otherwise
+	 */
+	bool startUpClassUnloadingThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Ask the concurrent class unloading thread to finish its pending work and wait for it to exit.
+	 * @param env[in] the current thread
+	 */
+	void shutDownClassUnloadingThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Answer true if flushUndeadSegments hands the undead class segments to the concurrent class unloading
+	 * thread rather than freeing them in the collection.
+	 */
+	bool isClassUnloadingDeferred() { return CLASS_UNLOADING_THREAD_RUNNING == _classUnloadingThreadState; }
+
+	/**
+	 * Return the stats accumulated by the concurrent class segment freeing since the last call, and clear them.
+	 * @param stats[out] the accumulated stats
+	 */
+	void consumeConcurrentClassUnloadStats(MM_ConcurrentClassUnloadStats *stats);
+
+	/**
+	 * Main loop of the concurrent class unloading thread.
+	 */
+	void classUnloadingThreadMain();
+
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	
 	/**
@@ -248,6 +299,19 @@ private:
 	 */
 	J9Class *addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoader * classLoader, MM_HeapMap *markMap, bool setAll, J9Class *classUnloadListStart, UDATA *classUnloadCountOut);
 
+	/**
+	 * Queue undead class segments for the concurrent class unloading thread and wake it up.
+	 * @param segments[in] the segments to free, connected through the nextSegmentInClassLoader field
+	 */
+	void deferUndeadSegmentsFree(J9MemorySegment *segments);
+
+	/**
+	 * Free undead class segments, yielding VM access between segments when exclusive access is requested.
+	 * @param env[in] the concurrent class unloading thread, which holds VM access
+	 * @param segments[in] the segments to free, connected through the nextSegmentInClassLoader field
+	 */
+	void freeDeferredSegments(MM_EnvironmentBase *env, J9MemorySegment *segments);
+
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 };
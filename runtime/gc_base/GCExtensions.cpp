@@ -35,11 +35,13 @@
 #include "Forge.hpp"
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
  #include  "IdleGCManager.hpp"
+ #include  "MemoryPressureMonitor.hpp"
 #endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "ObjectModel.hpp"
 #include "ReferenceChainWalkerMarkMap.hpp"
+#include "SoftReferenceAgeStats.hpp"
 #include "SublistPool.hpp"
 #include "Wildcard.hpp"
 
@@ -178,6 +180,10 @@ MM_GCExtensions::tearDown(MM_EnvironmentBase *env)
 		idleGCManager->kill(env);
 		idleGCManager = NULL;
 	}
+	if (NULL != memoryPressureMonitor) {
+		memoryPressureMonitor->kill(env);
+		memoryPressureMonitor = NULL;
+	}
 #endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 	MM_GCExtensionsBase::tearDown(env);
@@ -269,6 +275,30 @@ MM_GCExtensions::computeDefaultMaxHeap(MM_EnvironmentBase *env)
 	memoryMax = MM_Math::roundToFloor(heapAlignment, memoryMax);
 }
 
+void
+MM_GCExtensions::updateDynamicMaxSoftReferenceAge(double percentFree, MM_SoftReferenceAgeStats *ageStats)
+{
+	UDATA age = (UDATA)(percentFree * (double)maxSoftReferenceAge);
+
+	if (softReferenceLRU) {
+		/* the fuller the heap, the larger the share of soft referents which may be dropped */
+		UDATA clearBudget = (UDATA)((double)ageStats->getSurvivorCount() * (1.0 - percentFree) * (double)softReferenceLRUClearPercentage / 100.0);
+		UDATA lruAge = maxSoftReferenceAge;
+		UDATA clearable = 0;
+		/* make the least recently used buckets clearable for as long as they fit in the budget */
+		for (IDATA bucket = SOFT_REFERENCE_AGE_BUCKETS - 1; bucket >= 0; bucket--) {
+			clearable += ageStats->_survivors[bucket];
+			if (clearable > clearBudget) {
+				break;
+			}
+			lruAge = MM_SoftReferenceAgeStats::lowestAgeInBucket((UDATA)bucket, maxSoftReferenceAge);
+		}
+		age = OMR_MAX(age, lruAge);
+	}
+
+	dynamicMaxSoftReferenceAge = OMR_MIN(age, maxSoftReferenceAge);
+}
+
 MM_OwnableSynchronizerObjectList *
 MM_GCExtensions::getOwnableSynchronizerObjectListsExternal(J9VMThread *vmThread)
 {
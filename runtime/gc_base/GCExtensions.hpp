@@ -57,6 +57,7 @@ class MM_HeapMap;
 class MM_MemorySubSpace;
 class MM_ObjectAccessBarrier;
 class MM_OwnableSynchronizerObjectList;
+class MM_SoftReferenceAgeStats;
 class MM_StringTable;
 class MM_UnfinalizedObjectList;
 class MM_Wildcard;
@@ -71,8 +72,13 @@ class MM_ReferenceObjectList;
 
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 class MM_IdleGCManager;
+class MM_MemoryPressureMonitor;
 #endif
 
+#if defined(J9VM_GC_VLHGC)
+class MM_GCThreadCountAdvisor;
+#endif /* defined(J9VM_GC_VLHGC) */
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Base
@@ -118,6 +124,7 @@ public:
 	UDATA dynamicClassUnloadingKickoffThreshold; /**< the threshold to kickoff a concurrent global GC from a scavenge */
 	UDATA dynamicClassUnloadingThreshold; /**< the threshold to trigger class unloading during a global GC */
 	double classUnloadingAnonymousClassWeight; /**< The weight factor to apply to anonymous classes for threshold comparisons */
+	bool concurrentClassUnloading; /**< if true, the class segments of unloaded classes are freed by a background thread after the global collection releases exclusive access */
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 	U_32 _stringTableListToTreeThreshold; /**< Threshold at which we start using trees instead of lists for collision resolution in the String table */
@@ -128,6 +135,8 @@ public:
 
 	UDATA maxSoftReferenceAge; /**< The fixed age specified as the soft reference threshold which acts as our baseline for the dynamicMaxSoftReferenceAge */
 	UDATA dynamicMaxSoftReferenceAge; /**< The age which represents the clearing age of soft references for a globalGC cycle.  At the end of a GC cycle, it will be updated for the following cycle by taking the percentage of free heap in the oldest generation as a fraction of the maxSoftReferenceAge */
+	bool softReferenceLRU; /**< if true, dynamicMaxSoftReferenceAge is raised so that each collection clears at most a bounded share of the soft references, least recently used first (-Xgc:softReferenceLRU) */
+	UDATA softReferenceLRUClearPercentage; /**< percentage of the surviving soft references which may become clearable by the next collection when the heap is full; scaled down by the free heap */
 #if defined(J9VM_GC_FINALIZATION)
 	GC_FinalizeListManager* finalizeListManager;
 #endif /* J9VM_GC_FINALIZATION */
@@ -182,11 +191,37 @@ public:
 
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
+	MM_MemoryPressureMonitor* memoryPressureMonitor; /**< Monitor which shrinks the heap when the process nears its memory limit (NULL unless -Xgc:memoryPressureMonitor) */
+	bool memoryPressureMonitorEnabled; /**< if true, start the memory pressure monitor */
+	UDATA memoryPressureThreshold; /**< percentage of the (cgroup) memory limit in use above which the heap is shrunk */
+	UDATA memoryPressureStallThreshold; /**< percentage of time stalled on memory (PSI some avg10) above which the heap is shrunk */
+	UDATA memoryPressureCheckInterval; /**< milliseconds between two samples of the memory pressure */
+	UDATA memoryPressureMinimumReliefInterval; /**< minimum milliseconds between two heap shrinks caused by memory pressure */
+	double memoryPressureMaximumContraction; /**< maximum fraction of the heap given back by a single heap shrink caused by memory pressure */
+	UDATA fvtest_forceMemoryPressureSamples; /**< number of samples, from the first, the memory pressure monitor reports as under pressure whatever the memory used */
 #endif
 
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 
+	bool verboseBinaryFormat; /**< if true, file based verbose GC output is written to a memory mapped binary ring (-Xgc:verboseFormat=binary) */
+	UDATA verboseBinaryRingSize; /**< size in bytes of the binary verbose GC ring file (-Xgc:verboseBinaryRingSize=) */
+#if defined(J9VM_GC_VLHGC)
+	bool jniCriticalRegionPinning; /**< if true, Balanced pins the region of a JNI critical array instead of holding JNI critical access, so exclusive access does not wait for critical sections to end */
+	bool adaptiveThreadCount; /**< if true, Balanced dispatches its copy-forward and mark phases on a number of GC threads sized from the work of the previous cycles (-Xgc:adaptiveThreadCount) */
+	UDATA adaptiveThreadCountBytesPerThread; /**< number of bytes scanned by a phase which justify one more GC thread */
+	MM_GCThreadCountAdvisor *gcThreadCountAdvisor; /**< chooses the GC thread count of each phase when adaptiveThreadCount is enabled (NULL otherwise) */
+	bool numaLocalityStatsEnabled; /**< if true, global marking counts whether the objects it scans are on the node of the scanning thread (set by -Xtgc:numa) */
+#endif /* defined(J9VM_GC_VLHGC) */
+	bool hotFieldCopying; /**< if true, the scavenger and copy-forward copy the objects referenced from the JIT-marked hot fields of an object right after the object (-Xgc:hotFieldCopying) */
+	UDATA hotFieldCopyDepth; /**< maximum number of hot field references followed from an object being copied by copy-forward */
+#if defined(J9VM_GC_REALTIME)
+	bool dynamicTargetUtilization; /**< if true, Metronome adjusts its target utilization and GC quantum from the allocation rate and free memory (-Xgc:dynamicTargetUtilization) */
+	UDATA targetUtilizationMinimumPercentage; /**< lowest mutator utilization the dynamic controller may choose (0 means half of targetUtilization) */
+	UDATA targetUtilizationMaximumPercentage; /**< highest mutator utilization the dynamic controller may choose (0 means targetUtilization) */
+	UDATA beatMaximumMicro; /**< longest GC quantum in microseconds the dynamic controller may choose (0 means the beat size) */
+#endif /* defined(J9VM_GC_REALTIME) */
+
 protected:
 private:
 protected:
@@ -216,6 +251,16 @@ public:
 		return maxSoftReferenceAge;
 	}
 
+	/**
+	 * Pick the soft reference clearing age of the next collection from the free heap after this one.
+	 * With softReferenceLRU, the age is raised as needed so that no more than softReferenceLRUClearPercentage
+	 * (scaled by the used fraction of the heap) of the soft references kept by this collection become
+	 * clearable, starting from the least recently used ones.
+	 * @param percentFree[in] fraction (0.0 - 1.0) of the heap free after the collection
+	 * @param ageStats[in] ages of the soft references kept by the collection
+	 */
+	void updateDynamicMaxSoftReferenceAge(double percentFree, MM_SoftReferenceAgeStats *ageStats);
+
 	virtual void identityHashDataAddRange(MM_EnvironmentBase* env, MM_MemorySubSpace* subspace, UDATA size, void* lowAddress, void* highAddress);
 	virtual void identityHashDataRemoveRange(MM_EnvironmentBase* env, MM_MemorySubSpace* subspace, UDATA size, void* lowAddress, void* highAddress);
 
@@ -293,9 +338,12 @@ public:
 		, dynamicClassUnloadingKickoffThreshold(0)
 		, dynamicClassUnloadingThreshold(0)
 		, classUnloadingAnonymousClassWeight(1.0)
+		, concurrentClassUnloading(false)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		, _stringTableListToTreeThreshold(1024)
 		, maxSoftReferenceAge(32)
+		, softReferenceLRU(false)
+		, softReferenceLRUClearPercentage(25)
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMasterPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeSlavePriority(J9THREAD_PRIORITY_NORMAL)
@@ -313,9 +361,34 @@ public:
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
+		, memoryPressureMonitor(NULL)
+		, memoryPressureMonitorEnabled(false)
+		, memoryPressureThreshold(90)
+		, memoryPressureStallThreshold(10)
+		, memoryPressureCheckInterval(1000)
+		, memoryPressureMinimumReliefInterval(10000)
+		, memoryPressureMaximumContraction(0.1)
+		, fvtest_forceMemoryPressureSamples(0)
 #endif
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
+		, verboseBinaryFormat(false)
+		, verboseBinaryRingSize(64 * 1024 * 1024) /* default is 64 MiB */
+#if defined(J9VM_GC_VLHGC)
+		, jniCriticalRegionPinning(false)
+		, adaptiveThreadCount(false)
+		, adaptiveThreadCountBytesPerThread(1024 * 1024)
+		, gcThreadCountAdvisor(NULL)
+		, numaLocalityStatsEnabled(false)
+#endif /* defined(J9VM_GC_VLHGC) */
+		, hotFieldCopying(false)
+		, hotFieldCopyDepth(4)
+#if defined(J9VM_GC_REALTIME)
+		, dynamicTargetUtilization(false)
+		, targetUtilizationMinimumPercentage(0)
+		, targetUtilizationMaximumPercentage(0)
+		, beatMaximumMicro(0)
+#endif /* defined(J9VM_GC_REALTIME) */
 	{
 		_typeId = __FUNCTION__;
 	}
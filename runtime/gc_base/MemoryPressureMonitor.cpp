@@ -0,0 +1,311 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+#include "j9protos.h"
+#include "j9consts.h"
+#include "mmhook_internal.h"
+
+#include <string.h>
+
+#include "MemoryPressureMonitor.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "Heap.hpp"
+#include "Math.hpp"
+
+/**
+ * Entry point of the memory pressure monitor thread.
+ */
+static int J9THREAD_PROC
+memoryPressureMonitorThreadProc(void *arg)
+{
+	MM_MemoryPressureMonitor *monitor = (MM_MemoryPressureMonitor *)arg;
+	monitor->threadMain();
+	return 0;
+}
+
+MM_MemoryPressureMonitor::MM_MemoryPressureMonitor(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+	, _extensions(MM_GCExtensions::getExtensions(env))
+	, _monitor(NULL)
+	, _threadState(THREAD_NONE)
+	, _lastReliefTime(0)
+	, _originalSoftMx(0)
+	, _loweredSoftMx(0)
+	, _sampleCount(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_MemoryPressureMonitor *
+MM_MemoryPressureMonitor::newInstance(MM_EnvironmentBase *env)
+{
+	MM_MemoryPressureMonitor *monitor = (MM_MemoryPressureMonitor *)env->getForge()->allocate(sizeof(MM_MemoryPressureMonitor), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != monitor) {
+		new(monitor) MM_MemoryPressureMonitor(env);
+		if (!monitor->initialize(env)) {
+			monitor->kill(env);
+			monitor = NULL;
+		}
+	}
+	return monitor;
+}
+
+void
+MM_MemoryPressureMonitor::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_MemoryPressureMonitor::initialize(MM_EnvironmentBase *env)
+{
+	return 0 == omrthread_monitor_init_with_name(&_monitor, 0, "GC Memory Pressure Monitor");
+}
+
+void
+MM_MemoryPressureMonitor::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+bool
+MM_MemoryPressureMonitor::startUpThread(MM_EnvironmentBase *env)
+{
+	omrthread_t thread = NULL;
+	bool result = false;
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_STARTING;
+	if (0 == omrthread_create(&thread, _javaVM->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, 0, memoryPressureMonitorThreadProc, (void *)this)) {
+		while (THREAD_STARTING == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		result = (THREAD_RUNNING == _threadState);
+	} else {
+		_threadState = THREAD_NONE;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+void
+MM_MemoryPressureMonitor::shutDownThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if (THREAD_RUNNING == _threadState) {
+		_threadState = THREAD_SHUTDOWN;
+		omrthread_monitor_notify_all(_monitor);
+		while (THREAD_TERMINATED != _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_MemoryPressureMonitor::threadMain()
+{
+	J9VMThread *vmThread = NULL;
+	J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+
+	if (JNI_OK != vmFuncs->attachSystemDaemonThread(_javaVM, &vmThread, "GC Memory Pressure Monitor")) {
+		omrthread_monitor_enter(_monitor);
+		_threadState = THREAD_TERMINATED;
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_exit(_monitor);
+	}
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+	while (THREAD_SHUTDOWN != _threadState) {
+		omrthread_monitor_wait_timed(_monitor, _extensions->memoryPressureCheckInterval, 0);
+		if (THREAD_SHUTDOWN == _threadState) {
+			break;
+		}
+		omrthread_monitor_exit(_monitor);
+
+		const char *reason = NULL;
+		U_64 memoryUsed = 0;
+		U_64 memoryLimit = 0;
+		if (isUnderMemoryPressure(env, &reason, &memoryUsed, &memoryLimit)) {
+			/* rate limit the collections so that a container which stays close to its limit is not collected back to back */
+			U_64 now = j9time_current_time_millis();
+			if ((now - _lastReliefTime) >= _extensions->memoryPressureMinimumReliefInterval) {
+				vmFuncs->internalAcquireVMAccess(vmThread);
+				relieveMemoryPressure(env, reason, memoryUsed, memoryLimit);
+				vmFuncs->internalReleaseVMAccess(vmThread);
+				_lastReliefTime = j9time_current_time_millis();
+			}
+		} else {
+			restoreSoftMx();
+		}
+
+		omrthread_monitor_enter(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	restoreSoftMx();
+	vmFuncs->DetachCurrentThread((JavaVM *)_javaVM);
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+bool
+MM_MemoryPressureMonitor::isUnderMemoryPressure(MM_EnvironmentBase *env, const char **reason, U_64 *memoryUsed, U_64 *memoryLimit)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	bool underPressure = false;
+	J9MemoryInfo memInfo;
+
+	/* the physical memory is reported against the cgroup limit when the cgroup memory subsystem is enabled */
+	if ((0 == j9sysinfo_get_memory_info(&memInfo))
+		&& (OMRPORT_MEMINFO_NOT_AVAILABLE != memInfo.totalPhysical)
+		&& (OMRPORT_MEMINFO_NOT_AVAILABLE != memInfo.availPhysical)
+		&& (memInfo.totalPhysical > memInfo.availPhysical)
+	) {
+		*memoryLimit = memInfo.totalPhysical;
+		*memoryUsed = memInfo.totalPhysical - memInfo.availPhysical;
+		if ((*memoryUsed / 100) >= ((*memoryLimit / 100) * _extensions->memoryPressureThreshold)) {
+			*reason = "memory limit";
+			underPressure = true;
+		}
+	}
+
+	if (!underPressure) {
+		IDATA stallPercentage = readMemoryStallPercentage(env);
+		if ((0 <= stallPercentage) && ((UDATA)stallPercentage >= _extensions->memoryPressureStallThreshold)) {
+			*reason = "memory stall";
+			underPressure = true;
+		}
+	}
+
+	if (!underPressure && (_sampleCount < _extensions->fvtest_forceMemoryPressureSamples)) {
+		*reason = "fvtest";
+		underPressure = true;
+	}
+	_sampleCount += 1;
+
+	return underPressure;
+}
+
+IDATA
+MM_MemoryPressureMonitor::readMemoryStallPercentage(MM_EnvironmentBase *env)
+{
+	IDATA result = -1;
+#if defined(LINUX)
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	/* the cgroup v2 file is the one of the container when running in a cgroup namespace */
+	const char *pressureFiles[] = { "/sys/fs/cgroup/memory.pressure", "/proc/pressure/memory" };
+
+	for (UDATA i = 0; (i < sizeof(pressureFiles) / sizeof(pressureFiles[0])) && (-1 == result); i++) {
+		IDATA fd = j9file_open(pressureFiles[i], EsOpenRead, 0);
+		if (-1 != fd) {
+			/* the first line is "some avg10=<percent> avg60=<percent> avg300=<percent> total=<us>" */
+			char buffer[256];
+			IDATA bytesRead = j9file_read(fd, buffer, sizeof(buffer) - 1);
+			j9file_close(fd);
+			if (0 < bytesRead) {
+				buffer[bytesRead] = '\0';
+				const char *avg10 = strstr(buffer, "some avg10=");
+				if (NULL != avg10) {
+					avg10 += strlen("some avg10=");
+					result = 0;
+					while (('0' <= *avg10) && ('9' >= *avg10)) {
+						result = (result * 10) + (*avg10 - '0');
+						avg10 += 1;
+					}
+				}
+			}
+		}
+	}
+#endif /* defined(LINUX) */
+	return result;
+}
+
+void
+MM_MemoryPressureMonitor::relieveMemoryPressure(MM_EnvironmentBase *env, const char *reason, U_64 memoryUsed, U_64 memoryLimit)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_Heap *heap = _extensions->heap;
+	UDATA heapSizeBefore = heap->getActiveMemorySize();
+
+	/* contract by at most memoryPressureMaximumContraction of the heap per step, and never below the live data or -Xms */
+	UDATA contraction = OMR_MIN((UDATA)(heapSizeBefore * _extensions->memoryPressureMaximumContraction), heap->getApproximateFreeMemorySize());
+	UDATA targetSoftMx = MM_Math::roundToFloor(_extensions->heapAlignment, heapSizeBefore - contraction);
+	targetSoftMx = MM_Math::roundToFloor(_extensions->regionSize, targetSoftMx);
+	targetSoftMx = OMR_MAX(targetSoftMx, _extensions->initialMemorySize);
+	if (targetSoftMx >= heapSizeBefore) {
+		/* the heap can not shrink any further, so an idle collection would only cost a pause */
+		return;
+	}
+
+	if (0 == _loweredSoftMx) {
+		_originalSoftMx = _extensions->softMx;
+	}
+	_extensions->softMx = targetSoftMx;
+	_loweredSoftMx = targetSoftMx;
+
+	/* the standard collectors contract and release the pages of free memory on an idle collection; the Balanced collector decommits the regions it contracts */
+	heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
+
+	TRIGGER_J9HOOK_MM_MEMORY_PRESSURE_RELIEF_END(
+		_extensions->hookInterface,
+		(J9VMThread *)env->getLanguageVMThread(),
+		j9time_hires_clock(),
+		J9HOOK_MM_MEMORY_PRESSURE_RELIEF_END,
+		reason,
+		memoryUsed,
+		memoryLimit,
+		heapSizeBefore,
+		heap->getActiveMemorySize(),
+		_extensions->softMx);
+}
+
+void
+MM_MemoryPressureMonitor::restoreSoftMx()
+{
+	if (0 != _loweredSoftMx) {
+		/* leave a soft maximum set through the management API alone */
+		if (_extensions->softMx == _loweredSoftMx) {
+			_extensions->softMx = _originalSoftMx;
+		}
+		_loweredSoftMx = 0;
+	}
+}
+
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
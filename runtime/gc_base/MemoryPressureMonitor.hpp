@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+#if !defined(MEMORYPRESSUREMONITOR_HPP_)
+#define MEMORYPRESSUREMONITOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensions;
+
+/**
+ * Watches the memory pressure of the process (the usage of the cgroup memory limit, or of physical memory when
+ * no limit is set, and on Linux the PSI memory stall average) and, while the pressure is above the configured
+ * thresholds, shrinks the heap and returns its free memory to the operating system, even if the JVM is busy.
+ * The heap is shrunk by lowering the soft maximum heap size in steps and collecting: the Balanced collector
+ * decommits the regions freed by the contraction and the standard collectors contract and release free pages
+ * as they do on idle.  Each step is rate limited and the original soft maximum is restored once the pressure is gone.
+ */
+class MM_MemoryPressureMonitor : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	/**
+	 * States of the monitor thread.
+	 */
+	enum ThreadState {
+		THREAD_NONE = 0, /**< the thread has not been started */
+		THREAD_STARTING, /**< the thread has been created but has not yet attached to the VM */
+		THREAD_RUNNING, /**< the thread is attached and sampling the memory pressure */
+		THREAD_SHUTDOWN, /**< the thread has been asked to exit */
+		THREAD_TERMINATED /**< the thread has exited (or failed to attach) */
+	};
+
+	J9JavaVM *_javaVM; /**< reference to the language runtime */
+	MM_GCExtensions *_extensions;
+	omrthread_monitor_t _monitor; /**< protects the thread state and is waited on between samples */
+	volatile ThreadState _threadState; /**< state of the monitor thread */
+	U_64 _lastReliefTime; /**< time (in milliseconds) the heap was last shrunk because of memory pressure */
+	UDATA _originalSoftMx; /**< soft maximum heap size in effect before the monitor started lowering it */
+	UDATA _loweredSoftMx; /**< soft maximum heap size last set by the monitor, 0 if the monitor has not lowered it */
+	UDATA _sampleCount; /**< number of times the memory pressure has been sampled */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Sample the memory pressure.
+	 * @param env[in] the monitor thread
+	 * @param reason[out] description of the signal which reports the pressure, if any
+	 * @param memoryUsed[out] bytes of memory used by the process (or the cgroup)
+	 * @param memoryLimit[out] bytes of memory available to the process (or the cgroup)
+	 * @return true if the memory pressure is above one of the thresholds (or is forced by -Xgc:fvtest=forceMemoryPressure=)
+	 */
+	bool isUnderMemoryPressure(MM_EnvironmentBase *env, const char **reason, U_64 *memoryUsed, U_64 *memoryLimit);
+
+	/**
+	 * Read the "some avg10" memory stall percentage from the Linux pressure stall information of the
+	 * cgroup (or of the whole system when the cgroup does not report it).
+	 * @param env[in] the monitor thread
+	 * @return the integral percentage of time stalled on memory, or -1 if PSI is not available
+	 */
+	IDATA readMemoryStallPercentage(MM_EnvironmentBase *env);
+
+	/**
+	 * Lower the soft maximum heap size by one step and collect, so that the heap contracts and returns
+	 * its free memory to the operating system.  Reports the memory reclaimed through J9HOOK_MM_MEMORY_PRESSURE_RELIEF_END.
+	 * Does nothing when the heap is already at the lowest size the step allows (-Xms or the live data).
+	 * @param env[in] the monitor thread, which must hold VM access
+	 * @param reason[in] description of the signal which reported the pressure
+	 * @param memoryUsed[in] bytes of memory used by the process (or the cgroup) when the pressure was sampled
+	 * @param memoryLimit[in] bytes of memory available to the process (or the cgroup)
+	 */
+	void relieveMemoryPressure(MM_EnvironmentBase *env, const char *reason, U_64 memoryUsed, U_64 memoryLimit);
+
+	/**
+	 * Give back the soft maximum heap size in effect before the pressure, unless it has been changed since the monitor lowered it.
+	 */
+	void restoreSoftMx();
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_MemoryPressureMonitor *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the memory pressure monitor thread.
+	 * @return true if the thread was started, false otherwise
+	 */
+	bool startUpThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Ask the memory pressure monitor thread to exit and wait for it.
+	 */
+	void shutDownThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Main loop of the memory pressure monitor thread.
+	 */
+	void threadMain();
+
+	MM_MemoryPressureMonitor(MM_EnvironmentBase *env);
+};
+
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+#endif /* MEMORYPRESSUREMONITOR_HPP_ */
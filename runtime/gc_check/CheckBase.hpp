@@ -101,6 +101,8 @@
 #define J9MODRON_GCCHK_MISC_ALWAYS_DUMP_STACK ((UDATA)0x00004000)
 #define J9MODRON_GCCHK_MISC_DARKMATTER ((UDATA)0x00008000)
 #define J9MODRON_GCCHK_MISC_MIDSCAVENGE ((UDATA)0x00010000)
+#define J9MODRON_GCCHK_MISC_PARALLEL ((UDATA)0x00020000)
+#define J9MODRON_GCCHK_MISC_INCREMENTAL ((UDATA)0x00040000)
 /** @} */
 
 /**
@@ -225,6 +227,10 @@ typedef struct GCCHK_Extensions {
 	UDATA localGcInterval;
 	UDATA localGcCount;
 #endif /* J9VM_GC_MODRON_SCAVENGER */
+	UDATA incrementalSliceSize; /**< Bytes of object heap verified per invocation when the incremental option is set */
+	void *incrementalCursor; /**< Heap address at which the next incremental slice starts (NULL to restart at the bottom of the heap) */
+	UDATA incrementalCursorGcCount; /**< Number of collections started when the incremental cursor was saved */
+	bool incrementalCursorSavedAfterGc; /**< True if the incremental cursor was saved at the end of a collection */
 } GCCHK_Extensions;
 #endif /* CHECKBASE_HPP_ */
 
@@ -117,6 +117,9 @@ GC_CheckCycle::printHelp(J9PortLibrary *portLib)
 	j9tty_printf(PORTLIB, "  noabort\n");
 	j9tty_printf(PORTLIB, "  dumpstack\n");
 	j9tty_printf(PORTLIB, "  nodumpstack\n");
+	j9tty_printf(PORTLIB, "  parallel          verify the object heap on all GC threads\n");
+	j9tty_printf(PORTLIB, "  noparallel\n");
+	j9tty_printf(PORTLIB, "  incremental=X     verify at most X MB of the object heap per invocation\n");
 	j9tty_printf(PORTLIB, "  interval=X\n");
 	j9tty_printf(PORTLIB, "  globalinterval=X\n");
 #if defined(J9VM_GC_MODRON_SCAVENGER)
@@ -325,6 +328,29 @@ top:
 							continue;
 						}
 
+						if (try_scan(&scan_start, "parallel")) {
+							miscFlags |= J9MODRON_GCCHK_MISC_PARALLEL;
+							continue;
+						}
+
+						if (try_scan(&scan_start, "noparallel")) {
+							miscFlags &= ~J9MODRON_GCCHK_MISC_PARALLEL;
+							continue;
+						}
+
+						if (try_scan(&scan_start, "incremental=")) {
+							UDATA sliceSizeInMB = 0;
+							scan_udata(&scan_start, &sliceSizeInMB);
+							if (0 == sliceSizeInMB) {
+								goto failure;
+							}
+							extensions->incrementalSliceSize = sliceSizeInMB * 1024 * 1024;
+							extensions->incrementalCursor = NULL;
+							extensions->incrementalCursorSavedAfterGc = false;
+							miscFlags |= J9MODRON_GCCHK_MISC_INCREMENTAL;
+							continue;
+						}
+
 						if (try_scan(&scan_start, "interval=")) {
 							scan_udata(&scan_start, &extensions->gcInterval);
 							miscFlags |= J9MODRON_GCCHK_INTERVAL;
@@ -32,6 +32,7 @@
 #include "j9.h"
 #include "j9cfg.h"
 
+#include "AtomicOperations.hpp"
 #include "Base.hpp"
 #include "CheckBase.hpp"
 
@@ -85,7 +86,11 @@ public:
 	GCCheckInvokedBy getInvoker() { return _invokedBy; };
 	UDATA getManualCheckNumber() { return _manualCheckInvocation; };
 	
-	UDATA nextErrorCount() { return ++_errorCount; };
+	/**
+	 * Allocate the next error number.
+	 * Atomic since the object heap check may report errors from several GC threads at once.
+	 */
+	UDATA nextErrorCount() { return MM_AtomicOperations::add(&_errorCount, 1); };
 	
 	/**
 	 * Run the checks
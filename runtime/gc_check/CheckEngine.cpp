@@ -1346,6 +1346,17 @@ GC_CheckEngine::startNewCheck(GC_Check *check)
 	clearPreviousObjects();
 }
 
+void
+GC_CheckEngine::startWorkerCheck(GC_CheckCycle *checkCycle, GC_Check *check)
+{
+	_cycle = checkCycle;
+	_currentCheck = check;
+	clearPreviousObjects();
+	clearRegionDescription(&_regionDesc);
+	clearCheckedCache();
+	_ownableSynchronizerObjectCountOnHeap = 0;
+}
+
 /**
  * Ensure the GC internal scope pointers refer to objects within the scope.
  *
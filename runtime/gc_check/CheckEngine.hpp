@@ -132,6 +132,12 @@ public:
 	bool verifyOwnableSynchronizerObjectCounts();
 	MMINLINE void initializeOwnableSynchronizerCountOnList() { _ownableSynchronizerObjectCountOnList = 0; };
 	MMINLINE void initializeOwnableSynchronizerCountOnHeap() { _ownableSynchronizerObjectCountOnHeap = 0; };
+	MMINLINE UDATA getOwnableSynchronizerCountOnHeap() { return _ownableSynchronizerObjectCountOnHeap; };
+	MMINLINE void addOwnableSynchronizerCountOnHeap(UDATA count) { _ownableSynchronizerObjectCountOnHeap += count; };
+	/**
+	 * Forget the heap count so that it is not compared against the lists (used when only part of the heap was walked).
+	 */
+	MMINLINE void clearOwnableSynchronizerCountOnHeap() { _ownableSynchronizerObjectCountOnHeap = UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER; };
 
 	UDATA checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *objectDesc, J9MM_IterateRegionDescriptor *regionDesc);
 	UDATA checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9object_t *objectIndirect, J9MM_IterateRegionDescriptor *regionDesc, J9Object *objectIndirectBase);
@@ -161,6 +167,15 @@ public:
 	void startCheckCycle(J9JavaVM *javaVM, GC_CheckCycle *checkCycle);
 	void endCheckCycle(J9JavaVM *javaVM);
 	void startNewCheck(GC_Check *check);	
+
+	/**
+	 * Prepare this engine to verify part of the object heap on behalf of another engine.
+	 * Unlike startCheckCycle() this does not report a heap walk, since the owning engine already has.
+	 * @param checkCycle the cycle the owning engine is running
+	 * @param check the check the owning engine is running
+	 */
+	void startWorkerCheck(GC_CheckCycle *checkCycle, GC_Check *check);
+	MMINLINE GC_CheckCycle *getCycle() { return _cycle; };
 	bool isStackDumpAlwaysDisplayed();
 	void copyRegionDescription(J9MM_IterateRegionDescriptor* from, J9MM_IterateRegionDescriptor* to);
 	void clearRegionDescription(J9MM_IterateRegionDescriptor* toClear);
@@ -171,6 +186,7 @@ public:
 	 * @param count the maximum number of errors to report
 	 */
 	MMINLINE void setMaxErrorsToReport(UDATA count) { _reporter->setMaxErrorsToReport(count); };
+	MMINLINE UDATA getMaxErrorsToReport() { return _reporter->getMaxErrorsToReport(); };
 	
 	GC_CheckEngine(J9JavaVM *javaVM, GC_CheckReporter *reporter)
 		: MM_Base()
@@ -20,10 +20,19 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
+
+#include "CheckCycle.hpp"
 #include "CheckEngine.hpp"
 #include "CheckObjectHeap.hpp"
+#include "CheckReporterTTY.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptor.hpp"
 #include "MemorySubSpace.hpp"
 #include "ModronTypes.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
+#include "ParallelTask.hpp"
 #include "ScanFormatter.hpp"
 #include "HeapIteratorAPI.h"
 
@@ -45,6 +54,48 @@ static jvmtiIterationControl check_spaceIteratorCallback(J9JavaVM* vm, J9MM_Iter
 static jvmtiIterationControl check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData);
 static jvmtiIterationControl check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData);
 
+/**
+ * Verifies the object heap work units on the GC threads, with one engine (and so one reporter) per thread.
+ */
+class GC_CheckObjectHeapTask : public MM_ParallelTask
+{
+	/* Data Members */
+private:
+	J9JavaVM *_javaVM;
+	GC_CheckEngine **_engines; /**< Engines indexed by GC thread ID */
+	GC_CheckObjectHeapSlice *_slice; /**< Units to verify */
+	UDATA _vmState; /**< The VM state of the thread which requested the check */
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	virtual UDATA getVMStateID(void) { return _vmState; }
+	virtual void run(MM_EnvironmentBase *env);
+
+	GC_CheckObjectHeapTask(J9JavaVM *javaVM, MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, GC_CheckEngine **engines, GC_CheckObjectHeapSlice *slice)
+		: MM_ParallelTask(env, dispatcher)
+		, _javaVM(javaVM)
+		, _engines(engines)
+		, _slice(slice)
+		, _vmState(env->getOmrVMThread()->vmState)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+void
+GC_CheckObjectHeapTask::run(MM_EnvironmentBase *env)
+{
+	GC_CheckEngine *engine = _engines[env->getSlaveID()];
+	GC_HeapWorkUnit unit;
+	while (GC_CheckObjectHeap::claimWorkUnit(_slice, &unit)) {
+		GC_CheckObjectHeap::checkWorkUnit(_javaVM, engine, &unit);
+	}
+}
+
 GC_Check *
 GC_CheckObjectHeap::newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine)
 {
@@ -66,6 +117,74 @@ GC_CheckObjectHeap::kill()
 
 void
 GC_CheckObjectHeap::check()
+{
+	GC_CheckCycle *cycle = _engine->getCycle();
+	UDATA miscFlags = cycle->getMiscFlags();
+	/* the incremental cursor lives in the running VM, so it can't be used from the debugger extensions */
+	bool incremental = (J9MODRON_GCCHK_MISC_INCREMENTAL == (miscFlags & J9MODRON_GCCHK_MISC_INCREMENTAL)) && (invocation_debugger != cycle->getInvoker());
+	bool parallel = (J9MODRON_GCCHK_MISC_PARALLEL == (miscFlags & J9MODRON_GCCHK_MISC_PARALLEL)) && isParallelCheckPossible();
+
+	if (!incremental && !parallel) {
+		checkAllRegions();
+		return;
+	}
+
+	GCCHK_Extensions *gcchkExtensions = (GCCHK_Extensions *)_extensions->gcchkExtensions;
+	GC_HeapWorkUnitIterator iterator(_javaVM, WORK_UNIT_SIZE);
+	if (!iterator.initialize()) {
+		/* not enough memory to describe the heap in pieces -- fall back to a full walk */
+		iterator.tearDown();
+		checkAllRegions();
+		return;
+	}
+
+	GC_CheckObjectHeapSlice slice;
+	slice.iterator = &iterator;
+	slice.bytesRemaining = UDATA_MAX;
+	slice.mutex = NULL;
+	if (incremental) {
+		/* only the units of this slice are split, starting from where the previous slice stopped */
+		iterator.resumeAt(gcchkExtensions->incrementalCursor, isIncrementalCursorAtObject());
+		slice.bytesRemaining = gcchkExtensions->incrementalSliceSize;
+		if (J9MODRON_GCCHK_VERBOSE == (miscFlags & J9MODRON_GCCHK_VERBOSE)) {
+			PORT_ACCESS_FROM_PORT(_portLibrary);
+			j9tty_printf(PORTLIB, "  <gc check: verifying object heap slice from %p>\n", iterator.getPosition());
+		}
+	}
+
+	if (!parallel || !checkInParallel(&slice)) {
+		GC_HeapWorkUnit unit;
+		while (claimWorkUnit(&slice, &unit)) {
+			checkWorkUnit(_javaVM, _engine, &unit);
+		}
+	}
+
+	if (incremental) {
+		/* wrap to the bottom of the heap once the top has been reached */
+		gcchkExtensions->incrementalCursor = iterator.getPosition();
+		gcchkExtensions->incrementalCursorGcCount = gcchkExtensions->globalGcCount;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+		gcchkExtensions->incrementalCursorGcCount += gcchkExtensions->localGcCount;
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+		switch (cycle->getInvoker()) {
+		case invocation_global_end:
+		case invocation_local_end:
+			gcchkExtensions->incrementalCursorSavedAfterGc = true;
+			break;
+		default:
+			gcchkExtensions->incrementalCursorSavedAfterGc = false;
+			break;
+		}
+
+		/* only part of the heap was seen, so the heap count can't be compared against the lists */
+		_engine->clearOwnableSynchronizerCountOnHeap();
+	}
+
+	iterator.tearDown();
+}
+
+void
+GC_CheckObjectHeap::checkAllRegions()
 {
 	/* Check by using the HeapIteratorAPI */
 	ObjectIteratorCallbackUserData userData;
@@ -75,6 +194,171 @@ GC_CheckObjectHeap::check()
 	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
 }
 
+bool
+GC_CheckObjectHeap::isParallelCheckPossible()
+{
+	switch (_engine->getCycle()->getInvoker()) {
+	case invocation_global_start:
+	case invocation_global_end:
+	case invocation_local_start:
+	case invocation_local_end:
+		break;
+	default:
+		/* manual and debugger invocations don't own the GC threads */
+		return false;
+	}
+
+	/* metronome hooks run inside a time slice, where the dispatcher can't be borrowed */
+	if (_extensions->isMetronomeGC()) {
+		return false;
+	}
+
+	return (NULL != _extensions->dispatcher) && (1 < _extensions->dispatcher->threadCountMaximum());
+}
+
+bool
+GC_CheckObjectHeap::isIncrementalCursorAtObject()
+{
+	GCCHK_Extensions *gcchkExtensions = (GCCHK_Extensions *)_extensions->gcchkExtensions;
+	UDATA gcCount = gcchkExtensions->globalGcCount;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	gcCount += gcchkExtensions->localGcCount;
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+
+	if ((NULL == gcchkExtensions->incrementalCursor) || !gcchkExtensions->incrementalCursorSavedAfterGc) {
+		return false;
+	}
+
+	switch (_engine->getCycle()->getInvoker()) {
+	case invocation_global_start:
+	case invocation_local_start:
+		/* the collection about to run was counted when it started */
+		return (gcCount == (gcchkExtensions->incrementalCursorGcCount + 1));
+	case invocation_manual:
+		return (gcCount == gcchkExtensions->incrementalCursorGcCount);
+	default:
+		return false;
+	}
+}
+
+bool
+GC_CheckObjectHeap::checkInParallel(GC_CheckObjectHeapSlice *slice)
+{
+	MM_Forge *forge = _extensions->getForge();
+	MM_Dispatcher *dispatcher = _extensions->dispatcher;
+	UDATA threadCount = dispatcher->threadCountMaximum();
+	bool result = true;
+
+	GC_CheckEngine **engines = (GC_CheckEngine **)forge->allocate(sizeof(GC_CheckEngine *) * threadCount, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == engines) {
+		return false;
+	}
+	memset(engines, 0, sizeof(GC_CheckEngine *) * threadCount);
+
+	/* each thread reports through its own engine, so no checking state is shared between them */
+	for (UDATA i = 0; result && (i < threadCount); i++) {
+		GC_CheckReporter *reporter = GC_CheckReporterTTY::newInstance(_javaVM);
+		if (NULL == reporter) {
+			result = false;
+		} else {
+			reporter->setMaxErrorsToReport(_engine->getMaxErrorsToReport());
+			engines[i] = GC_CheckEngine::newInstance(_javaVM, reporter);
+			if (NULL == engines[i]) {
+				reporter->kill();
+				result = false;
+			} else {
+				engines[i]->startWorkerCheck(_engine->getCycle(), this);
+			}
+		}
+	}
+
+	if (result && (0 != omrthread_monitor_init_with_name(&slice->mutex, 0, "GC check object heap slice"))) {
+		slice->mutex = NULL;
+		result = false;
+	}
+
+	if (result) {
+		J9VMThread *vmThread = _javaVM->internalVMFunctions->currentVMThread(_javaVM);
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+		GC_CheckObjectHeapTask checkTask(_javaVM, env, dispatcher, engines, slice);
+		dispatcher->run(env, &checkTask);
+		omrthread_monitor_destroy(slice->mutex);
+		slice->mutex = NULL;
+
+		for (UDATA i = 0; i < threadCount; i++) {
+			_engine->addOwnableSynchronizerCountOnHeap(engines[i]->getOwnableSynchronizerCountOnHeap());
+		}
+	}
+
+	for (UDATA i = 0; i < threadCount; i++) {
+		if (NULL != engines[i]) {
+			engines[i]->kill();
+		}
+	}
+	forge->free(engines);
+
+	return result;
+}
+
+bool
+GC_CheckObjectHeap::claimWorkUnit(GC_CheckObjectHeapSlice *slice, GC_HeapWorkUnit *unit)
+{
+	bool claimed = false;
+
+	if (NULL != slice->mutex) {
+		omrthread_monitor_enter(slice->mutex);
+	}
+	if (0 != slice->bytesRemaining) {
+		claimed = slice->iterator->nextUnit(unit);
+		if (claimed) {
+			UDATA unitSize = (UDATA)unit->top - (UDATA)unit->base;
+			slice->bytesRemaining -= OMR_MIN(unitSize, slice->bytesRemaining);
+		}
+	}
+	if (NULL != slice->mutex) {
+		omrthread_monitor_exit(slice->mutex);
+	}
+
+	return claimed;
+}
+
+void
+GC_CheckObjectHeap::checkWorkUnit(J9JavaVM *javaVM, GC_CheckEngine *engine, GC_HeapWorkUnit *unit)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	MM_HeapRegionDescriptor *heapRegion = (MM_HeapRegionDescriptor *)unit->regionDesc.id;
+	GC_ObjectHeapBufferedIterator objectHeapIterator(extensions, heapRegion, unit->base, unit->top, true, 1);
+	J9Object *object = NULL;
+
+	/* mirror the j9mm_iterate_region_objects walk with j9mm_iterator_flag_include_holes, restricted to the unit */
+	engine->clearPreviousObjects();
+	while (NULL != (object = objectHeapIterator.nextObject())) {
+		J9MM_IterateObjectDescriptor objectDesc;
+		if (extensions->objectModel.isDeadObject(object)) {
+			objectDesc.id = (UDATA)object;
+			objectDesc.object = object;
+			objectDesc.size = extensions->objectModel.getSizeInBytesDeadObject(object);
+			objectDesc.isObject = FALSE;
+		} else {
+			javaVM->memoryManagerFunctions->j9mm_initialize_object_descriptor(javaVM, &objectDesc, object);
+			if (0 != (J9CLASS_FLAGS(J9GC_J9OBJECT_CLAZZ_VM(object, javaVM)) & J9AccClassDying)) {
+				/* this object is not marked as a hole, but its class has been partially unloaded so it's treated like a hole here */
+				objectDesc.isObject = FALSE;
+			}
+#if defined(J9VM_GC_SEGREGATED_HEAP)
+			else if (extensions->isSegregatedHeap() && (objectDesc.size < unit->regionDesc.objectMinimumSize)) {
+				objectDesc.size = unit->regionDesc.objectMinimumSize;
+			}
+#endif /* J9VM_GC_SEGREGATED_HEAP */
+		}
+
+		if (J9MODRON_SLOT_ITERATOR_OK != engine->checkObjectHeap(javaVM, &objectDesc, &unit->regionDesc)) {
+			break;
+		}
+		engine->pushPreviousObject(object);
+	}
+}
+
 void
 GC_CheckObjectHeap::print()
 {
@@ -32,6 +32,17 @@
 #include "j9cfg.h"
 
 #include "Check.hpp"
+#include "HeapWorkUnitIterator.hpp"
+
+/**
+ * The units verified by one invocation of the parallel or incremental object heap check.
+ * Units are claimed one at a time, until the heap or the byte budget of the slice runs out.
+ */
+typedef struct GC_CheckObjectHeapSlice {
+	GC_HeapWorkUnitIterator *iterator; /**< Hands out the units, splitting regions as they are claimed */
+	UDATA bytesRemaining; /**< Bytes which may still be claimed (UDATA_MAX for a full check) */
+	omrthread_monitor_t mutex; /**< Serializes claims by the GC threads (NULL when only the current thread claims units) */
+} GC_CheckObjectHeapSlice;
 
 /**
  * 
@@ -42,10 +53,53 @@ private:
 	virtual void check(); /**< run the check */
 	virtual void print(); /**< dump the check structure to tty */
 
+	/**
+	 * Verify every object of every region with a single walk on the current thread.
+	 */
+	void checkAllRegions();
+
+	/**
+	 * Determine whether the check may be distributed over the GC threads.  This is only
+	 * possible in-process, from a GC hook on the master thread, with a dispatcher that
+	 * has more than one thread.
+	 */
+	bool isParallelCheckPossible();
+
+	/**
+	 * Determine whether the saved incremental cursor is still the start of an object (or of a hole).
+	 * The cursor is saved at an object boundary, but only the mutator (which neither moves nor frees
+	 * objects) is known to have run since it was saved if it was saved after a collection and no
+	 * collection has started since, other than the one this invocation is checking before.
+	 */
+	bool isIncrementalCursorAtObject();
+
+	/**
+	 * Verify the units of the slice using one engine per GC thread.
+	 * @return false if the worker engines could not be created, in which case nothing was checked
+	 */
+	bool checkInParallel(GC_CheckObjectHeapSlice *slice);
+
 public:
+	enum { WORK_UNIT_SIZE = 4 * 1024 * 1024 }; /**< Regions larger than this are split at object boundaries into units of about this size */
+
 	static GC_Check *newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine);
 	virtual void kill();
 
+	/**
+	 * Claim the next unit of a slice.
+	 * @param slice the slice to claim from
+	 * @param[out] unit the unit claimed
+	 * @return false once the slice has been entirely claimed
+	 */
+	static bool claimWorkUnit(GC_CheckObjectHeapSlice *slice, GC_HeapWorkUnit *unit);
+
+	/**
+	 * Verify every object in the given unit.
+	 * @param engine the engine to verify and report with
+	 * @param unit the unit to verify
+	 */
+	static void checkWorkUnit(J9JavaVM *javaVM, GC_CheckEngine *engine, GC_HeapWorkUnit *unit);
+
 	virtual const char *getCheckName() { return "HEAP"; };
 
 	GC_CheckObjectHeap(J9JavaVM *javaVM, GC_CheckEngine *engine) :
@@ -393,7 +393,7 @@ MM_GlobalCollectorDelegate::postCollect(MM_EnvironmentBase* env, MM_MemorySubSpa
 	uintptr_t heapSize = heap->getActiveMemorySize(MEMORY_TYPE_OLD);
 	uintptr_t freeSize = heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD);
 	double percentFree = ((double)freeSize) / ((double)heapSize);
-	_extensions->dynamicMaxSoftReferenceAge = (uintptr_t)(percentFree * (double)(_extensions->maxSoftReferenceAge));
+	_extensions->updateDynamicMaxSoftReferenceAge(percentFree, &_extensions->markJavaStats._softReferenceAgeStats);
 	Assert_MM_true(_extensions->dynamicMaxSoftReferenceAge <= _extensions->maxSoftReferenceAge);
 }
 
@@ -467,6 +467,8 @@ MM_MarkingDelegate::processReferenceList(MM_EnvironmentBase *env, MM_HeapRegionD
 						/* Soft reference hasn't aged sufficiently yet - increment the age */
 						J9GC_J9VMJAVALANGSOFTREFERENCE_AGE(env, referenceObj) = age + 1;
 					}
+					/* remember how recently the referent was used, to pick the soft references cleared next */
+					env->getGCEnvironment()->_markJavaStats._softReferenceAgeStats.recordSurvivor(J9GC_J9VMJAVALANGSOFTREFERENCE_AGE(env, referenceObj), _extensions->getMaxSoftReferenceAge());
 				}
 			} else {
 				/* transition the state to cleared */
@@ -260,6 +260,26 @@ MM_ScavengerDelegate::internalGarbageCollect_shouldPercolateGarbageCollect(MM_En
 	return shouldPercolate;
 }
 
+void
+MM_ScavengerDelegate::private_copyHotFieldChildren(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, J9Class *clazzPtr)
+{
+	UDATA hotFieldDescription = clazzPtr->instanceHotFieldDescription;
+	/* bit 0 marks the class for hot field alignment rather than hot field copying */
+	if (0 == (hotFieldDescription & 1)) {
+		fj9object_t *scanPtr = _extensions->mixedObjectModel.getHeadlessObject(objectPtr);
+		UDATA hotBits = hotFieldDescription >> 1;
+		while (0 != hotBits) {
+			if (1 == (hotBits & 1)) {
+				/* the object scanner visits this slot again, finds the child already copied and does any remembering */
+				GC_SlotObject slotObject(env->getOmrVM(), scanPtr);
+				_extensions->scavenger->copyObjectSlot(env, &slotObject);
+			}
+			hotBits >>= 1;
+			scanPtr += 1;
+		}
+	}
+}
+
 GC_ObjectScanner *
 MM_ScavengerDelegate::getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, void *allocSpace, uintptr_t flags)
 {
@@ -274,8 +294,12 @@ MM_ScavengerDelegate::getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr
 	case GC_ObjectModel::SCAN_MIXED_OBJECT_LINKED:
 		_extensions->scavenger->deepScan(env, objectPtr, clazzPtr->selfReferencingField1, clazzPtr->selfReferencingField2);
 		/* Fall through and treat as mixed object (create mixed object scanner) */
-	case GC_ObjectModel::SCAN_ATOMIC_MARKABLE_REFERENCE_OBJECT:
 	case GC_ObjectModel::SCAN_MIXED_OBJECT:
+		if (_extensions->hotFieldCopying && (0 == clazzPtr->selfReferencingField1) && GC_ObjectScanner::isHeapScan(flags)) {
+			private_copyHotFieldChildren(env, objectPtr, clazzPtr);
+		}
+		/* Fall through and treat as mixed object (create mixed object scanner) */
+	case GC_ObjectModel::SCAN_ATOMIC_MARKABLE_REFERENCE_OBJECT:
 	case GC_ObjectModel::SCAN_CLASS_OBJECT:
 	case GC_ObjectModel::SCAN_CLASSLOADER_OBJECT:
 		objectScanner = GC_MixedObjectScanner::newInstance(env, objectPtr, allocSpace, flags);
@@ -105,6 +105,15 @@ private:
 	 */
 	bool private_shouldPercolateGarbageCollect_activeJNICriticalRegions(MM_EnvironmentBase *envBase);
 
+	/**
+	 * Copy the objects referenced from the JIT-marked hot fields of an object, so that they are
+	 * placed right after the object instead of in scan order (-Xgc:hotFieldCopying).
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] the object about to be scanned
+	 * @param clazzPtr[in] the class of objectPtr
+	 */
+	void private_copyHotFieldChildren(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, J9Class *clazzPtr);
+
 protected:
 public:
 	void masterSetupForGC(MM_EnvironmentBase *env);
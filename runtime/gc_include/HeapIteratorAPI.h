@@ -233,6 +233,37 @@ j9mm_iterate_regions(J9JavaVM *vm, J9PortLibrary *portLibrary, J9MM_IterateSpace
 jvmtiIterationControl
 j9mm_iterate_region_objects(J9JavaVM *vm, J9PortLibrary *portLibrary, J9MM_IterateRegionDescriptor *region, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData), void *userData);
 
+/**
+ * Answer the end of a unit of about unitSize bytes of the given region, starting at base, so that the
+ * region can be split into units walked independently with j9mm_iterate_region_range_objects.
+ * The unit ends at the first object at or above base + unitSize, or at the top of the region if there
+ * is none or the region can't be split (segregated regions can only be walked from their start).
+ *
+ * The caller must have exclusive VM access.
+ *
+ * @param region The descriptor for the region, or a copy of it
+ * @param base The start of the region, or the end of a previous unit
+ * @param unitSize The size of the units, in bytes
+ */
+void *
+j9mm_find_region_unit_top(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *base, UDATA unitSize);
+
+/**
+ * Walk the objects of the given region which start in [base, top), call user provided function.
+ * base must be an object boundary: the start of the region or the end of a unit answered by j9mm_find_region_unit_top.
+ *
+ * The caller must have exclusive VM access.
+ *
+ * @param region The descriptor for the region, or a copy of it
+ * @param base The first object to walk
+ * @param top The end of the range to walk
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor.
+ * @param userData Pointer to storage for userData.
+ */
+jvmtiIterationControl
+j9mm_iterate_region_range_objects(J9JavaVM *vm, J9PortLibrary *portLibrary, J9MM_IterateRegionDescriptor *region, void *base, void *top, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData), void *userData);
+
 /**
  * Walk all object slots for the given object, call user provided function.
  * @param object The descriptor for the object that should be walked
@@ -262,6 +293,30 @@ j9mm_initialize_object_descriptor(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor
 jvmtiIterationControl
 j9mm_iterate_all_objects(J9JavaVM *vn, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData), void *userData);
 
+/**
+ * Answer the number of threads j9mm_iterate_all_objects_parallel may call back on, and so the
+ * number of user data pointers it needs. Answers 1 if the heap can only be walked serially.
+ */
+UDATA
+j9mm_get_parallel_iteration_thread_count(J9JavaVM *vm);
+
+/**
+ * Walk all objects for the given VM on the GC threads, call user provided function.
+ *
+ * The caller must have exclusive VM access, and must not be a GC thread.
+ *
+ * The heap is split into units which are walked concurrently, so objects are not reported in
+ * address order and func may be running on several threads at once. Each thread passes its own
+ * entry of userData to func. Once func answers JVMTI_ITERATION_ABORT, the other threads stop
+ * after the unit they are walking.
+ *
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor.
+ * @param userData Array of j9mm_get_parallel_iteration_thread_count() user data pointers, one per thread.
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData), void **userData);
+
 /**
  * Walk all ownable synchronizer object, call user provided function.
  * @param flags The flags describing the walk (unused currently)
@@ -72,7 +72,11 @@ MM_ReferenceObjectBufferStandard::flushImpl(MM_EnvironmentBase* env)
 {
 	MM_HeapRegionDescriptorStandard *region = (MM_HeapRegionDescriptorStandard*)_region;
 	MM_HeapRegionDescriptorStandardExtension *regionExtension = MM_ConfigurationDelegate::getHeapRegionDescriptorStandardExtension(env, region);
-	MM_ReferenceObjectList *list = &regionExtension->_referenceObjectLists[_referenceObjectListIndex];
+	/* offset by the thread so that threads which flush only a few times do not all fill the first lists,
+	 * which are the units of work when the lists are processed in parallel
+	 */
+	UDATA listIndex = (_referenceObjectListIndex + env->getSlaveID()) % regionExtension->_maxListIndex;
+	MM_ReferenceObjectList *list = &regionExtension->_referenceObjectLists[listIndex];
 	list->addAll(env, _referenceObjectType, _head, _tail);
 	_referenceObjectListIndex += 1;
 	if (regionExtension->_maxListIndex == _referenceObjectListIndex) {
@@ -106,6 +106,7 @@
 #include "Validator.hpp"
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 #include "IdleGCManager.hpp"
+#include "MemoryPressureMonitor.hpp"
 #endif
 
 #if defined(J9ZOS39064)
@@ -491,6 +492,13 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 			}
 		}
 	}
+
+	if (extensions->memoryPressureMonitorEnabled) {
+		extensions->memoryPressureMonitor = MM_MemoryPressureMonitor::newInstance(&env);
+		if (NULL == extensions->memoryPressureMonitor) {
+			goto error_no_memory;
+		}
+	}
 #endif
 
 	return JNI_OK;
@@ -586,6 +594,23 @@ gcStartupHeapManagement(J9JavaVM *javaVM)
 		result = JNI_ENOMEM;
 	}
 
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	if ((JNI_OK == result) && extensions->concurrentClassUnloading && extensions->isStandardGC()) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		/* on failure (already reported) the collections keep freeing class segments themselves */
+		extensions->classLoaderManager->startUpClassUnloadingThread(&env);
+	}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	if ((JNI_OK == result) && (NULL != extensions->memoryPressureMonitor)) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		if (!extensions->memoryPressureMonitor->startUpThread(&env)) {
+			result = JNI_ENOMEM;
+		}
+	}
+#endif /* J9VM_GC_IDLE_HEAP_MANAGER */
+
 	if (JNI_OK != result) {
 		PORT_ACCESS_FROM_JAVAVM(javaVM);
 		extensions->getGlobalCollector()->collectorShutdown(extensions);
@@ -709,6 +734,20 @@ gcShutdownHeapManagement(J9JavaVM *javaVM)
 	j9gc_finalizer_shutdown(javaVM);
 #endif /* J9VM_GC_FINALIZATION */
 
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	if (NULL != extensions->classLoaderManager) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		extensions->classLoaderManager->shutDownClassUnloadingThread(&env);
+	}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	if (NULL != extensions->memoryPressureMonitor) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		extensions->memoryPressureMonitor->shutDownThread(&env);
+	}
+#endif /* J9VM_GC_IDLE_HEAP_MANAGER */
+
 	/* Kickoff shutdown of global collector */
 	if (NULL != globalCollector) {
 		globalCollector->collectorShutdown(extensions);
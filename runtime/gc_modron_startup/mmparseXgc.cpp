@@ -133,6 +133,34 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		extensions->synchronousGCOnOOM = false;
 		goto _exit;
 	}		
+	if (try_scan(scan_start, "dynamicTargetUtilization")) {
+		extensions->dynamicTargetUtilization = true;
+		goto _exit;
+	}
+	if (try_scan(scan_start, "noDynamicTargetUtilization")) {
+		extensions->dynamicTargetUtilization = false;
+		goto _exit;
+	}
+	if (try_scan(scan_start, "targetUtilizationMin=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &(extensions->targetUtilizationMinimumPercentage), "targetUtilizationMin=")) {
+			goto _error;
+		}
+		if ((extensions->targetUtilizationMinimumPercentage < 1) || (99 < extensions->targetUtilizationMinimumPercentage)) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "targetUtilizationMin=", (UDATA)1, (UDATA)99);
+			goto _error;
+		}
+		goto _exit;
+	}
+	if (try_scan(scan_start, "targetUtilizationMax=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &(extensions->targetUtilizationMaximumPercentage), "targetUtilizationMax=")) {
+			goto _error;
+		}
+		if ((extensions->targetUtilizationMaximumPercentage < 1) || (99 < extensions->targetUtilizationMaximumPercentage)) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "targetUtilizationMax=", (UDATA)1, (UDATA)99);
+			goto _error;
+		}
+		goto _exit;
+	}
 	if (try_scan(scan_start, "targetUtilization=")) {
 		if(!scan_udata_helper(javaVM, scan_start, &(extensions->targetUtilizationPercentage), "targetUtilization=")) {
 			goto _error;
@@ -162,6 +190,20 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		goto _exit;
 	}
 
+	if (try_scan(scan_start, "targetPausetimeMax=")) {
+		/* the unit of the maximum pause time option is in milliseconds */
+		UDATA beatMaximumMilli = 0;
+		if(!scan_udata_helper(javaVM, scan_start, &beatMaximumMilli, "targetPausetimeMax=")) {
+			goto _error;
+		}
+		if(0 == beatMaximumMilli) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "targetPausetimeMax=", (UDATA)0);
+			goto _error;
+		}
+		extensions->beatMaximumMicro = beatMaximumMilli * 1000;
+		goto _exit;
+	}
+
 	if (try_scan(scan_start, "targetPausetime=")) {
 		/* the unit of target pause time option is in milliseconds */
 		UDATA beatMilli = 0;
@@ -1083,6 +1125,16 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 			goto _exit;
 		}
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+		/* The memory pressure monitor reports this many samples as under pressure, then samples the memory as usual */
+		if (try_scan(scan_start, "forceMemoryPressure=")) {
+			if(!scan_udata_helper(javaVM, scan_start, &extensions->fvtest_forceMemoryPressureSamples, "forceMemoryPressure=")) {
+				goto _error;
+			}
+			goto _exit;
+		}
+#endif /* J9VM_GC_IDLE_HEAP_MANAGER */
+
 		/* test option not recognised */
 		j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTION_FVTEST_UNKNOWN_TYPE, *scan_start);
 		goto _error;
@@ -1122,9 +1174,52 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		extensions->scavengerScanOrdering = MM_GCExtensions::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
 		goto _exit;
 	}
+
+	if(try_scan(scan_start, "hotFieldCopying")) {
+		extensions->hotFieldCopying = true;
+		goto _exit;
+	}
+
+	if(try_scan(scan_start, "noHotFieldCopying")) {
+		extensions->hotFieldCopying = false;
+		goto _exit;
+	}
+
+	if(try_scan(scan_start, "hotFieldCopyDepth=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &extensions->hotFieldCopyDepth, "hotFieldCopyDepth=")) {
+			goto _error;
+		}
+		if(0 == extensions->hotFieldCopyDepth) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "hotFieldCopyDepth=", (UDATA)0);
+			goto _error;
+		}
+		goto _exit;
+	}
 		
 #endif /* J9VM_GC_MODRON_SCAVENGER */
 
+	/* must be scanned before softReferenceLRU, which is a prefix of it */
+	if(try_scan(scan_start, "softReferenceLRUClearPercentage=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &extensions->softReferenceLRUClearPercentage, "softReferenceLRUClearPercentage=")) {
+			goto _error;
+		}
+		if((0 == extensions->softReferenceLRUClearPercentage) || (100 < extensions->softReferenceLRUClearPercentage)) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "softReferenceLRUClearPercentage=", (UDATA)1, (UDATA)100);
+			goto _error;
+		}
+		goto _exit;
+	}
+
+	if(try_scan(scan_start, "softReferenceLRU")) {
+		extensions->softReferenceLRU = true;
+		goto _exit;
+	}
+
+	if(try_scan(scan_start, "noSoftReferenceLRU")) {
+		extensions->softReferenceLRU = false;
+		goto _exit;
+	}
+
 	if(try_scan(scan_start, "alwaysCallWriteBarrier")) {
 		extensions->alwaysCallWriteBarrier = true;
 		goto _exit;
@@ -1358,8 +1453,91 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+
+		if (try_scan(&scan_start, "concurrentClassUnloading")) {
+			extensions->concurrentClassUnloading = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noConcurrentClassUnloading")) {
+			extensions->concurrentClassUnloading = false;
+			continue;
+		}
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+		if (try_scan(&scan_start, "memoryPressureMonitor")) {
+			extensions->memoryPressureMonitorEnabled = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noMemoryPressureMonitor")) {
+			extensions->memoryPressureMonitorEnabled = false;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "memoryPressureThreshold=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->memoryPressureThreshold, "memoryPressureThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if ((0 == extensions->memoryPressureThreshold) || (100 < extensions->memoryPressureThreshold)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "memoryPressureThreshold=", (UDATA)1, (UDATA)100);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "memoryPressureStallThreshold=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->memoryPressureStallThreshold, "memoryPressureStallThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if ((0 == extensions->memoryPressureStallThreshold) || (100 < extensions->memoryPressureStallThreshold)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "memoryPressureStallThreshold=", (UDATA)1, (UDATA)100);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "memoryPressureCheckInterval=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->memoryPressureCheckInterval, "memoryPressureCheckInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (0 == extensions->memoryPressureCheckInterval) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "memoryPressureCheckInterval=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "memoryPressureMinimumReliefInterval=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->memoryPressureMinimumReliefInterval, "memoryPressureMinimumReliefInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "memoryPressureMaximumContraction=")) {
+			UDATA percentage = 0;
+			if (!scan_udata_helper(vm, &scan_start, &percentage, "memoryPressureMaximumContraction=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if ((0 == percentage) || (100 < percentage)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "memoryPressureMaximumContraction=", (UDATA)1, (UDATA)100);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			extensions->memoryPressureMaximumContraction = ((double)percentage) / 100.0;
+			continue;
+		}
+#endif /* J9VM_GC_IDLE_HEAP_MANAGER */
 
 		if (try_scan(&scan_start, "allocationSamplingGranularity=")) {
 			if ( !scan_udata_memory_size_helper(vm, &scan_start, &extensions->oolObjectSamplingBytesGranularity, "allocationSamplingGranularity=")) {
@@ -1470,8 +1648,44 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "jniCriticalPinning")) {
+			extensions->jniCriticalRegionPinning = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "noJNICriticalPinning")) {
+			extensions->jniCriticalRegionPinning = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "noAdaptiveThreadCount")) {
+			extensions->adaptiveThreadCount = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "adaptiveThreadCountBytesPerThread=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &extensions->adaptiveThreadCountBytesPerThread, "adaptiveThreadCountBytesPerThread=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->adaptiveThreadCountBytesPerThread) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "adaptiveThreadCountBytesPerThread=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "adaptiveThreadCount")) {
+			extensions->adaptiveThreadCount = true;
+			continue;
+		}
 #endif /* defined (J9VM_GC_VLHGC) */
 
+		if (try_scan(&scan_start, "verboseBinaryRingSize=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &extensions->verboseBinaryRingSize, "verboseBinaryRingSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
 		if (try_scan(&scan_start, "verboseFormat=")) {
 			if (try_scan(&scan_start, "default")) {
 				extensions->verboseNewFormat = true;
@@ -1481,6 +1695,12 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 				extensions->verboseNewFormat = false;
 				continue;
 			}
+			if (try_scan(&scan_start, "binary")) {
+				/* the binary ring stores the default format's output, so it implies that format */
+				extensions->verboseNewFormat = true;
+				extensions->verboseBinaryFormat = true;
+				continue;
+			}
 			/* verbose format not recognised J9NLS_GC_OPTION_UNKNOWN*/
 			/* j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTION_VERBOSEFORMAT_UNKNOWN_FORMAT, *scan_start); */
 			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTION_UNKNOWN, error_scan);
@@ -30,7 +30,7 @@
 #include "Dispatcher.hpp"
 #include "EnvironmentRealtime.hpp"
 #include "GCCode.hpp"
-#include "GCExtensionsBase.hpp"
+#include "GCExtensions.hpp"
 #include "Heap.hpp"
 #include "IncrementalParallelTask.hpp"
 #include "MemoryPoolSegregated.hpp"
@@ -42,6 +42,7 @@
 #include "OSInterface.hpp"
 #include "Scheduler.hpp"
 #include "Timer.hpp"
+#include "UtilizationController.hpp"
 #include "UtilizationTracker.hpp"
 
 /**
@@ -89,6 +90,9 @@ MM_Scheduler::tearDown(MM_EnvironmentBase *env)
 		env->getForge()->free(_threadResumedTable);
 		_threadResumedTable = NULL;
 	}
+	if (NULL != _utilController) {
+		_utilController->kill(env);
+	}
 	if (NULL != _utilTracker) {
 		_utilTracker->kill(env);
 	}
@@ -146,6 +150,13 @@ MM_Scheduler::getParameter(uintptr_t which, char *keyBuffer, I_32 keyBufferSize,
 			omrstr_printf(keyBuffer, keyBufferSize, "Regionsize");
 			omrstr_printf(valueBuffer, valueBufferSize, "%d", _extensions->regionSize);
 			return 1;
+		case 10:
+			if (NULL == _utilController) {
+				return 2;
+			}
+			omrstr_printf(keyBuffer, keyBufferSize, "Dynamic Target Utilization");
+			omrstr_printf(valueBuffer, valueBufferSize, "%4.1f%% - %4.1f%%", _utilController->getMinimumTargetUtilization() * 1.0e2, _utilController->getMaximumTargetUtilization() * 1.0e2);
+			return 1;
 	}
 	return 0;
 }
@@ -193,6 +204,13 @@ MM_Scheduler::initialize(MM_EnvironmentBase *env)
 	if (NULL == _utilTracker) {
 		goto error_no_memory;
 	}
+	/* a zero target utilization simulates a stop-the-world collector, which has nothing to adjust */
+	if (MM_GCExtensions::getExtensions(_extensions)->dynamicTargetUtilization && (0 != _extensions->targetUtilizationPercentage)) {
+		_utilController = MM_UtilizationController::newInstance(env, _utilTracker);
+		if (NULL == _utilController) {
+			goto error_no_memory;
+		}
+	}
 
 	
 	/* Set up the table used for keeping track of which threads were resumed from suspended */
@@ -520,6 +538,10 @@ MM_Scheduler::reportStartGCIncrement(MM_EnvironmentRealtime *env)
 	_gc->reportGCStart(env);
 	TRIGGER_J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_START(_extensions->privateHookInterface, env->getOmrVMThread(), omrtime_hires_clock(), J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_START, _extensions->globalGCStats.metronomeStats._microsToStopMutators);
 
+	if (NULL != _utilController) {
+		_utilController->reportIncrementStart(env, _completeCurrentGCSynchronously);
+	}
+
 	_currentConsecutiveBeats = 1;
 	startGCTime(env, false);
 
@@ -533,6 +555,10 @@ MM_Scheduler::reportStopGCIncrement(MM_EnvironmentRealtime *env, bool isCycleEnd
 
 	stopGCTime(env);
 
+	if (NULL != _utilController) {
+		_utilController->reportIncrementEnd(env, isCycleEnd);
+	}
+
 	/* This can not be combined with the reportGCCycleEnd below as it has to happen before
 	 * the incrementEnd event is triggered.
 	 */
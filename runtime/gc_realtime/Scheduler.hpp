@@ -46,6 +46,7 @@ class MM_Metronome;
 class MM_RealtimeGC;
 class MM_MetronomeAlarmThread;
 class MM_Timer;
+class MM_UtilizationController;
 class MM_UtilizationTracker;
 
 #define METRONOME_GC_ON 1
@@ -129,6 +130,7 @@ public:
 	double _staticTargetUtilization;
 
 	MM_UtilizationTracker* _utilTracker;
+	MM_UtilizationController* _utilController; /**< adjusts the target utilization of _utilTracker (NULL unless -Xgc:dynamicTargetUtilization) */
 
 	/*
 	 * Function members
@@ -271,7 +273,8 @@ public:
 		beat(),
 		beatNanos(),
 		_staticTargetUtilization(),
-		_utilTracker(NULL)
+		_utilTracker(NULL),
+		_utilController(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -0,0 +1,217 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrcfg.h"
+
+#include "EnvironmentRealtime.hpp"
+#include "GCExtensions.hpp"
+#include "Heap.hpp"
+#include "Timer.hpp"
+#include "UtilizationTracker.hpp"
+
+#include "UtilizationController.hpp"
+
+/* Plan the rest of a cycle to use at most this fraction of the free memory */
+#define UTILIZATION_CONTROLLER_SAFETY_MARGIN 0.8
+/* Lower the target at once when the GC falls behind, but raise it by at most this much per increment */
+#define UTILIZATION_CONTROLLER_RAISE_STEP 0.01
+/* Weight of the newest sample in the smoothed allocation rate */
+#define UTILIZATION_CONTROLLER_RATE_WEIGHT 0.25
+
+/**
+ * Create a new instance of the UtilizationController class.
+ */
+MM_UtilizationController *
+MM_UtilizationController::newInstance(MM_EnvironmentBase *env, MM_UtilizationTracker *utilTracker)
+{
+	MM_UtilizationController *controller = (MM_UtilizationController *)env->getForge()->allocate(sizeof(MM_UtilizationController), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != controller) {
+		new(controller) MM_UtilizationController(env, utilTracker);
+		if (!controller->initialize(env)) {
+			controller->kill(env);
+			controller = NULL;
+		}
+	}
+	return controller;
+}
+
+/**
+ * Kill an instance of the UtilizationController class.
+ */
+void
+MM_UtilizationController::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+/**
+ * Derive the bounds of the target utilization and of the GC quantum from the command line.
+ * Unset bounds default to half the target utilization and to the beat size respectively.
+ */
+bool
+MM_UtilizationController::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(_extensions);
+	double staticTargetUtilization = _utilTracker->getTargetUtilization();
+
+	_maximumTargetUtilization = staticTargetUtilization;
+	if (0 != extensions->targetUtilizationMaximumPercentage) {
+		_maximumTargetUtilization = extensions->targetUtilizationMaximumPercentage / 1e2;
+	}
+	_minimumTargetUtilization = staticTargetUtilization / 2;
+	if (0 != extensions->targetUtilizationMinimumPercentage) {
+		_minimumTargetUtilization = extensions->targetUtilizationMinimumPercentage / 1e2;
+	}
+	if (_minimumTargetUtilization > _maximumTargetUtilization) {
+		_minimumTargetUtilization = _maximumTargetUtilization;
+	}
+
+	_minimumGCSliceNanos = _utilTracker->getMaxGCSlice();
+	_maximumGCSliceNanos = _minimumGCSliceNanos;
+	if (0 != extensions->beatMaximumMicro) {
+		_maximumGCSliceNanos = OMR_MAX(_minimumGCSliceNanos, (U_64)extensions->beatMaximumMicro * 1000);
+	}
+
+	return true;
+}
+
+void
+MM_UtilizationController::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+void
+MM_UtilizationController::reportIncrementStart(MM_EnvironmentRealtime *env, bool isSynchronous)
+{
+	U_64 now = env->getTimer()->getTimeInNanos();
+	uintptr_t freeMemory = _extensions->heap->getApproximateActiveFreeMemorySize();
+	_incrementStartTimeInNanos = now;
+
+	/* only the mutators run between two increments, so the drop in free memory is what they allocated */
+	if ((0 != _incrementEndTimeInNanos) && (now > _incrementEndTimeInNanos)) {
+		uintptr_t allocated = 0;
+		if (_freeMemoryAtIncrementEnd > freeMemory) {
+			allocated = _freeMemoryAtIncrementEnd - freeMemory;
+		}
+		double rate = allocated / ((now - _incrementEndTimeInNanos) / 1e9);
+		if (0.0 == _allocationRate) {
+			_allocationRate = rate;
+		} else {
+			_allocationRate += (rate - _allocationRate) * UTILIZATION_CONTROLLER_RATE_WEIGHT;
+		}
+	}
+
+	double previousTarget = _utilTracker->getTargetUtilization();
+	U_64 previousSlice = _utilTracker->getMaxGCSlice();
+	U_64 remainingWorkNanos = 0;
+	UDATA decision = DECISION_NO_DATA;
+	if (isSynchronous) {
+		/* the GC fell behind anyway: start the next cycle from the most conservative settings */
+		_utilTracker->setTargetUtilization(_minimumTargetUtilization);
+		_utilTracker->setMaxGCSlice(_maximumGCSliceNanos);
+		_synchronousFallbackCount += 1;
+		decision = DECISION_SYNCHRONOUS;
+	} else if ((0 != _previousCycleGCTimeInNanos) && (0.0 != _allocationRate)) {
+		/* there is nothing to base a decision on until a cycle has completed and the mutators have allocated */
+		remainingWorkNanos = adjust(env, freeMemory);
+		decision = DECISION_ADJUSTED;
+	}
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	TRIGGER_J9HOOK_MM_UTILIZATION_CONTROLLER_DECISION(
+		MM_GCExtensions::getExtensions(_extensions)->hookInterface,
+		(J9VMThread *)env->getLanguageVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_UTILIZATION_CONTROLLER_DECISION,
+		decision,
+		(UDATA)(previousTarget * 100),
+		(UDATA)(_utilTracker->getTargetUtilization() * 100),
+		(UDATA)(_safeUtilization * 100),
+		previousSlice / 1000,
+		_utilTracker->getMaxGCSlice() / 1000,
+		(U_64)_allocationRate,
+		freeMemory,
+		remainingWorkNanos / 1000);
+}
+
+/**
+ * Pick the target utilization and GC quantum for the next increment.
+ *
+ * At utilization u the mutators allocate u * rate bytes per second and the GC progresses by (1 - u)
+ * seconds per second, so the remaining work W completes before the usable free memory S runs out when
+ * W / (1 - u) <= S / (u * rate), that is when u <= S / (W * rate + S).
+ *
+ * @return the estimate of the remaining GC work W of the cycle, in nanoseconds
+ */
+U_64
+MM_UtilizationController::adjust(MM_EnvironmentRealtime *env, uintptr_t freeMemory)
+{
+	double remainingWork = 0.0;
+	if (_previousCycleGCTimeInNanos > _cycleGCTimeInNanos) {
+		remainingWork = (_previousCycleGCTimeInNanos - _cycleGCTimeInNanos) / 1e9;
+	}
+	/* the cycle may take longer than the last one: always allow for at least one more quantum */
+	remainingWork = OMR_MAX(remainingWork, _utilTracker->getMaxGCSlice() / 1e9);
+
+	double usableFreeMemory = freeMemory * UTILIZATION_CONTROLLER_SAFETY_MARGIN;
+	double safeUtilization = usableFreeMemory / ((remainingWork * _allocationRate) + usableFreeMemory);
+
+	double currentTarget = _utilTracker->getTargetUtilization();
+	double newTarget = OMR_MIN(OMR_MAX(safeUtilization, _minimumTargetUtilization), _maximumTargetUtilization);
+	if (newTarget > currentTarget) {
+		newTarget = OMR_MIN(newTarget, currentTarget + UTILIZATION_CONTROLLER_RAISE_STEP);
+	}
+
+	/* longer quanta lower the switching overhead once the utilization can not be lowered any further */
+	U_64 currentSlice = _utilTracker->getMaxGCSlice();
+	U_64 newSlice = currentSlice;
+	if (safeUtilization < _minimumTargetUtilization) {
+		newSlice = OMR_MIN(currentSlice * 2, _maximumGCSliceNanos);
+	} else if (safeUtilization > newTarget) {
+		newSlice = OMR_MAX(currentSlice / 2, _minimumGCSliceNanos);
+	}
+
+	_utilTracker->setTargetUtilization(newTarget);
+	_utilTracker->setMaxGCSlice(newSlice);
+	_safeUtilization = safeUtilization;
+
+	return (U_64)(remainingWork * 1e9);
+}
+
+void
+MM_UtilizationController::reportIncrementEnd(MM_EnvironmentRealtime *env, bool isCycleEnd)
+{
+	U_64 now = env->getTimer()->getTimeInNanos();
+	if (now > _incrementStartTimeInNanos) {
+		_cycleGCTimeInNanos += now - _incrementStartTimeInNanos;
+	}
+
+	if (isCycleEnd) {
+		_previousCycleGCTimeInNanos = _cycleGCTimeInNanos;
+		_cycleGCTimeInNanos = 0;
+	}
+
+	_freeMemoryAtIncrementEnd = _extensions->heap->getApproximateActiveFreeMemorySize();
+	_incrementEndTimeInNanos = env->getTimer()->getTimeInNanos();
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Metronome
+ */
+
+#if !defined(UTILIZATIONCONTROLLER_HPP_)
+#define UTILIZATIONCONTROLLER_HPP_
+
+#include "omr.h"
+#include "omrcfg.h"
+
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+class MM_EnvironmentRealtime;
+class MM_UtilizationTracker;
+
+/**
+ * Feedback controller for the Metronome scheduler (-Xgc:dynamicTargetUtilization).
+ *
+ * The allocation rate is measured from the drop in free memory while the mutators run between two
+ * GC increments, and the GC work of a cycle is estimated from the GC time of the previous cycle.
+ * At the start of each increment the controller picks the highest mutator utilization, within the
+ * user-set bounds, at which the rest of the cycle completes before the free memory is exhausted.
+ * When even the lowest bound is not enough, the GC quantum is grown up to its maximum, so that the
+ * cycle finishes without falling back to a synchronous collection.
+ *
+ * @note All methods are called by the master GC thread only.
+ * @ingroup GC_Metronome
+ */
+class MM_UtilizationController : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_GCExtensionsBase *_extensions;
+	MM_UtilizationTracker *_utilTracker; /**< the tracker whose target utilization and maximum GC slice are controlled */
+	double _minimumTargetUtilization; /**< lowest target utilization which may be chosen */
+	double _maximumTargetUtilization; /**< highest target utilization which may be chosen */
+	U_64 _minimumGCSliceNanos; /**< shortest GC quantum which may be chosen (the beat size) */
+	U_64 _maximumGCSliceNanos; /**< longest GC quantum which may be chosen */
+	double _allocationRate; /**< smoothed bytes allocated per second of mutator time (0 until first measured) */
+	uintptr_t _freeMemoryAtIncrementEnd; /**< free memory when the mutators were last restarted */
+	U_64 _incrementEndTimeInNanos; /**< time the mutators were last restarted (0 until the first increment ends) */
+	U_64 _incrementStartTimeInNanos; /**< time the current GC increment started */
+	U_64 _cycleGCTimeInNanos; /**< GC time spent so far in the current cycle */
+	U_64 _previousCycleGCTimeInNanos; /**< GC time spent in the previous cycle (0 until a cycle completes) */
+	double _safeUtilization; /**< highest utilization found safe by the last decision (0 until the first decision) */
+	uintptr_t _synchronousFallbackCount; /**< number of times a cycle had to be completed synchronously */
+
+protected:
+public:
+	/**
+	 * The decisions reported by the J9HOOK_MM_UTILIZATION_CONTROLLER_DECISION event
+	 */
+	enum {
+		DECISION_NO_DATA = 0, /**< the settings are kept until a cycle has completed and the mutators have allocated */
+		DECISION_ADJUSTED, /**< the settings were picked from the allocation rate and the remaining work of the cycle */
+		DECISION_SYNCHRONOUS /**< the cycle is completed synchronously, the next one starts from the most conservative settings */
+	};
+
+	/*
+	 * Function members
+	 */
+private:
+	U_64 adjust(MM_EnvironmentRealtime *env, uintptr_t freeMemory);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_UtilizationController *newInstance(MM_EnvironmentBase *env, MM_UtilizationTracker *utilTracker);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Called at the start of a GC increment, before the GC time slice is added to the tracker.
+	 * Samples the allocation of the mutator slice that just ended and adjusts the target
+	 * utilization and GC quantum for this increment. Every decision is reported with the
+	 * J9HOOK_MM_UTILIZATION_CONTROLLER_DECISION event.
+	 * @param env[in] the master thread
+	 * @param isSynchronous true if the rest of the cycle is being completed synchronously
+	 */
+	void reportIncrementStart(MM_EnvironmentRealtime *env, bool isSynchronous);
+
+	/**
+	 * Called at the end of a GC increment, when the mutators are about to be restarted.
+	 * @param env[in] the master thread
+	 * @param isCycleEnd true if the increment completed the GC cycle
+	 */
+	void reportIncrementEnd(MM_EnvironmentRealtime *env, bool isCycleEnd);
+
+	double getMinimumTargetUtilization() { return _minimumTargetUtilization; }
+	double getMaximumTargetUtilization() { return _maximumTargetUtilization; }
+	double getAllocationRate() { return _allocationRate; }
+	double getSafeUtilization() { return _safeUtilization; }
+	uintptr_t getSynchronousFallbackCount() { return _synchronousFallbackCount; }
+	U_64 getPreviousCycleGCTimeInNanos() { return _previousCycleGCTimeInNanos; }
+
+	MM_UtilizationController(MM_EnvironmentBase *env, MM_UtilizationTracker *utilTracker)
+		: MM_BaseVirtual()
+		, _extensions(MM_GCExtensionsBase::getExtensions(env->getOmrVM()))
+		, _utilTracker(utilTracker)
+		, _minimumTargetUtilization(0.0)
+		, _maximumTargetUtilization(0.0)
+		, _minimumGCSliceNanos(0)
+		, _maximumGCSliceNanos(0)
+		, _allocationRate(0.0)
+		, _freeMemoryAtIncrementEnd(0)
+		, _incrementEndTimeInNanos(0)
+		, _incrementStartTimeInNanos(0)
+		, _cycleGCTimeInNanos(0)
+		, _previousCycleGCTimeInNanos(0)
+		, _safeUtilization(0.0)
+		, _synchronousFallbackCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* UTILIZATIONCONTROLLER_HPP_ */
@@ -95,6 +95,33 @@ MM_UtilizationTracker::getTargetUtilization()
 	return _targetUtilization;
 }
 
+/**
+ *  Change the utilization target.  Takes effect from the next time slice.
+ */
+void
+MM_UtilizationTracker::setTargetUtilization(double targetUtilization)
+{
+	_targetUtilization = targetUtilization;
+}
+
+/**
+ *  Returns the longest time in nanoseconds the GC may run at a time.
+ */
+U_64
+MM_UtilizationTracker::getMaxGCSlice()
+{
+	return _maxGCSlice;
+}
+
+/**
+ *  Change the longest time in nanoseconds the GC may run at a time.  Takes effect from the next time slice.
+ */
+void
+MM_UtilizationTracker::setMaxGCSlice(U_64 maxGCSlice)
+{
+	_maxGCSlice = maxGCSlice;
+}
+
 /**
  * Compacts the timeSlice array to two entries (1 for mutator, 1 for GC) since the
  * array will overflow on the next call to addTimeSlice if we do not.
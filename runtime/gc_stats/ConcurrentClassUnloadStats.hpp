@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(CONCURRENTCLASSUNLOADSTATS_HPP_)
+#define CONCURRENTCLASSUNLOADSTATS_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9port.h"
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+
+/**
+ * Storage for statistics of the class segment freeing which runs concurrently with the mutator,
+ * after the collection which flushed the undead class segments has released exclusive access.
+ * Values are accumulated until the stats are next reported.
+ * @ingroup GC_Stats
+ */
+class MM_ConcurrentClassUnloadStats
+{
+public:
+	UDATA _segmentsFreed; /**< number of undead class segments freed by the concurrent class unloading thread */
+	UDATA _bytesFreed; /**< total size of the undead class segments freed */
+	U_64 _segmentTime; /**< time spent freeing the segments, in microseconds */
+
+	void clear()
+	{
+		_segmentsFreed = 0;
+		_bytesFreed = 0;
+		_segmentTime = 0;
+	}
+
+	MM_ConcurrentClassUnloadStats() :
+		_segmentsFreed(0)
+		, _bytesFreed(0)
+		, _segmentTime(0)
+	{}
+};
+
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+#endif /* CONCURRENTCLASSUNLOADSTATS_HPP_ */
@@ -69,6 +69,12 @@ public:
 	UDATA _doubleMappedArrayletsCandidates; /**< The number of double mapped arraylets that have been visited during marking */
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+	UDATA _numaLocalScanCacheCount; /**< The number of scan caches acquired by a thread with NUMA affinity from the scan list of its own node */
+	UDATA _numaCommonScanCacheCount; /**< The number of scan caches acquired from the scan list of the common (no affinity) context */
+	UDATA _numaRemoteScanCacheCount; /**< The number of scan caches stolen from the scan list of another NUMA node */
+
+	UDATA _pinnedRegionCount; /**< The number of collection set regions which were not evacuated because JNI critical sections pinned them */
+
 private:
 	
 	/* 
@@ -97,6 +103,12 @@ public:
 		_doubleMappedArrayletsCleared = 0;
 		_doubleMappedArrayletsCandidates = 0;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
+		_numaLocalScanCacheCount = 0;
+		_numaCommonScanCacheCount = 0;
+		_numaRemoteScanCacheCount = 0;
+
+		_pinnedRegionCount = 0;
 	}
 	
 	/**
@@ -121,6 +133,10 @@ public:
 		_doubleMappedArrayletsCleared += stats->_doubleMappedArrayletsCleared;
 		_doubleMappedArrayletsCandidates += stats->_doubleMappedArrayletsCandidates;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
+		_numaLocalScanCacheCount += stats->_numaLocalScanCacheCount;
+		_numaCommonScanCacheCount += stats->_numaCommonScanCacheCount;
+		_numaRemoteScanCacheCount += stats->_numaRemoteScanCacheCount;
 	}
 
 	MM_CopyForwardStats() :
@@ -138,6 +154,10 @@ public:
 		, _doubleMappedArrayletsCleared(0)
 		, _doubleMappedArrayletsCandidates(0)
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+		, _numaLocalScanCacheCount(0)
+		, _numaCommonScanCacheCount(0)
+		, _numaRemoteScanCacheCount(0)
+		, _pinnedRegionCount(0)
 	{}
 };
 
@@ -38,6 +38,7 @@ MM_MarkJavaStats::clear()
 	_weakReferenceStats.clear();
 	_softReferenceStats.clear();
 	_phantomReferenceStats.clear();
+	_softReferenceAgeStats.clear();
 
 	_stringConstantsCleared = 0;
 	_stringConstantsCandidates = 0;
@@ -60,6 +61,7 @@ MM_MarkJavaStats::merge(MM_MarkJavaStats* statsToMerge)
 	_weakReferenceStats.merge(&statsToMerge->_weakReferenceStats);
 	_softReferenceStats.merge(&statsToMerge->_softReferenceStats);
 	_phantomReferenceStats.merge(&statsToMerge->_phantomReferenceStats);
+	_softReferenceAgeStats.merge(&statsToMerge->_softReferenceAgeStats);
 
 	_stringConstantsCleared += statsToMerge->_stringConstantsCleared;
 	_stringConstantsCandidates += statsToMerge->_stringConstantsCandidates;
@@ -30,6 +30,7 @@
 #include "Base.hpp"
 #include "AtomicOperations.hpp"
 #include "ReferenceStats.hpp"
+#include "SoftReferenceAgeStats.hpp"
 
 /**
  * Storage for statistics relevant to the mark phase of a global collection.
@@ -49,6 +50,7 @@ public:
 	MM_ReferenceStats _weakReferenceStats; /**< Weak reference stats for the cycle */
 	MM_ReferenceStats _softReferenceStats; /**< Soft reference stats for the cycle */
 	MM_ReferenceStats _phantomReferenceStats; /**< Phantom reference stats for the cycle */
+	MM_SoftReferenceAgeStats _softReferenceAgeStats; /**< Ages of the soft references kept alive this cycle */
 
 	UDATA _stringConstantsCleared; /**< The number of string constants that have been cleared during marking */
 	UDATA _stringConstantsCandidates; /**< The number of string constants that have been visited in string table during marking */
@@ -74,6 +76,7 @@ public:
 		, _weakReferenceStats()
 		, _softReferenceStats()
 		, _phantomReferenceStats()
+		, _softReferenceAgeStats()
 		, _stringConstantsCleared(0)
 		, _stringConstantsCandidates(0)
 	{
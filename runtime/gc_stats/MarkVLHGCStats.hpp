@@ -42,6 +42,7 @@
 #include "Base.hpp"
 #include "AtomicOperations.hpp" 
 #include "ReferenceStats.hpp"
+#include "SoftReferenceAgeStats.hpp"
 
 /**
  * Storage for statistics relevant to the mark phase of a global collection.
@@ -64,6 +65,7 @@ public:
 	MM_ReferenceStats _weakReferenceStats;  /**< Weak reference stats for the cycle */
 	MM_ReferenceStats _softReferenceStats;  /**< Soft reference stats for the cycle */
 	MM_ReferenceStats _phantomReferenceStats;  /**< Phantom reference stats for the cycle */
+	MM_SoftReferenceAgeStats _softReferenceAgeStats; /**< Ages of the soft references kept alive this cycle */
 
 	UDATA _stringConstantsCleared;  /**< The number of string constants that have been cleared during marking */
 	UDATA _stringConstantsCandidates; /**< The number of string constants that have been visited in string table during marking */
@@ -73,6 +75,10 @@ public:
 	UDATA _doubleMappedArrayletsCandidates; /**< The number of double mapped arraylets that have been visited during marking */
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */	
 
+	UDATA _numaLocalObjectsScanned; /**< The number of objects scanned from work packets which reside on the NUMA node the scanning thread has affinity with */
+	UDATA _numaCommonObjectsScanned; /**< The number of objects scanned from work packets which reside in a region with no NUMA affinity, or were scanned by a thread with none */
+	UDATA _numaRemoteObjectsScanned; /**< The number of objects scanned from work packets which reside on a NUMA node other than the scanning thread's */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	UDATA _splitArraysProcessed; /**< The number of array chunks (not counting parts smaller than the split size) processed by this thread */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -95,6 +101,7 @@ public:
 		_weakReferenceStats.clear();
 		_softReferenceStats.clear();
 		_phantomReferenceStats.clear();
+		_softReferenceAgeStats.clear();
 
 		_stringConstantsCleared = 0;
 		_stringConstantsCandidates = 0;
@@ -104,6 +111,10 @@ public:
 		_doubleMappedArrayletsCandidates = 0;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */	
 
+		_numaLocalObjectsScanned = 0;
+		_numaCommonObjectsScanned = 0;
+		_numaRemoteObjectsScanned = 0;
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		_splitArraysProcessed = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -122,6 +133,7 @@ public:
 		_weakReferenceStats.merge(&statsToMerge->_weakReferenceStats);
 		_softReferenceStats.merge(&statsToMerge->_softReferenceStats);
 		_phantomReferenceStats.merge(&statsToMerge->_phantomReferenceStats);
+		_softReferenceAgeStats.merge(&statsToMerge->_softReferenceAgeStats);
 
 		_stringConstantsCleared += statsToMerge->_stringConstantsCleared;
 		_stringConstantsCandidates += statsToMerge->_stringConstantsCandidates;
@@ -131,6 +143,10 @@ public:
 		_doubleMappedArrayletsCandidates += statsToMerge->_doubleMappedArrayletsCandidates;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */	
 
+		_numaLocalObjectsScanned += statsToMerge->_numaLocalObjectsScanned;
+		_numaCommonObjectsScanned += statsToMerge->_numaCommonObjectsScanned;
+		_numaRemoteObjectsScanned += statsToMerge->_numaRemoteObjectsScanned;
+
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		/* It may not ever be useful to merge these stats, but do it anyways */
@@ -148,12 +164,16 @@ public:
 		,_weakReferenceStats()
 		,_softReferenceStats()
 		,_phantomReferenceStats()
+		,_softReferenceAgeStats()
 		,_stringConstantsCleared(0)
 		,_stringConstantsCandidates(0)
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 		,_doubleMappedArrayletsCleared(0)
 		,_doubleMappedArrayletsCandidates(0)
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+		,_numaLocalObjectsScanned(0)
+		,_numaCommonObjectsScanned(0)
+		,_numaRemoteObjectsScanned(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		,_splitArraysProcessed(0)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SOFTREFERENCEAGESTATS_HPP_)
+#define SOFTREFERENCEAGESTATS_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "modronopt.h"
+
+#include "Base.hpp"
+
+#define SOFT_REFERENCE_AGE_BUCKETS 64
+
+/**
+ * Histogram of the ages of the soft references whose referents survived a collection.
+ * The age of a soft reference is the number of collections since its referent was last
+ * fetched, so the histogram orders the soft referents from most to least recently used.
+ * Thresholds up to SOFT_REFERENCE_AGE_BUCKETS - 1 are recorded exactly, larger ones are scaled.
+ * @ingroup GC_Stats
+ */
+class MM_SoftReferenceAgeStats : public MM_Base {
+	/* data members */
+private:
+protected:
+public:
+	UDATA _survivors[SOFT_REFERENCE_AGE_BUCKETS]; /**< number of soft referents kept alive, by bucket of their age after this collection */
+
+	/* function members */
+private:
+protected:
+public:
+	/**
+	 * @return the bucket which counts soft references of the given age
+	 */
+	static MMINLINE UDATA
+	bucketForAge(UDATA age, UDATA maxAge)
+	{
+		UDATA bucket = age;
+		if (maxAge >= SOFT_REFERENCE_AGE_BUCKETS) {
+			bucket = (age * (SOFT_REFERENCE_AGE_BUCKETS - 1)) / maxAge;
+		}
+		return OMR_MIN(bucket, (UDATA)(SOFT_REFERENCE_AGE_BUCKETS - 1));
+	}
+
+	/**
+	 * @return the smallest age counted in the given bucket
+	 */
+	static MMINLINE UDATA
+	lowestAgeInBucket(UDATA bucket, UDATA maxAge)
+	{
+		UDATA age = bucket;
+		if (maxAge >= SOFT_REFERENCE_AGE_BUCKETS) {
+			age = ((bucket * maxAge) + SOFT_REFERENCE_AGE_BUCKETS - 2) / (SOFT_REFERENCE_AGE_BUCKETS - 1);
+		}
+		return age;
+	}
+
+	MMINLINE void
+	recordSurvivor(UDATA age, UDATA maxAge)
+	{
+		_survivors[bucketForAge(age, maxAge)] += 1;
+	}
+
+	MMINLINE UDATA
+	getSurvivorCount()
+	{
+		UDATA count = 0;
+		for (UDATA bucket = 0; bucket < SOFT_REFERENCE_AGE_BUCKETS; bucket++) {
+			count += _survivors[bucket];
+		}
+		return count;
+	}
+
+	void clear()
+	{
+		for (UDATA bucket = 0; bucket < SOFT_REFERENCE_AGE_BUCKETS; bucket++) {
+			_survivors[bucket] = 0;
+		}
+	}
+
+	void merge(MM_SoftReferenceAgeStats *statsToMerge)
+	{
+		for (UDATA bucket = 0; bucket < SOFT_REFERENCE_AGE_BUCKETS; bucket++) {
+			_survivors[bucket] += statsToMerge->_survivors[bucket];
+		}
+	}
+
+	MM_SoftReferenceAgeStats() :
+		MM_Base()
+	{
+		clear();
+	}
+};
+
+#endif /* SOFTREFERENCEAGESTATS_HPP_ */
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ */
+
+#include <string.h>
+
+#include "HeapWorkUnitIterator.hpp"
+
+#include "Forge.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
+
+bool
+GC_HeapWorkUnitIterator::initialize()
+{
+	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _javaVM->portLibrary, 0, collectHeap, this);
+	if (_failed) {
+		return false;
+	}
+
+	/* the heaps, spaces and regions aren't reported in address order */
+	J9_SORT(_regions, _regionCount, sizeof(J9MM_IterateRegionDescriptor), compareRegions);
+	return true;
+}
+
+void
+GC_HeapWorkUnitIterator::tearDown()
+{
+	if (NULL != _regions) {
+		_extensions->getForge()->free(_regions);
+		_regions = NULL;
+	}
+	_regionCount = 0;
+	_regionCapacity = 0;
+}
+
+void
+GC_HeapWorkUnitIterator::resumeAt(void *address, bool isObjectBoundary)
+{
+	_regionIndex = 0;
+	_nextBase = NULL;
+	if (NULL == address) {
+		return;
+	}
+
+	/* skip the regions entirely below the address without walking them */
+	while ((_regionIndex < _regionCount) && (((UDATA)_regions[_regionIndex].regionStart + _regions[_regionIndex].regionSize) <= (UDATA)address)) {
+		_regionIndex += 1;
+	}
+	if (_regionIndex == _regionCount) {
+		return;
+	}
+
+	J9MM_IterateRegionDescriptor *regionDesc = &_regions[_regionIndex];
+	if (((UDATA)address > (UDATA)regionDesc->regionStart) && isSplittable(regionDesc)) {
+		if (isObjectBoundary) {
+			_nextBase = address;
+		} else {
+			/* the objects may have moved since the address was saved, so an object boundary has to be found again */
+			_nextBase = findObjectAtOrAbove(regionDesc, regionDesc->regionStart, address);
+			if (NULL == _nextBase) {
+				_regionIndex += 1;
+			}
+		}
+	}
+}
+
+bool
+GC_HeapWorkUnitIterator::nextUnit(GC_HeapWorkUnit *unit)
+{
+	if (_regionIndex >= _regionCount) {
+		return false;
+	}
+
+	J9MM_IterateRegionDescriptor *regionDesc = &_regions[_regionIndex];
+	void *base = (NULL == _nextBase) ? regionDesc->regionStart : _nextBase;
+	void *top = findUnitTop(regionDesc, base);
+
+	unit->regionDesc = *regionDesc;
+	unit->base = base;
+	unit->top = top;
+	if (top < (void *)((UDATA)regionDesc->regionStart + regionDesc->regionSize)) {
+		_nextBase = top;
+	} else {
+		_regionIndex += 1;
+		_nextBase = NULL;
+	}
+	return true;
+}
+
+void *
+GC_HeapWorkUnitIterator::findUnitTop(J9MM_IterateRegionDescriptor *regionDesc, void *base)
+{
+	void *top = (void *)((UDATA)regionDesc->regionStart + regionDesc->regionSize);
+
+	if (isSplittable(regionDesc) && (((UDATA)top - (UDATA)base) > _unitSize)) {
+		void *split = findObjectAtOrAbove(regionDesc, base, (void *)((UDATA)base + _unitSize));
+		if (NULL != split) {
+			top = split;
+		}
+	}
+	return top;
+}
+
+void *
+GC_HeapWorkUnitIterator::getPosition()
+{
+	if (_regionIndex >= _regionCount) {
+		return NULL;
+	}
+	return (NULL == _nextBase) ? _regions[_regionIndex].regionStart : _nextBase;
+}
+
+bool
+GC_HeapWorkUnitIterator::isSplittable(J9MM_IterateRegionDescriptor *regionDesc)
+{
+	/* segregated regions can only be walked cell-by-cell from their start */
+	return !_extensions->isSegregatedHeap() && (regionDesc->regionSize > _unitSize);
+}
+
+void *
+GC_HeapWorkUnitIterator::findObjectAtOrAbove(J9MM_IterateRegionDescriptor *regionDesc, void *base, void *limit)
+{
+	MM_HeapRegionDescriptor *heapRegion = (MM_HeapRegionDescriptor *)regionDesc->id;
+	void *top = (void *)((UDATA)regionDesc->regionStart + regionDesc->regionSize);
+	GC_ObjectHeapBufferedIterator objectHeapIterator(_extensions, heapRegion, base, top, true, 1);
+	J9Object *previous = NULL;
+	J9Object *object = NULL;
+
+	while (NULL != (object = objectHeapIterator.nextObject())) {
+		if (object <= previous) {
+			/* the walk is not making progress -- leave the rest of the region to a single unit, whose walk reports it */
+			return NULL;
+		}
+		if ((void *)object >= limit) {
+			return object;
+		}
+		previous = object;
+	}
+	return NULL;
+}
+
+jvmtiIterationControl
+GC_HeapWorkUnitIterator::collectHeap(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heapDesc, void *userData)
+{
+	vm->memoryManagerFunctions->j9mm_iterate_spaces(vm, vm->portLibrary, heapDesc, 0, collectSpace, userData);
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+jvmtiIterationControl
+GC_HeapWorkUnitIterator::collectSpace(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *spaceDesc, void *userData)
+{
+	vm->memoryManagerFunctions->j9mm_iterate_regions(vm, vm->portLibrary, spaceDesc, 0, collectRegion, userData);
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+jvmtiIterationControl
+GC_HeapWorkUnitIterator::collectRegion(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, void *userData)
+{
+	GC_HeapWorkUnitIterator *iterator = (GC_HeapWorkUnitIterator *)userData;
+
+	if (iterator->_failed) {
+		return JVMTI_ITERATION_ABORT;
+	}
+	if (iterator->_regionCount == iterator->_regionCapacity) {
+		MM_Forge *forge = iterator->_extensions->getForge();
+		UDATA newCapacity = (0 == iterator->_regionCapacity) ? 64 : (iterator->_regionCapacity * 2);
+		J9MM_IterateRegionDescriptor *newRegions = (J9MM_IterateRegionDescriptor *)forge->allocate(sizeof(J9MM_IterateRegionDescriptor) * newCapacity, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL == newRegions) {
+			iterator->_failed = true;
+			return JVMTI_ITERATION_ABORT;
+		}
+		if (NULL != iterator->_regions) {
+			memcpy(newRegions, iterator->_regions, sizeof(J9MM_IterateRegionDescriptor) * iterator->_regionCount);
+			forge->free(iterator->_regions);
+		}
+		iterator->_regions = newRegions;
+		iterator->_regionCapacity = newCapacity;
+	}
+
+	if (0 != regionDesc->regionSize) {
+		iterator->_regions[iterator->_regionCount] = *regionDesc;
+		iterator->_regionCount += 1;
+	}
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+/**
+ * Helper function used by J9_SORT to sort region descriptors into address order.
+ */
+int
+GC_HeapWorkUnitIterator::compareRegions(const void *element1, const void *element2)
+{
+	UDATA start1 = (UDATA)((J9MM_IterateRegionDescriptor *)element1)->regionStart;
+	UDATA start2 = (UDATA)((J9MM_IterateRegionDescriptor *)element2)->regionStart;
+
+	if (start1 == start2) {
+		return 0;
+	}
+	return (start1 < start2) ? -1 : 1;
+}
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Structs
+ */
+
+#if !defined(HEAPWORKUNITITERATOR_HPP_)
+#define HEAPWORKUNITITERATOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "GCExtensions.hpp"
+#include "HeapIteratorAPI.h"
+
+/**
+ * An object-aligned range of a heap region, walked as a single unit of work.
+ */
+typedef struct GC_HeapWorkUnit {
+	J9MM_IterateRegionDescriptor regionDesc; /**< The region containing the range */
+	void *base; /**< The first object in the range */
+	void *top; /**< The end of the range (exclusive) */
+} GC_HeapWorkUnit;
+
+/**
+ * Hand out the object heap in address order as units of about a given size, for the
+ * walks which split the heap between threads (gcchk parallel, j9mm_iterate_all_objects_parallel)
+ * or over several invocations (gcchk incremental).
+ *
+ * Only the region descriptors are collected up front. Regions larger than the unit size are
+ * split lazily: each call to nextUnit() walks the object headers of the unit it returns,
+ * and no further, to end the unit at an object boundary. Segregated regions can only be
+ * walked from their start, so they are never split.
+ *
+ * @note Not thread safe, callers sharing an iterator between threads must serialize nextUnit().
+ * @ingroup GC_Structs
+ */
+class GC_HeapWorkUnitIterator
+{
+private:
+	J9JavaVM *_javaVM;
+	MM_GCExtensions *_extensions;
+	UDATA _unitSize; /**< Regions larger than this are split into units of about this size */
+	J9MM_IterateRegionDescriptor *_regions; /**< Regions of all the heaps, in address order */
+	UDATA _regionCount; /**< Number of regions in _regions */
+	UDATA _regionCapacity; /**< Number of regions which fit in _regions */
+	UDATA _regionIndex; /**< The region the next unit starts in */
+	void *_nextBase; /**< The object boundary in the current region where the next unit starts (NULL for the region start) */
+	bool _failed; /**< Set if the region list could not be grown */
+
+private:
+	static jvmtiIterationControl collectHeap(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heapDesc, void *userData);
+	static jvmtiIterationControl collectSpace(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *spaceDesc, void *userData);
+	static jvmtiIterationControl collectRegion(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, void *userData);
+	static int compareRegions(const void *element1, const void *element2);
+
+	bool isSplittable(J9MM_IterateRegionDescriptor *regionDesc);
+
+	/**
+	 * Walk the object headers of a region from base, and answer the first object at or above limit.
+	 * @return the object found, or NULL if there is none or the walk stops making progress
+	 */
+	void *findObjectAtOrAbove(J9MM_IterateRegionDescriptor *regionDesc, void *base, void *limit);
+
+public:
+	/**
+	 * Collect the regions of the heap.
+	 * @return false if the region list could not be allocated
+	 */
+	bool initialize();
+
+	/**
+	 * Free the region list.
+	 */
+	void tearDown();
+
+	/**
+	 * Position the iterator so that the next unit starts at a given address.
+	 * @param address the address to resume at, or NULL to restart at the bottom of the heap
+	 * @param isObjectBoundary true if address is known to still be the start of an object (or of a hole).
+	 * Otherwise the walk resumes at the first object at or above address, which is found by walking the
+	 * object headers of its region from the region start.
+	 */
+	void resumeAt(void *address, bool isObjectBoundary);
+
+	/**
+	 * Answer the next unit of the heap.
+	 * @param[out] unit the unit
+	 * @return false once the top of the heap has been reached
+	 */
+	bool nextUnit(GC_HeapWorkUnit *unit);
+
+	/**
+	 * Answer the object boundary the next unit will start at, or NULL if the top of the heap has been reached.
+	 */
+	void *getPosition();
+
+	/**
+	 * Answer the end of the unit of a region which starts at base: the first object at or above
+	 * base plus the unit size, or the top of the region if there is none or the region can't be split.
+	 * The iterator does not need to be initialized to split a single region.
+	 * @param regionDesc the region
+	 * @param base an object boundary in the region (or the region start)
+	 */
+	void *findUnitTop(J9MM_IterateRegionDescriptor *regionDesc, void *base);
+
+	GC_HeapWorkUnitIterator(J9JavaVM *javaVM, UDATA unitSize) :
+		_javaVM(javaVM),
+		_extensions(MM_GCExtensions::getExtensions(javaVM)),
+		_unitSize(unitSize),
+		_regions(NULL),
+		_regionCount(0),
+		_regionCapacity(0),
+		_regionIndex(0),
+		_nextBase(NULL),
+		_failed(false)
+	{}
+};
+
+#endif /* HEAPWORKUNITITERATOR_HPP_ */
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "CuTest.h"
+#include "j9.h"
+
+#include <string.h>
+
+#include "IncrementalCardTable.hpp"
+
+#if defined(J9VM_ENV_DATA64)
+#define BENCHMARK_HEAP_SIZE ((UDATA)4 * 1024 * 1024 * 1024)
+#else /* J9VM_ENV_DATA64 */
+#define BENCHMARK_HEAP_SIZE ((UDATA)1024 * 1024 * 1024)
+#endif /* J9VM_ENV_DATA64 */
+#define BENCHMARK_DIRTY_CARD_INTERVAL 10000
+#define BENCHMARK_ITERATIONS 10
+
+extern J9PortLibrary *sharedPortLibrary;
+
+/**
+ * Simple linear congruential generator, so that the card layouts are the same on every run.
+ */
+static UDATA
+nextRandom(UDATA *seed)
+{
+	*seed = (*seed * 1103515245) + 12345;
+	return (*seed >> 16) & 0x7FFF;
+}
+
+/**
+ * Count the non-clean cards in the range one card at a time, as the card cleaners did before
+ * MM_IncrementalCardTable::findFirstNonCleanCard() was available.
+ */
+static UDATA
+countNonCleanCardsByByte(Card *card, Card *toCard)
+{
+	UDATA count = 0;
+	while (card < toCard) {
+		if (CARD_CLEAN != *card) {
+			count += 1;
+		}
+		card += 1;
+	}
+	return count;
+}
+
+static UDATA
+countNonCleanCardsBulk(Card *card, Card *toCard)
+{
+	UDATA count = 0;
+	while (toCard != (card = MM_IncrementalCardTable::findFirstNonCleanCard(card, toCard))) {
+		count += 1;
+		card += 1;
+	}
+	return count;
+}
+
+/**
+ * Verify that every non-clean card is found, whatever the alignment and length of the range
+ * and wherever the non-clean cards fall relative to the word and vector boundaries.
+ */
+void
+Test_CardScan_findsEveryNonCleanCard(CuTest *tc)
+{
+	PORT_ACCESS_FROM_PORT(sharedPortLibrary);
+	const UDATA tableSize = 1024;
+	const Card states[] = { CARD_DIRTY, CARD_GMP_MUST_SCAN, CARD_PGC_MUST_SCAN, CARD_REMEMBERED, CARD_REMEMBERED_AND_GMP_SCAN };
+	Card *table = (Card *)j9mem_allocate_memory(tableSize, OMRMEM_CATEGORY_MM);
+	CuAssertPtrNotNull(tc, table);
+	UDATA seed = 1;
+
+	for (UDATA dirtyCount = 0; dirtyCount < 8; dirtyCount++) {
+		memset(table, CARD_CLEAN, tableSize);
+		for (UDATA i = 0; i < dirtyCount; i++) {
+			table[nextRandom(&seed) % tableSize] = states[nextRandom(&seed) % (sizeof(states) / sizeof(states[0]))];
+		}
+		for (UDATA start = 0; start < 64; start++) {
+			for (UDATA end = tableSize - 64; end < tableSize; end += 7) {
+				Card *card = table + start;
+				Card *toCard = table + end;
+				Card *expected = card;
+				while ((expected < toCard) && (CARD_CLEAN == *expected)) {
+					expected += 1;
+				}
+				CuAssertPtrEquals(tc, expected, MM_IncrementalCardTable::findFirstNonCleanCard(card, toCard));
+				CuAssertIntEquals(tc, (int)countNonCleanCardsByByte(card, toCard), (int)countNonCleanCardsBulk(card, toCard));
+			}
+		}
+	}
+
+	/* empty and tiny ranges */
+	memset(table, CARD_CLEAN, tableSize);
+	CuAssertPtrEquals(tc, table, MM_IncrementalCardTable::findFirstNonCleanCard(table, table));
+	table[3] = CARD_DIRTY;
+	CuAssertPtrEquals(tc, table + 3, MM_IncrementalCardTable::findFirstNonCleanCard(table + 1, table + 5));
+	CuAssertPtrEquals(tc, table + 3, MM_IncrementalCardTable::findFirstNonCleanCard(table + 1, table + 3));
+
+	j9mem_free_memory(table);
+}
+
+/**
+ * Time the discovery of non-clean cards over the card table of a large, mostly clean heap,
+ * which is the bulk of card cleaning when few cards have been dirtied since the last collection.
+ */
+void
+Test_CardScan_mostlyCleanHeapBenchmark(CuTest *tc)
+{
+	PORT_ACCESS_FROM_PORT(sharedPortLibrary);
+	const UDATA cardCount = BENCHMARK_HEAP_SIZE / CARD_SIZE;
+	Card *table = (Card *)j9mem_allocate_memory(cardCount, OMRMEM_CATEGORY_MM);
+	CuAssertPtrNotNull(tc, table);
+	UDATA seed = 1;
+
+	memset(table, CARD_CLEAN, cardCount);
+	for (UDATA i = 0; i < (cardCount / BENCHMARK_DIRTY_CARD_INTERVAL); i++) {
+		table[(nextRandom(&seed) * 0x8000 + nextRandom(&seed)) % cardCount] = CARD_DIRTY;
+	}
+
+	UDATA byteCount = 0;
+	U_64 start = j9time_hires_clock();
+	for (UDATA i = 0; i < BENCHMARK_ITERATIONS; i++) {
+		byteCount = countNonCleanCardsByByte(table, table + cardCount);
+	}
+	U_64 byteTime = j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+	UDATA bulkCount = 0;
+	start = j9time_hires_clock();
+	for (UDATA i = 0; i < BENCHMARK_ITERATIONS; i++) {
+		bulkCount = countNonCleanCardsBulk(table, table + cardCount);
+	}
+	U_64 bulkTime = j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+	printf("card scan of a %zu MB heap (%zu cards, %zu not clean), average of %d iterations:\n", (size_t)(BENCHMARK_HEAP_SIZE / (1024 * 1024)), (size_t)cardCount, (size_t)bulkCount, BENCHMARK_ITERATIONS);
+	printf("  byte at a time: %llu usec\n", (unsigned long long)(byteTime / BENCHMARK_ITERATIONS));
+	printf("  bulk:           %llu usec\n", (unsigned long long)(bulkTime / BENCHMARK_ITERATIONS));
+
+	CuAssertIntEquals(tc, (int)byteCount, (int)bulkCount);
+
+	j9mem_free_memory(table);
+}
+
+CuSuite
+*GetCardScanTestSuite()
+{
+	CuSuite *suite = CuSuiteNew();
+	SUITE_ADD_TEST(suite, Test_CardScan_findsEveryNonCleanCard);
+	SUITE_ADD_TEST(suite, Test_CardScan_mostlyCleanHeapBenchmark);
+	return suite;
+}
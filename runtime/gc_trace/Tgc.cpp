@@ -257,6 +257,11 @@ tgcParseArgs(J9JavaVM *javaVM, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "allocationSampling")) {
+			tgcExtensions->_allocationSamplingRequested = true;
+			continue;
+		}
+
 		if (try_scan(&scan_start, "allocation")) {
 			tgcExtensions->_allocationRequested = true;
 			continue;
@@ -335,6 +340,10 @@ tgcInitializeRequestedOptions(J9JavaVM *javaVM)
 			result = result && tgcAllocationInitialize(javaVM);
 		}
 		
+		if (tgcExtensions->_allocationSamplingRequested) {
+			result = result && tgcAllocationSamplingInitialize(javaVM);
+		}
+
 		if (tgcExtensions->_largeAllocationVerboseRequested || tgcExtensions->_largeAllocationRequested) {
 			result = result && tgcLargeAllocationInitialize(javaVM);
 		}
@@ -443,6 +452,7 @@ tgcTearDownExtensions(J9JavaVM *javaVM)
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
 
 	if (NULL != extensions->tgcExtensions) {
+		tgcAllocationSamplingTearDown(javaVM);
 		if (extensions->isVLHGC()) {
 #if defined(J9VM_GC_VLHGC)
 			tgcInterRegionRememberedSetTearDown(javaVM);
@@ -26,14 +26,20 @@
 #include "modronopt.h"
 #include "mmhook.h"
 
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "VMThreadListIterator.hpp"
 #include "TLHAllocationInterface.hpp"
+#include "Tgc.hpp"
 #include "TgcExtensions.hpp"
 #include "TgcAllocation.hpp"
 #include "HeapStats.hpp"
 
+#define TGC_ALLOCATION_SAMPLE_ENTRY_EMPTY 0
+#define TGC_ALLOCATION_SAMPLE_ENTRY_CLAIMED 1
+#define TGC_ALLOCATION_SAMPLE_ENTRY_PUBLISHED 2
+
 static void
 tgcAllocationPrintStats(OMR_VMThread* omrVMThread)
 {
@@ -86,3 +92,196 @@ tgcAllocationInitialize(J9JavaVM *javaVM)
 
 	return result;
 }
+
+static UDATA
+tgcAllocationSamplingFrameIterator(J9VMThread *vmThread, J9StackWalkState *walkState)
+{
+	J9Method **frames = (J9Method **)walkState->userData1;
+	UDATA frameCount = (UDATA)walkState->userData2;
+
+	/* the walk is bounded by maxFrames so there is always room for this frame */
+	frames[frameCount] = walkState->method;
+	walkState->userData2 = (void *)(frameCount + 1);
+	return J9_STACKWALK_KEEP_ITERATING;
+}
+
+static bool
+tgcAllocationSamplingEntryMatches(TgcAllocationSamplingExtensions::SampleEntry *entry, J9Class *clazz, J9Method **frames)
+{
+	bool result = (TGC_ALLOCATION_SAMPLE_ENTRY_PUBLISHED == entry->state) && (entry->clazz == clazz);
+	for (UDATA i = 0; result && (i < TGC_ALLOCATION_SAMPLE_FRAMES); i++) {
+		result = (entry->frames[i] == frames[i]);
+	}
+	return result;
+}
+
+/**
+ * Record an allocation sample against its class and allocating stack.
+ * Called on the allocating thread each time it crosses the allocation sampling granularity
+ * (typically while refreshing its TLH), so it must never block: entries are found by open addressing
+ * and new entries are claimed with a compare and swap. Two threads racing to record the same new key
+ * may each claim an entry; the dump reports both, which only splits the counts for that key.
+ */
+static void
+tgcHookAllocationSample(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_ObjectAllocationSamplingEvent* event = (MM_ObjectAllocationSamplingEvent*)eventData;
+	J9VMThread *vmThread = event->currentThread;
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(vmThread->javaVM);
+	TgcAllocationSamplingExtensions *samplingExtensions = &tgcExtensions->_allocationSampling;
+	J9Method *frames[TGC_ALLOCATION_SAMPLE_FRAMES];
+	J9StackWalkState walkState;
+
+	memset(frames, 0, sizeof(frames));
+	walkState.walkThread = vmThread;
+	walkState.skipCount = 0;
+	walkState.maxFrames = TGC_ALLOCATION_SAMPLE_FRAMES;
+	walkState.userData1 = (void *)frames;
+	walkState.userData2 = (void *)0;
+	walkState.frameWalkFunction = tgcAllocationSamplingFrameIterator;
+	walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_INCLUDE_NATIVES;
+	vmThread->javaVM->walkStackFrames(vmThread, &walkState);
+
+	UDATA hash = (UDATA)event->clazz;
+	for (UDATA i = 0; i < TGC_ALLOCATION_SAMPLE_FRAMES; i++) {
+		hash = (hash * 31) ^ (UDATA)frames[i];
+	}
+	hash ^= (hash >> 17);
+
+	for (UDATA probe = 0; probe < TGC_ALLOCATION_SAMPLE_TABLE_SIZE; probe++) {
+		TgcAllocationSamplingExtensions::SampleEntry *entry = &samplingExtensions->table[((hash >> 3) + probe) & (TGC_ALLOCATION_SAMPLE_TABLE_SIZE - 1)];
+		if (TGC_ALLOCATION_SAMPLE_ENTRY_EMPTY == entry->state) {
+			if (TGC_ALLOCATION_SAMPLE_ENTRY_EMPTY == MM_AtomicOperations::lockCompareExchange(&entry->state, TGC_ALLOCATION_SAMPLE_ENTRY_EMPTY, TGC_ALLOCATION_SAMPLE_ENTRY_CLAIMED)) {
+				entry->clazz = event->clazz;
+				memcpy(entry->frames, frames, sizeof(frames));
+				entry->sampleCount = 1;
+				entry->sampledBytes = event->objectSize;
+				MM_AtomicOperations::writeBarrier();
+				entry->state = TGC_ALLOCATION_SAMPLE_ENTRY_PUBLISHED;
+				return;
+			}
+		}
+		if (tgcAllocationSamplingEntryMatches(entry, event->clazz, frames)) {
+			MM_AtomicOperations::add(&entry->sampleCount, 1);
+			MM_AtomicOperations::add(&entry->sampledBytes, event->objectSize);
+			return;
+		}
+	}
+	MM_AtomicOperations::add(&samplingExtensions->droppedSamples, 1);
+}
+
+/**
+ * Print the heaviest allocation sites recorded since the previous dump and reset the table.
+ * Called at the start of a collection, while exclusive access is held, so no allocating thread can be
+ * updating the table and every recorded class is still alive.
+ */
+static void
+tgcAllocationSamplingPrintStats(OMR_VMThread* omrVMThread)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(omrVMThread);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+	TgcAllocationSamplingExtensions *samplingExtensions = &tgcExtensions->_allocationSampling;
+	J9JavaVM *javaVM = (J9JavaVM *)omrVMThread->_vm->_language_vm;
+	TgcAllocationSamplingExtensions::SampleEntry *table = samplingExtensions->table;
+	UDATA totalSamples = 0;
+
+	for (UDATA i = 0; i < TGC_ALLOCATION_SAMPLE_TABLE_SIZE; i++) {
+		if (TGC_ALLOCATION_SAMPLE_ENTRY_PUBLISHED == table[i].state) {
+			totalSamples += table[i].sampleCount;
+		}
+	}
+
+	tgcExtensions->printf("---------- Sampled Allocation Sites ----------\n");
+	tgcExtensions->printf("Sampling granularity: %zu bytes, samples: %zu, dropped: %zu\n",
+		extensions->oolObjectSamplingBytesGranularity, totalSamples, samplingExtensions->droppedSamples);
+
+	/* report the entries with the most samples, selecting (and then retiring) the heaviest remaining entry each pass */
+	for (UDATA rank = 0; rank < TGC_ALLOCATION_SAMPLE_REPORT_COUNT; rank++) {
+		TgcAllocationSamplingExtensions::SampleEntry *heaviest = NULL;
+		for (UDATA i = 0; i < TGC_ALLOCATION_SAMPLE_TABLE_SIZE; i++) {
+			if ((TGC_ALLOCATION_SAMPLE_ENTRY_PUBLISHED == table[i].state) && ((NULL == heaviest) || (table[i].sampleCount > heaviest->sampleCount))) {
+				heaviest = &table[i];
+			}
+		}
+		if (NULL == heaviest) {
+			break;
+		}
+
+		tgcExtensions->printf("%3zu: %8zu samples %12zu sampled bytes %14zu estimated bytes  ",
+			rank + 1, heaviest->sampleCount, heaviest->sampledBytes, heaviest->sampleCount * extensions->oolObjectSamplingBytesGranularity);
+		tgcPrintClass(javaVM, heaviest->clazz);
+		tgcExtensions->printf("\n");
+		for (UDATA frame = 0; (frame < TGC_ALLOCATION_SAMPLE_FRAMES) && (NULL != heaviest->frames[frame]); frame++) {
+			J9Method *method = heaviest->frames[frame];
+			J9UTF8 *className = J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(method)->romClass);
+			J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+			J9UTF8 *methodName = J9ROMMETHOD_NAME(romMethod);
+			J9UTF8 *methodSignature = J9ROMMETHOD_SIGNATURE(romMethod);
+			tgcExtensions->printf("         at %.*s.%.*s%.*s\n",
+				(U_32)J9UTF8_LENGTH(className), J9UTF8_DATA(className),
+				(U_32)J9UTF8_LENGTH(methodName), J9UTF8_DATA(methodName),
+				(U_32)J9UTF8_LENGTH(methodSignature), J9UTF8_DATA(methodSignature));
+		}
+		heaviest->state = TGC_ALLOCATION_SAMPLE_ENTRY_CLAIMED;
+	}
+
+	memset((void *)table, 0, TGC_ALLOCATION_SAMPLE_TABLE_SIZE * sizeof(TgcAllocationSamplingExtensions::SampleEntry));
+	samplingExtensions->droppedSamples = 0;
+}
+
+static void
+tgcHookAllocationSamplingGlobalPrintStats(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_GlobalGCStartEvent* event = (MM_GlobalGCStartEvent*)eventData;
+	tgcAllocationSamplingPrintStats(event->currentThread);
+}
+
+static void
+tgcHookAllocationSamplingLocalPrintStats(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_LocalGCStartEvent* event = (MM_LocalGCStartEvent*)eventData;
+	tgcAllocationSamplingPrintStats(event->currentThread);
+}
+
+/**
+ * Initialize sampled allocation tgc tracing.
+ * Enables out of line allocation sampling (the interval is set by -Xgc:allocationSamplingGranularity) and
+ * aggregates every sample into a table which is reported and reset at the start of each collection.
+ */
+bool
+tgcAllocationSamplingInitialize(J9JavaVM *javaVM)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+	TgcAllocationSamplingExtensions *samplingExtensions = &tgcExtensions->_allocationSampling;
+	UDATA tableSize = TGC_ALLOCATION_SAMPLE_TABLE_SIZE * sizeof(TgcAllocationSamplingExtensions::SampleEntry);
+	bool result = false;
+
+	samplingExtensions->droppedSamples = 0;
+	samplingExtensions->table = (TgcAllocationSamplingExtensions::SampleEntry *)extensions->getForge()->allocate(tableSize, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != samplingExtensions->table) {
+		memset((void *)samplingExtensions->table, 0, tableSize);
+		extensions->doOutOfLineAllocationTrace = true;
+
+		J9HookInterface** mmHooks = J9_HOOK_INTERFACE(extensions->hookInterface);
+		J9HookInterface** omrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+		(*mmHooks)->J9HookRegisterWithCallSite(mmHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, tgcHookAllocationSample, OMR_GET_CALLSITE(), NULL);
+		(*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, tgcHookAllocationSamplingGlobalPrintStats, OMR_GET_CALLSITE(), NULL);
+		(*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, tgcHookAllocationSamplingLocalPrintStats, OMR_GET_CALLSITE(), NULL);
+		result = true;
+	}
+
+	return result;
+}
+
+void
+tgcAllocationSamplingTearDown(J9JavaVM *javaVM)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+
+	if (NULL != tgcExtensions->_allocationSampling.table) {
+		extensions->getForge()->free((void *)tgcExtensions->_allocationSampling.table);
+		tgcExtensions->_allocationSampling.table = NULL;
+	}
+}
@@ -23,6 +23,28 @@
 #if !defined(TGCALLOCATION_HPP_)
 #define TGCALLOCATION_HPP_
 
+#define TGC_ALLOCATION_SAMPLE_TABLE_SIZE 4096 /**< Number of entries in the allocation sample table (must be a power of 2) */
+#define TGC_ALLOCATION_SAMPLE_FRAMES 4 /**< Number of allocating stack frames recorded with each sample */
+#define TGC_ALLOCATION_SAMPLE_REPORT_COUNT 20 /**< Number of entries reported in each allocation sample dump */
+
+/**
+ * Structure holding information relating to tgc tracing for sampled allocations.
+ * Samples are aggregated by class and allocating stack into a fixed size open addressing table.
+ * Entries are claimed with an atomic compare and swap so that allocating threads never take a lock.
+ */
+typedef struct TgcAllocationSamplingExtensions {
+	struct SampleEntry {
+		volatile UDATA state; /**< one of the TGC_ALLOCATION_SAMPLE_ENTRY_* states */
+		J9Class *clazz; /**< class of the sampled objects */
+		J9Method *frames[TGC_ALLOCATION_SAMPLE_FRAMES]; /**< allocating stack, innermost frame first, NULL terminated if shorter */
+		volatile UDATA sampleCount; /**< number of samples which hit this entry */
+		volatile UDATA sampledBytes; /**< total size of the sampled objects */
+	} *table;
+	volatile UDATA droppedSamples; /**< samples which could not be recorded because the table was full */
+} TgcAllocationSamplingExtensions;
+
 bool tgcAllocationInitialize(J9JavaVM *javaVM);
+bool tgcAllocationSamplingInitialize(J9JavaVM *javaVM);
+void tgcAllocationSamplingTearDown(J9JavaVM *javaVM);
 
 #endif /* TGCALLOCATION_HPP_ */
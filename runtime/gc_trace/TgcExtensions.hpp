@@ -97,6 +97,7 @@ protected:
 public:
 	/* data used to save parsed requests whatever are compatible with GC policy or not */
 	bool _allocationRequested; /**< true if "allocation" option is parsed */
+	bool _allocationSamplingRequested; /**< true if "allocationSampling" option is parsed */
 	bool _largeAllocationRequested; /**< true if "largeAllocation" option is parsed */
 	bool _largeAllocationVerboseRequested; /**< true if "_largeAllocationVerboseRequested" option is parsed */
 	bool _backtraceRequested; /**< true if "backtrace" option is parsed */
@@ -127,6 +128,7 @@ public:
 	bool _interRegionReferencesRequested; /**< true if "interRegionReferences" option is parsed */
 	bool _sizeClassesRequested; /**< true if "sizeClasses" option is parsed */
 
+	TgcAllocationSamplingExtensions _allocationSampling;
 	TgcBacktraceExtensions _backtrace;
 	TgcDumpExtensions _dump;
 	TgcExclusiveAccessExtensions _exclusiveAccess;
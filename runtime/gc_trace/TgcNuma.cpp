@@ -28,11 +28,13 @@
 #include "mmhook.h"
 
 #if defined(J9VM_GC_VLHGC)
+#include "CopyForwardStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "Heap.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionDescriptor.hpp"
+#include "MarkVLHGCStats.hpp"
 #include "TgcExtensions.hpp"
 #include "VMThreadListIterator.hpp"
 
@@ -118,6 +120,54 @@ tgcHookReportNumaStatistics(J9HookInterface** hook, UDATA eventNum, void* eventD
 }
 
 
+/**
+ * Print the node-local, common (no affinity) and remote units of work processed during a phase.
+ */
+static void
+tgcNumaPrintLocality(MM_TgcExtensions *tgcExtensions, const char *phase, const char *unit, UDATA local, UDATA common, UDATA remote)
+{
+	/* work without NUMA affinity is neither local nor remote, so it is left out of the ratio */
+	UDATA total = local + remote;
+	UDATA localPercent = (0 == total) ? 100 : ((local * 100) / total);
+	tgcExtensions->printf("NUMA %s: %zu node-local %s, %zu common %s, %zu remote %s (%zu%% local)\n", phase, local, unit, common, unit, remote, unit, localPercent);
+}
+
+/**
+ * Report NUMA locality of copy-forward scan cache distribution
+ */
+static void
+tgcHookReportNumaCopyForwardLocality(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_CopyForwardEndEvent* event = (MM_CopyForwardEndEvent*)eventData;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(event->currentThread);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+	MM_CopyForwardStats *copyForwardStats = (MM_CopyForwardStats *)event->copyForwardStats;
+
+	tgcNumaPrintLocality(tgcExtensions, "copy-forward", "scan caches", copyForwardStats->_numaLocalScanCacheCount, copyForwardStats->_numaCommonScanCacheCount, copyForwardStats->_numaRemoteScanCacheCount);
+}
+
+/**
+ * Report NUMA locality of objects scanned from work packets during global marking
+ */
+static void
+tgcHookReportNumaMarkLocality(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_MarkVLHGCStats *markStats = NULL;
+	MM_GCExtensions *extensions = NULL;
+
+	if (J9HOOK_MM_PRIVATE_GMP_MARK_END == eventNum) {
+		MM_GMPMarkEndEvent* event = (MM_GMPMarkEndEvent*)eventData;
+		extensions = MM_GCExtensions::getExtensions(event->currentThread);
+		markStats = (MM_MarkVLHGCStats *)event->markStats;
+	} else {
+		MM_VLHGCGlobalGCMarkEndEvent* event = (MM_VLHGCGlobalGCMarkEndEvent*)eventData;
+		extensions = MM_GCExtensions::getExtensions(event->currentThread);
+		markStats = (MM_MarkVLHGCStats *)event->markStats;
+	}
+
+	tgcNumaPrintLocality(MM_TgcExtensions::getExtensions(extensions), "global mark", "objects", markStats->_numaLocalObjectsScanned, markStats->_numaCommonObjectsScanned, markStats->_numaRemoteObjectsScanned);
+}
+
 /**
  * Initialize NUMA tgc tracing.
  * Attaches hooks to the appropriate functions handling events used by NUMA tgc tracing.
@@ -137,6 +187,15 @@ tgcNumaInitialize(J9JavaVM *javaVM)
 	(*hooks)->J9HookRegisterWithCallSite(hooks, J9HOOK_MM_OMR_LOCAL_GC_START, tgcHookReportNumaStatistics, OMR_GET_CALLSITE(), NULL);
 	(*hooks)->J9HookRegisterWithCallSite(hooks, J9HOOK_MM_OMR_LOCAL_GC_END, tgcHookReportNumaStatistics, OMR_GET_CALLSITE(), NULL);
 
+	if (extensions->_numaManager.isPhysicalNUMASupported()) {
+		extensions->numaLocalityStatsEnabled = true;
+
+		J9HookInterface** privateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+		(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, tgcHookReportNumaCopyForwardLocality, OMR_GET_CALLSITE(), NULL);
+		(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_GMP_MARK_END, tgcHookReportNumaMarkLocality, OMR_GET_CALLSITE(), NULL);
+		(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_VLHGC_GLOBAL_GC_MARK_END, tgcHookReportNumaMarkLocality, OMR_GET_CALLSITE(), NULL);
+	}
+
 	return result;
 }
 
@@ -26,6 +26,9 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "Heap.hpp"
+#include "Scheduler.hpp"
+#include "UtilizationController.hpp"
+#include "UtilizationTracker.hpp"
 #include "VerboseHandlerRealtime.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -104,6 +107,7 @@ MM_VerboseHandlerOutputRealtime::enableVerbose()
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_OUT_OF_MEMORY, verboseHandlerOutOFMemory, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_UTILIZATION_TRACKER_OVERFLOW, verboseHandlerUtilTrackerOverflow, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_NON_MONOTONIC_TIME, verboseHandlerNonMonotonicTime, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_UTILIZATION_CONTROLLER_DECISION, verboseHandlerUtilizationControllerDecision, OMR_GET_CALLSITE(), (void *)this);
 }
 
 void
@@ -140,6 +144,7 @@ MM_VerboseHandlerOutputRealtime::disableVerbose()
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_OUT_OF_MEMORY, verboseHandlerOutOFMemory, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_UTILIZATION_TRACKER_OVERFLOW, verboseHandlerUtilTrackerOverflow, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_NON_MONOTONIC_TIME, verboseHandlerNonMonotonicTime, NULL);
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_UTILIZATION_CONTROLLER_DECISION, verboseHandlerUtilizationControllerDecision, NULL);
 }
 
 bool
@@ -324,6 +329,26 @@ MM_VerboseHandlerOutputRealtime::writeHeartbeatData(MM_EnvironmentBase* env, U_6
 			_minStartPriority
 		);
 
+		MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+		if (extensions->dynamicTargetUtilization) {
+			MM_Scheduler *scheduler = (MM_Scheduler *)extensions->dispatcher;
+			MM_UtilizationController *controller = scheduler->_utilController;
+			U_64 maxQuantumTime = scheduler->_utilTracker->getMaxGCSlice() / 1000;
+			U_64 previousCycleGCTime = controller->getPreviousCycleGCTimeInNanos() / 1000;
+			writer->formatAndOutput(
+				env, 1 /*indent*/,
+				"<utilization-controller targetUtilization=\"%zu\" safeUtilization=\"%zu\" maxQuantumMs=\"%llu.%03.3llu\" allocationRateKBps=\"%zu\" previousCycleGCTimeMs=\"%llu.%03.3llu\" synchronousFallbacks=\"%zu\" />",
+				(UDATA)(scheduler->_utilTracker->getTargetUtilization() * 100),
+				(UDATA)(controller->getSafeUtilization() * 100),
+				maxQuantumTime / 1000,
+				maxQuantumTime % 1000,
+				(UDATA)(controller->getAllocationRate() / 1024),
+				previousCycleGCTime / 1000,
+				previousCycleGCTime % 1000,
+				controller->getSynchronousFallbackCount()
+			);
+		}
+
 		writer->formatAndOutput(env, 0, "</gc-op>");
 		writer->flush(env);
 		exitAtomicReportingBlock();
@@ -617,3 +642,41 @@ MM_VerboseHandlerOutputRealtime::handleEvent(MM_NonMonotonicTimeEvent* eventData
 	writer->flush(env);
 	exitAtomicReportingBlock();
 }
+
+void
+MM_VerboseHandlerOutputRealtime::handleEvent(MM_UtilizationControllerDecisionEvent* eventData)
+{
+	/* one element per GC increment, written between the heartbeats without flushing their accumulated stats */
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(eventData->currentThread->omrVMThread);
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	const char *decision = "adjusted";
+	if (MM_UtilizationController::DECISION_NO_DATA == eventData->decision) {
+		decision = "nodata";
+	} else if (MM_UtilizationController::DECISION_SYNCHRONOUS == eventData->decision) {
+		decision = "synchronous";
+	}
+	char tagTemplate[200];
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(), j9time_current_time_millis());
+
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(
+		env, 0 /*indent*/,
+		"<utilization-decision %s decision=\"%s\" targetUtilizationBefore=\"%zu\" targetUtilization=\"%zu\" safeUtilization=\"%zu\""
+		" maxQuantumBeforeMs=\"%llu.%03.3llu\" maxQuantumMs=\"%llu.%03.3llu\" allocationRateKBps=\"%llu\" freeBytes=\"%zu\" remainingWorkMs=\"%llu.%03.3llu\" />",
+		tagTemplate,
+		decision,
+		eventData->targetUtilizationBefore,
+		eventData->targetUtilization,
+		eventData->safeUtilization,
+		eventData->maxGCSliceBefore / 1000,
+		eventData->maxGCSliceBefore % 1000,
+		eventData->maxGCSlice / 1000,
+		eventData->maxGCSlice % 1000,
+		eventData->allocationRate / 1024,
+		eventData->freeMemory,
+		eventData->remainingWork / 1000,
+		eventData->remainingWork % 1000
+	);
+	exitAtomicReportingBlock();
+}
@@ -267,6 +267,7 @@ public:
 	void handleEvent(MM_OutOfMemoryEvent* eventData);
 	void handleEvent(MM_UtilizationTrackerOverflowEvent* eventData);
 	void handleEvent(MM_NonMonotonicTimeEvent* eventData);
+	void handleEvent(MM_UtilizationControllerDecisionEvent* eventData);
 
 	void writeHeartbeatData(MM_EnvironmentBase* env, U_64 timestamp);
 	void writeHeartbeatDataAndResetHeartbeatStats(MM_EnvironmentBase* env, U_64 timestamp);
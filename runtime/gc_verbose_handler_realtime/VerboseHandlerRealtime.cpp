@@ -161,3 +161,10 @@ void verboseHandlerNonMonotonicTime(J9HookInterface** hook, UDATA eventNum, void
 	MM_VerboseHandlerOutputRealtime* handler = (MM_VerboseHandlerOutputRealtime*)userData;
 	handler->handleEvent(event);
 }
+
+void verboseHandlerUtilizationControllerDecision(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_UtilizationControllerDecisionEvent* event = (MM_UtilizationControllerDecisionEvent*) eventData;
+	MM_VerboseHandlerOutputRealtime* handler = (MM_VerboseHandlerOutputRealtime*)userData;
+	handler->handleEvent(event);
+}
@@ -61,4 +61,6 @@ void verboseHandlerUtilTrackerOverflow(J9HookInterface** hook, UDATA eventNum, v
 
 void verboseHandlerNonMonotonicTime(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 
+void verboseHandlerUtilizationControllerDecision(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+
 #endif /* VERBOSEHANDLERREALTIME_HPP_ */
@@ -26,7 +26,9 @@
 #include "mmhook.h"
 #include "gcutils.h"
 
+#include "ClassLoaderManager.hpp"
 #include "CollectionStatisticsStandard.hpp"
+#include "ConcurrentClassUnloadStats.hpp"
 #include "ConcurrentGCStats.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
@@ -41,6 +43,9 @@
 static void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 static void verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+static void verboseHandlerMemoryPressureReliefEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandardJava::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -90,6 +95,9 @@ MM_VerboseHandlerOutputStandardJava::enableVerbose()
 	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookRegisterWithCallSite(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, OMR_GET_CALLSITE(), (void *)this);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_MEMORY_PRESSURE_RELIEF_END, verboseHandlerMemoryPressureReliefEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -102,6 +110,9 @@ MM_VerboseHandlerOutputStandardJava::disableVerbose()
 	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, NULL);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookUnregister(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, NULL);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_MEMORY_PRESSURE_RELIEF_END, verboseHandlerMemoryPressureReliefEnd, NULL);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -188,6 +199,24 @@ MM_VerboseHandlerOutputStandardJava::handleSlowExclusive(J9HookInterface **hook,
 
 }
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerOutputStandardJava::handleMemoryPressureReliefEnd(J9HookInterface** hook, UDATA eventNum, void* eventData)
+{
+	MM_MemoryPressureReliefEndEvent* event = (MM_MemoryPressureReliefEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+	MM_VerboseManager* manager = getManager();
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	char tagTemplate[200];
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), j9time_current_time_millis());
+	enterAtomicReportingBlock();
+	MM_VerboseHandlerJava::outputMemoryPressureRelief(manager, env, tagTemplate, event);
+	manager->getWriterChain()->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 void
 MM_VerboseHandlerOutputStandardJava::handleClassUnloadEnd(J9HookInterface** hook, UDATA eventNum, void* eventData)
@@ -220,6 +249,20 @@ MM_VerboseHandlerOutputStandardJava::handleClassUnloadEnd(J9HookInterface** hook
 			scanTime / 1000, scanTime % 1000,
 			postTime / 1000, postTime % 1000);
 
+	if (extensions->concurrentClassUnloading) {
+		/* only the freeing of undead class segments runs on the concurrent class unloading thread, the phases above are all
+		 * done in the pause; report the segments it freed since the previous report
+		 */
+		MM_ConcurrentClassUnloadStats concurrentStats;
+		extensions->classLoaderManager->consumeConcurrentClassUnloadStats(&concurrentStats);
+		writer->formatAndOutput(
+				env, 1,
+				"<classunload-concurrent-segmentfree segmentsfreed=\"%zu\" bytesfreed=\"%zu\" timems=\"%llu.%03.3llu\" />",
+				concurrentStats._segmentsFreed,
+				concurrentStats._bytesFreed,
+				concurrentStats._segmentTime / 1000, concurrentStats._segmentTime % 1000);
+	}
+
 	handleGCOPOuterStanzaEnd(env);
 	writer->flush(env);
 	exitAtomicReportingBlock();
@@ -326,3 +369,11 @@ verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventD
 {
 	((MM_VerboseHandlerOutputStandardJava *)userData)->handleSlowExclusive(hook, eventNum, eventData);
 }
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+verboseHandlerMemoryPressureReliefEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandardJava *)userData)->handleMemoryPressureReliefEnd(hook, eventNum, eventData);
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
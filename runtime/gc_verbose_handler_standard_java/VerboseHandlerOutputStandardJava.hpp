@@ -116,6 +116,16 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData);
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Write verbose stanza for the heap being shrunk because of memory pressure.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleMemoryPressureReliefEnd(J9HookInterface** hook, UDATA eventNum, void* eventData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 };
 
 #endif /* VERBOSEHANDLEROUTPUTSTANDARDJAVA_HPP_ */
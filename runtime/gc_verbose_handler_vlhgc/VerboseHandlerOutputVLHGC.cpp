@@ -66,6 +66,9 @@ static void verboseHandlerReclaimCompactEnd(J9HookInterface** hook, UDATA eventN
 static void verboseHandlerExcessiveGCRaised(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerAcquiredExclusiveToSatisfyAllocation(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+static void verboseHandlerMemoryPressureReliefEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputVLHGC::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -156,6 +159,9 @@ MM_VerboseHandlerOutputVLHGC::enableVerbose()
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_MEMORY_PRESSURE_RELIEF_END, verboseHandlerMemoryPressureReliefEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 }
 
 void
@@ -215,6 +221,9 @@ MM_VerboseHandlerOutputVLHGC::disableVerbose()
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, NULL);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_MEMORY_PRESSURE_RELIEF_END, verboseHandlerMemoryPressureReliefEnd, NULL);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 }
 
 bool
@@ -360,6 +369,16 @@ MM_VerboseHandlerOutputVLHGC::outputRememberedSetClearedInfo(MM_EnvironmentBase
 			irrsStats->_clearFromRegionReferencesTimesus / 1000, irrsStats->_clearFromRegionReferencesTimesus % 1000);
 }
 
+void
+MM_VerboseHandlerOutputVLHGC::outputGCThreadInfo(MM_EnvironmentBase *env, UDATA indent, MM_GCThreadCountAdvisor::Phase phase)
+{
+	MM_GCThreadCountAdvisor *threadCountAdvisor = MM_GCExtensions::getExtensions(env)->gcThreadCountAdvisor;
+	if (NULL != threadCountAdvisor) {
+		_manager->getWriterChain()->formatAndOutput(env, indent, "<gc-threads active=\"%zu\" maximum=\"%zu\" scanbytes=\"%zu\" />",
+				threadCountAdvisor->getLastThreadCount(phase), threadCountAdvisor->getMaximumThreadCount(), threadCountAdvisor->getLastWork(phase));
+	}
+}
+
 void
 MM_VerboseHandlerOutputVLHGC::handleCopyForwardStart(J9HookInterface** hook, UDATA eventNum, void* eventData)
 {
@@ -387,6 +406,7 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 	}	
 	writer->formatAndOutput(env, 0, "<gc-op %s>", tagTemplate);
 
+	outputGCThreadInfo(env, 1, MM_GCThreadCountAdvisor::phase_copyForward);
 	writer->formatAndOutput(env, 1, "<memory-copied type=\"eden\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				copyForwardStats->_copyObjectsEden, copyForwardStats->_copyBytesEden, copyForwardStats->_copyDiscardBytesEden);
 	writer->formatAndOutput(env, 1, "<memory-copied type=\"other\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
@@ -403,10 +423,10 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 		writer->formatAndOutput(env, 1, "<regions eden=\"%zu\" other=\"%zu\" />",
 				copyForwardStats->_edenEvacuateRegionCount, copyForwardStats->_nonEdenEvacuateRegionCount);
 	} else {
-		writer->formatAndOutput(env, 1, "<regions eden=\"%zu\" other=\"%zu\" evacuated=\"%zu\" marked=\"%zu\" />",
+		writer->formatAndOutput(env, 1, "<regions eden=\"%zu\" other=\"%zu\" evacuated=\"%zu\" marked=\"%zu\" pinned=\"%zu\" />",
 				copyForwardStats->_edenEvacuateRegionCount, copyForwardStats->_nonEdenEvacuateRegionCount,
 				(copyForwardStats->_edenEvacuateRegionCount + copyForwardStats->_nonEdenEvacuateRegionCount - copyForwardStats->_nonEvacuateRegionCount),
-				copyForwardStats->_nonEvacuateRegionCount);
+				copyForwardStats->_nonEvacuateRegionCount, copyForwardStats->_pinnedRegionCount);
 	}
 	outputRememberedSetClearedInfo(env, irrsStats);
 
@@ -496,7 +516,7 @@ MM_VerboseHandlerOutputVLHGC::handleGMPMarkEnd(J9HookInterface** hook, UDATA eve
 	MM_MarkVLHGCStats *markStats = (MM_MarkVLHGCStats *)event->markStats;
 	MM_WorkPacketStats *workPacketStats = (MM_WorkPacketStats *)event->workPacketStats;
 
-	outputMarkSummary(env, "mark increment", markStats, workPacketStats, NULL);
+	outputMarkSummary(env, "mark increment", markStats, workPacketStats, NULL, MM_GCThreadCountAdvisor::phase_count);
 }
 
 void
@@ -513,7 +533,7 @@ MM_VerboseHandlerOutputVLHGC::handleGlobalGCMarkEnd(J9HookInterface** hook, UDAT
 	MM_MarkVLHGCStats *markStats = (MM_MarkVLHGCStats *)event->markStats;
 	MM_WorkPacketStats *workPacketStats = (MM_WorkPacketStats *)event->workPacketStats;
 
-	outputMarkSummary(env, "global mark", markStats, workPacketStats, NULL);
+	outputMarkSummary(env, "global mark", markStats, workPacketStats, NULL, MM_GCThreadCountAdvisor::phase_globalMark);
 }
 
 void
@@ -531,11 +551,11 @@ MM_VerboseHandlerOutputVLHGC::handlePGCMarkEnd(J9HookInterface** hook, UDATA eve
 	MM_WorkPacketStats *workPacketStats = (MM_WorkPacketStats *)event->workPacketStats;
 	MM_InterRegionRememberedSetStats *irrsStats = (MM_InterRegionRememberedSetStats *)event->irrsStats;
 
-	outputMarkSummary(env, "mark", markStats, workPacketStats, irrsStats);
+	outputMarkSummary(env, "mark", markStats, workPacketStats, irrsStats, MM_GCThreadCountAdvisor::phase_partialMark);
 }
 
 void
-MM_VerboseHandlerOutputVLHGC::outputMarkSummary(MM_EnvironmentBase *env, const char *markType, MM_MarkVLHGCStats *markStats, MM_WorkPacketStats *workPacketStats, MM_InterRegionRememberedSetStats *irrsStats)
+MM_VerboseHandlerOutputVLHGC::outputMarkSummary(MM_EnvironmentBase *env, const char *markType, MM_MarkVLHGCStats *markStats, MM_WorkPacketStats *workPacketStats, MM_InterRegionRememberedSetStats *irrsStats, MM_GCThreadCountAdvisor::Phase threadCountPhase)
 {
 	MM_VerboseWriterChain* writer = _manager->getWriterChain();
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
@@ -553,6 +573,9 @@ MM_VerboseHandlerOutputVLHGC::outputMarkSummary(MM_EnvironmentBase *env, const c
 	}	
 	writer->formatAndOutput(env, 0, "<gc-op %s>", tagTemplate);
 
+	if (MM_GCThreadCountAdvisor::phase_count != threadCountPhase) {
+		outputGCThreadInfo(env, 1, threadCountPhase);
+	}
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 		markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
 
@@ -721,6 +744,23 @@ MM_VerboseHandlerOutputVLHGC::handleClassUnloadEnd(J9HookInterface** hook, UDATA
 	exitAtomicReportingBlock();
 }
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerOutputVLHGC::handleMemoryPressureReliefEnd(J9HookInterface** hook, UDATA eventNum, void* eventData)
+{
+	MM_MemoryPressureReliefEndEvent* event = (MM_MemoryPressureReliefEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	char tagTemplate[200];
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), j9time_current_time_millis());
+	enterAtomicReportingBlock();
+	MM_VerboseHandlerJava::outputMemoryPressureRelief(_manager, env, tagTemplate, event);
+	_manager->getWriterChain()->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 const char *
 MM_VerboseHandlerOutputVLHGC::getCycleType(UDATA type)
 {
@@ -924,3 +964,10 @@ void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, voi
 }
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void verboseHandlerMemoryPressureReliefEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputVLHGC *)userData)->handleMemoryPressureReliefEnd(hook, eventNum, eventData);
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
@@ -29,6 +29,7 @@
 #include "VerboseHandlerOutput.hpp"
 
 #include "GCExtensions.hpp"
+#include "GCThreadCountAdvisor.hpp"
 
 class MM_EnvironmentBase;
 class MM_InterRegionRememberedSetStats;
@@ -81,8 +82,9 @@ private:
 	 * @param markType String name representation of the mark type.
 	 * @param markStats mark stats used for summary.
 	 * @param workPacketStats work packet stats used for summary.
+	 * @param threadCountPhase phase of the GC thread count advisor which sized the mark (phase_count if none did).
 	 */
-	void outputMarkSummary(MM_EnvironmentBase *env, const char *markType, MM_MarkVLHGCStats *markStats, MM_WorkPacketStats *workPacketStats, MM_InterRegionRememberedSetStats *irrsStats);
+	void outputMarkSummary(MM_EnvironmentBase *env, const char *markType, MM_MarkVLHGCStats *markStats, MM_WorkPacketStats *workPacketStats, MM_InterRegionRememberedSetStats *irrsStats, MM_GCThreadCountAdvisor::Phase threadCountPhase);
 
 	/**
 	 * Output info on remembered set clearing (from-CS-region clearing pass)
@@ -91,6 +93,14 @@ private:
 	 */
 	void outputRememberedSetClearedInfo(MM_EnvironmentBase *env, MM_InterRegionRememberedSetStats *irrsStats);
 
+	/**
+	 * Output the number of GC threads the thread count advisor chose for a phase, if adaptive thread count is enabled.
+	 * @param env GC thread performing output.
+	 * @param indent the indentation of the stanza.
+	 * @param phase the phase which was dispatched.
+	 */
+	void outputGCThreadInfo(MM_EnvironmentBase *env, UDATA indent, MM_GCThreadCountAdvisor::Phase phase);
+
 
 protected:
 	virtual void handleInitializedInnerStanzas(J9HookInterface** hook, UDATA eventNum, void* eventData);
@@ -246,6 +256,16 @@ public:
 	 */
 	void handleClassUnloadEnd(J9HookInterface** hook, UDATA eventNum, void* eventData);
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Write verbose stanza for the heap being shrunk because of memory pressure.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleMemoryPressureReliefEnd(J9HookInterface** hook, UDATA eventNum, void* eventData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 	virtual void enableVerbose();
 	virtual void disableVerbose();
 
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_H_)
+#define VERBOSEBINARYFORMAT_H_
+
+/*
+ * Layout of the memory mapped ring file written by MM_VerboseWriterFileRing and read by gcvrbdecode.
+ *
+ * The file starts with a J9VerboseBinaryHeader, followed by an append-only string table of
+ * NUL terminated templates and then a ring of fixed size J9VerboseBinaryRecord slots.
+ *
+ * Each piece of verbose output is stored as a template (the text with every number replaced
+ * by a placeholder) plus the numbers themselves. Templates repeat from one GC to the next, so
+ * they are written to the string table once and every later occurrence costs a single record.
+ * Output which cannot be templated (the string table is full or the text is too long) is stored
+ * as literal text split across continuation records.
+ *
+ * The string table never wraps, so any record left in the ring can always be decoded.
+ */
+
+#include "j9comp.h"
+
+#define J9VGC_BINARY_MAGIC 0x4A395652 /* "J9VR" */
+#define J9VGC_BINARY_VERSION 1
+
+#define J9VGC_BINARY_DEFAULT_FILE_SIZE (64 * 1024 * 1024)
+#define J9VGC_BINARY_MINIMUM_FILE_SIZE (64 * 1024)
+#define J9VGC_BINARY_STRING_TABLE_FRACTION 8 /* 1/8th of the file is reserved for the string table */
+#define J9VGC_BINARY_MAX_TEMPLATE_LENGTH 1024
+
+#define J9VGC_BINARY_RECORD_VALUES 6
+#define J9VGC_BINARY_LITERAL_TEMPLATE ((U_32)0xFFFFFFFF)
+
+/* record flags */
+#define J9VGC_BINARY_RECORD_CONTINUED 0x1 /* the next record holds more values (or text) for the same output */
+#define J9VGC_BINARY_RECORD_CONTINUATION 0x2 /* this record holds more values (or text) for the output started in the previous record */
+
+/*
+ * Placeholders used in templates. Each is followed by one byte holding the number of digits
+ * the value was printed with, so leading zeros and hex digit case are reproduced exactly.
+ */
+#define J9VGC_BINARY_PLACEHOLDER_DECIMAL '\001'
+#define J9VGC_BINARY_PLACEHOLDER_HEX_UPPER '\002'
+#define J9VGC_BINARY_PLACEHOLDER_HEX_LOWER '\003'
+
+typedef struct J9VerboseBinaryHeader {
+	U_32 magic;
+	U_32 version;
+	U_64 fileSize;
+	U_64 stringTableOffset; /**< file offset of the first template */
+	U_64 stringTableSize; /**< bytes reserved for templates */
+	volatile U_64 stringTableUsed; /**< bytes of the string table holding complete templates */
+	volatile U_64 stringCount; /**< number of templates in the string table */
+	U_64 recordsOffset; /**< file offset of the first record slot */
+	U_64 recordCount; /**< number of record slots in the ring */
+	volatile U_64 nextSequence; /**< sequence number the next record will be written with */
+	U_64 lostRecords; /**< records which could not be written (e.g. a single output larger than the ring) */
+} J9VerboseBinaryHeader;
+
+typedef struct J9VerboseBinaryRecord {
+	volatile U_64 sequence; /**< sequence number + 1 of the record held in this slot, written last; 0 if the slot is unused */
+	U_32 templateIndex; /**< index of the template in the string table, or J9VGC_BINARY_LITERAL_TEMPLATE */
+	U_16 valueCount; /**< number of values used (or bytes of text for literal records) */
+	U_8 flags; /**< J9VGC_BINARY_RECORD_* flags */
+	U_8 reserved;
+	union {
+		U_64 values[J9VGC_BINARY_RECORD_VALUES];
+		char text[J9VGC_BINARY_RECORD_VALUES * sizeof(U_64)];
+	} data;
+} J9VerboseBinaryRecord;
+
+#endif /* VERBOSEBINARYFORMAT_H_ */
@@ -50,6 +50,23 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	}
 }
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerJava::outputMemoryPressureRelief(MM_VerboseManager *manager, MM_EnvironmentBase *env, const char *tagTemplate, MM_MemoryPressureReliefEndEvent *event)
+{
+	UDATA reclaimed = 0;
+	if (event->heapSizeBefore > event->heapSizeAfter) {
+		reclaimed = event->heapSizeBefore - event->heapSizeAfter;
+	}
+
+	manager->getWriterChain()->formatAndOutput(
+			env, 0,
+			"<memory-pressure-relief id=\"%zu\" %s reason=\"%s\" memoryused=\"%llu\" memorylimit=\"%llu\" heapsizebefore=\"%zu\" heapsizeafter=\"%zu\" reclaimed=\"%zu\" softmx=\"%zu\" />",
+			manager->getIdAndIncrement(), tagTemplate, event->reason, event->memoryUsed, event->memoryLimit,
+			event->heapSizeBefore, event->heapSizeAfter, reclaimed, event->softMx);
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 bool
 MM_VerboseHandlerJava::getThreadName(char *buf, UDATA bufLen, OMR_VMThread *omrThread)
 {
@@ -52,6 +52,17 @@ public:
 	 * Output Java VM arguments.
 	 */
 	static void writeVmArgs(MM_VerboseManager *manager, MM_EnvironmentBase* env, J9JavaVM *vm);
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Output the memory-pressure-relief stanza for a J9HOOK_MM_MEMORY_PRESSURE_RELIEF_END event.
+	 * @param manager
+	 * @param env thread used for output.
+	 * @param tagTemplate the common attributes of the stanza.
+	 * @param event the hook event data.
+	 */
+	static void outputMemoryPressureRelief(MM_VerboseManager *manager, MM_EnvironmentBase *env, const char *tagTemplate, MM_MemoryPressureReliefEndEvent *event);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 };
 
 #endif /* VERBOSEHANDLERJAVA_HPP_ */
@@ -45,6 +45,7 @@
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
+#include "VerboseWriterFileRing.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterStreamOutput.hpp"
 #include "VerboseWriterTrace.hpp"
@@ -123,6 +124,16 @@ MM_VerboseWriter *
 MM_VerboseManagerJava::createWriter(MM_EnvironmentBase *env, WriterType type, char *filename, UDATA fileCount, UDATA iterations)
 {
 	MM_VerboseWriter *writer = NULL;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+
+	if (extensions->verboseBinaryFormat && ((VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS == type) || (VERBOSE_WRITER_FILE_LOGGING_BUFFERED == type))) {
+		/* -Xgc:verboseFormat=binary: file output goes to the mapped ring, which is neither rotated nor buffered */
+		writer = MM_VerboseWriterFileRing::newInstance(env, this, filename);
+		if (NULL != writer) {
+			return writer;
+		}
+		/* fall back to the text writer requested */
+	}
 
 	switch(type) {
 	case VERBOSE_WRITER_STANDARD_STREAM:
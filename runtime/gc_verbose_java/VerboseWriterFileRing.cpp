@@ -0,0 +1,487 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9port.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include "VerboseWriterFileRing.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "Math.hpp"
+#include "VerboseManager.hpp"
+
+#define RING_TEMPLATE_TABLE_SIZE 8192
+#define RING_MAX_DECIMAL_DIGITS 19 /* the most decimal digits which always fit in a U_64 */
+#define RING_MAX_HEX_DIGITS 16
+
+MM_VerboseWriterFileRing::MM_VerboseWriterFileRing(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	: MM_VerboseWriter(VERBOSE_WRITER_FILE_LOGGING_BUFFERED)
+	, _manager(manager)
+	, _filename(NULL)
+	, _fileDescriptor(-1)
+	, _mmapHandle(NULL)
+	, _header(NULL)
+	, _stringTable(NULL)
+	, _records(NULL)
+	, _templates(NULL)
+	, _templateTableSize(RING_TEMPLATE_TABLE_SIZE)
+	, _monitor(NULL)
+{
+	/* no implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileRing instance.
+ * @return Pointer to the new MM_VerboseWriterFileRing.
+ */
+MM_VerboseWriterFileRing *
+MM_VerboseWriterFileRing::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, const char *filename)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileRing *agent = (MM_VerboseWriterFileRing *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileRing), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != agent) {
+		new(agent) MM_VerboseWriterFileRing(env, manager);
+		if (!agent->initialize(env, filename)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileRing instance.
+ */
+bool
+MM_VerboseWriterFileRing::initialize(MM_EnvironmentBase *env, const char *filename)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	if (!MM_VerboseWriter::initialize(env)) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileRing")) {
+		return false;
+	}
+
+	UDATA tableBytes = sizeof(TemplateEntry) * _templateTableSize;
+	_templates = (TemplateEntry *)extensions->getForge()->allocate(tableBytes, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == _templates) {
+		return false;
+	}
+
+	return openFile(env, filename);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileRing.
+ */
+void
+MM_VerboseWriterFileRing::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	closeFile(env);
+
+	if (NULL != _templates) {
+		extensions->getForge()->free(_templates);
+		_templates = NULL;
+	}
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+
+	MM_VerboseWriter::tearDown(env);
+}
+
+/**
+ * Create (or truncate) the ring file, size it and map it.
+ * @return true on success, false if the file could not be opened or mapped
+ */
+bool
+MM_VerboseWriterFileRing::openFile(MM_EnvironmentBase *env, const char *filename)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	if (NULL == filename) {
+		return false;
+	}
+
+	/* expand %pid, %Y etc. the same way the text file writers do */
+	char expandedName[EsMaxPath];
+	J9StringTokens *tokens = j9str_create_tokens(j9time_current_time_millis());
+	if (NULL == tokens) {
+		return false;
+	}
+	UDATA nameLength = j9str_subst_tokens(expandedName, sizeof(expandedName), filename, tokens);
+	j9str_free_tokens(tokens);
+	if (nameLength > sizeof(expandedName)) {
+		return false;
+	}
+	nameLength = strlen(expandedName) + 1;
+	_filename = (char *)extensions->getForge()->allocate(nameLength, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == _filename) {
+		return false;
+	}
+	memcpy(_filename, expandedName, nameLength);
+
+	UDATA fileSize = extensions->verboseBinaryRingSize;
+	if (fileSize < J9VGC_BINARY_MINIMUM_FILE_SIZE) {
+		fileSize = J9VGC_BINARY_MINIMUM_FILE_SIZE;
+	}
+
+	_fileDescriptor = j9file_open(_filename, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == _fileDescriptor) {
+		_manager->handleFileOpenError(env, _filename);
+		return false;
+	}
+	if (0 != j9file_set_length(_fileDescriptor, (I_64)fileSize)) {
+		_manager->handleFileOpenError(env, _filename);
+		return false;
+	}
+	_mmapHandle = j9mmap_map_file(_fileDescriptor, 0, fileSize, _filename, J9PORT_MMAP_FLAG_WRITE, OMRMEM_CATEGORY_MM);
+	if ((NULL == _mmapHandle) || (NULL == _mmapHandle->pointer)) {
+		_manager->handleFileOpenError(env, _filename);
+		return false;
+	}
+
+	/* the file was truncated, so every record slot starts out unused */
+	_header = (J9VerboseBinaryHeader *)_mmapHandle->pointer;
+	UDATA stringTableOffset = MM_Math::roundToCeiling(sizeof(U_64), sizeof(J9VerboseBinaryHeader));
+	UDATA stringTableSize = fileSize / J9VGC_BINARY_STRING_TABLE_FRACTION;
+	if (stringTableSize > (UDATA)U_32_MAX) {
+		stringTableSize = (UDATA)U_32_MAX;
+	}
+	UDATA recordsOffset = MM_Math::roundToCeiling(sizeof(J9VerboseBinaryRecord), stringTableOffset + stringTableSize);
+
+	_stringTable = (char *)_header + stringTableOffset;
+	_records = (J9VerboseBinaryRecord *)((U_8 *)_header + recordsOffset);
+	memset(_templates, 0, sizeof(TemplateEntry) * _templateTableSize);
+
+	_header->version = J9VGC_BINARY_VERSION;
+	_header->fileSize = fileSize;
+	_header->stringTableOffset = stringTableOffset;
+	_header->stringTableSize = stringTableSize;
+	_header->stringTableUsed = 0;
+	_header->stringCount = 0;
+	_header->recordsOffset = recordsOffset;
+	_header->recordCount = (fileSize - recordsOffset) / sizeof(J9VerboseBinaryRecord);
+	_header->nextSequence = 0;
+	_header->lostRecords = 0;
+	/* the magic goes in last so a reader never sees a valid header with unset fields */
+	MM_AtomicOperations::writeBarrier();
+	_header->magic = J9VGC_BINARY_MAGIC;
+
+	return true;
+}
+
+/**
+ * Flush and unmap the ring file.
+ */
+void
+MM_VerboseWriterFileRing::closeFile(MM_EnvironmentBase *env)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	if (NULL != _mmapHandle) {
+		j9mmap_msync(_mmapHandle->pointer, (UDATA)_header->fileSize, J9PORT_MMAP_SYNC_WAIT);
+		j9mmap_unmap_file(_mmapHandle);
+		_mmapHandle = NULL;
+	}
+	_header = NULL;
+	_stringTable = NULL;
+	_records = NULL;
+
+	if (-1 != _fileDescriptor) {
+		j9file_close(_fileDescriptor);
+		_fileDescriptor = -1;
+	}
+	if (NULL != _filename) {
+		extensions->getForge()->free(_filename);
+		_filename = NULL;
+	}
+}
+
+/**
+ * Start a new ring file. The file count and iteration limits of the text writers do not apply,
+ * since the ring never grows.
+ */
+bool
+MM_VerboseWriterFileRing::reconfigure(MM_EnvironmentBase *env, const char *filename, UDATA fileCount, UDATA iterations)
+{
+	omrthread_monitor_enter(_monitor);
+	closeFile(env);
+	bool result = openFile(env, filename);
+	omrthread_monitor_exit(_monitor);
+	return result;
+}
+
+/**
+ * Records are visible in the file as soon as they are written, so there is nothing to flush.
+ */
+void
+MM_VerboseWriterFileRing::endOfCycle(MM_EnvironmentBase *env)
+{
+}
+
+/**
+ * Closes the agents output stream.
+ */
+void
+MM_VerboseWriterFileRing::closeStream(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	closeFile(env);
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileRing::outputString(MM_EnvironmentBase *env, const char *string)
+{
+	omrthread_monitor_enter(_monitor);
+	if (NULL != _header) {
+		UDATA valueCount = 0;
+		U_32 templateIndex = J9VGC_BINARY_LITERAL_TEMPLATE;
+		UDATA templateLength = buildTemplate(string, &valueCount);
+		if (0 != templateLength) {
+			templateIndex = internTemplate(templateLength);
+		}
+		if (J9VGC_BINARY_LITERAL_TEMPLATE != templateIndex) {
+			writeTemplateRecords(templateIndex, valueCount);
+		} else {
+			writeLiteralRecords(string, strlen(string));
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+UDATA
+MM_VerboseWriterFileRing::buildTemplate(const char *string, UDATA *valueCount)
+{
+	const UDATA templateLimit = sizeof(_templateBuffer) - 1;
+	UDATA length = 0;
+	UDATA values = 0;
+	const char *cursor = string;
+
+	while ('\0' != *cursor) {
+		char c = *cursor;
+		if ((c >= J9VGC_BINARY_PLACEHOLDER_DECIMAL) && (c <= J9VGC_BINARY_PLACEHOLDER_HEX_LOWER)) {
+			/* the text already contains a placeholder byte and can not be represented */
+			return 0;
+		}
+
+		const char *run = cursor;
+		UDATA digits = 0;
+		char placeholder = '\0';
+		U_64 value = 0;
+
+		if (('0' == c) && ('x' == cursor[1]) && isxdigit((unsigned char)cursor[2])) {
+			/* a hex number: the "0x" prefix stays in the template */
+			bool hasUpper = false;
+			bool hasLower = false;
+			run = cursor + 2;
+			while (isxdigit((unsigned char)run[digits])) {
+				char digit = run[digits];
+				if ((digit >= 'a') && (digit <= 'f')) {
+					hasLower = true;
+					value = (value << 4) | (U_64)(digit - 'a' + 10);
+				} else if ((digit >= 'A') && (digit <= 'F')) {
+					hasUpper = true;
+					value = (value << 4) | (U_64)(digit - 'A' + 10);
+				} else {
+					value = (value << 4) | (U_64)(digit - '0');
+				}
+				digits += 1;
+			}
+			if ((digits <= RING_MAX_HEX_DIGITS) && !(hasUpper && hasLower)) {
+				placeholder = hasUpper ? J9VGC_BINARY_PLACEHOLDER_HEX_UPPER : J9VGC_BINARY_PLACEHOLDER_HEX_LOWER;
+			}
+			if ((length + 2) > templateLimit) {
+				return 0;
+			}
+			_templateBuffer[length++] = '0';
+			_templateBuffer[length++] = 'x';
+		} else if ((c >= '0') && (c <= '9')) {
+			while ((run[digits] >= '0') && (run[digits] <= '9')) {
+				value = (value * 10) + (U_64)(run[digits] - '0');
+				digits += 1;
+			}
+			if (digits <= RING_MAX_DECIMAL_DIGITS) {
+				placeholder = J9VGC_BINARY_PLACEHOLDER_DECIMAL;
+			}
+		} else {
+			if (length >= templateLimit) {
+				return 0;
+			}
+			_templateBuffer[length++] = c;
+			cursor += 1;
+			continue;
+		}
+
+		if ('\0' != placeholder) {
+			if ((length + 2) > templateLimit) {
+				return 0;
+			}
+			_templateBuffer[length++] = placeholder;
+			_templateBuffer[length++] = (char)digits;
+			_valueBuffer[values++] = value;
+		} else {
+			/* too long to hold in a value, keep the digits as text */
+			if ((length + digits) > templateLimit) {
+				return 0;
+			}
+			memcpy(_templateBuffer + length, run, digits);
+			length += digits;
+		}
+		cursor = run + digits;
+	}
+
+	_templateBuffer[length] = '\0';
+	*valueCount = values;
+	return length;
+}
+
+U_32
+MM_VerboseWriterFileRing::internTemplate(UDATA length)
+{
+	/* FNV-1a */
+	UDATA hash = (UDATA)2166136261U;
+	for (UDATA i = 0; i < length; i++) {
+		hash = (hash ^ (U_8)_templateBuffer[i]) * (UDATA)16777619U;
+	}
+	if (0 == hash) {
+		hash = 1;
+	}
+
+	UDATA mask = _templateTableSize - 1;
+	UDATA slot = hash & mask;
+	for (UDATA probe = 0; probe < _templateTableSize; probe++) {
+		TemplateEntry *entry = &_templates[slot];
+		if (0 == entry->hash) {
+			/* not seen yet: add it to the file (keeping the index at most 3/4 full so probes stay short) */
+			UDATA used = (UDATA)_header->stringTableUsed;
+			UDATA count = (UDATA)_header->stringCount;
+			if (((used + length + 1) > (UDATA)_header->stringTableSize) || ((count * 4) >= (_templateTableSize * 3))) {
+				return J9VGC_BINARY_LITERAL_TEMPLATE;
+			}
+			memcpy(_stringTable + used, _templateBuffer, length + 1);
+			/* publish the text before the count so a reader never sees a partial template */
+			MM_AtomicOperations::writeBarrier();
+			_header->stringTableUsed = used + length + 1;
+			_header->stringCount = count + 1;
+			entry->hash = hash;
+			entry->offset = (U_32)used;
+			entry->index = (U_32)count;
+			return entry->index;
+		}
+		if ((entry->hash == hash) && (0 == strcmp(_stringTable + entry->offset, _templateBuffer))) {
+			return entry->index;
+		}
+		slot = (slot + 1) & mask;
+	}
+	return J9VGC_BINARY_LITERAL_TEMPLATE;
+}
+
+J9VerboseBinaryRecord *
+MM_VerboseWriterFileRing::claimRecord(U_64 *sequence)
+{
+	U_64 next = _header->nextSequence;
+	J9VerboseBinaryRecord *record = &_records[next % _header->recordCount];
+	record->sequence = 0;
+	MM_AtomicOperations::writeBarrier();
+	_header->nextSequence = next + 1;
+	*sequence = next;
+	return record;
+}
+
+void
+MM_VerboseWriterFileRing::publishRecord(J9VerboseBinaryRecord *record, U_64 sequence)
+{
+	MM_AtomicOperations::writeBarrier();
+	record->sequence = sequence + 1;
+}
+
+void
+MM_VerboseWriterFileRing::writeTemplateRecords(U_32 templateIndex, UDATA valueCount)
+{
+	UDATA recordsNeeded = (0 == valueCount) ? 1 : ((valueCount + J9VGC_BINARY_RECORD_VALUES - 1) / J9VGC_BINARY_RECORD_VALUES);
+	if (recordsNeeded > _header->recordCount) {
+		_header->lostRecords += 1;
+		return;
+	}
+
+	UDATA written = 0;
+	do {
+		UDATA count = OMR_MIN(valueCount - written, (UDATA)J9VGC_BINARY_RECORD_VALUES);
+		U_64 sequence = 0;
+		J9VerboseBinaryRecord *record = claimRecord(&sequence);
+		record->templateIndex = templateIndex;
+		record->valueCount = (U_16)count;
+		record->reserved = 0;
+		memcpy(record->data.values, _valueBuffer + written, count * sizeof(U_64));
+		record->flags = (0 != written) ? J9VGC_BINARY_RECORD_CONTINUATION : 0;
+		written += count;
+		if (written < valueCount) {
+			record->flags |= J9VGC_BINARY_RECORD_CONTINUED;
+		}
+		publishRecord(record, sequence);
+	} while (written < valueCount);
+}
+
+void
+MM_VerboseWriterFileRing::writeLiteralRecords(const char *string, UDATA length)
+{
+	const UDATA textPerRecord = sizeof(((J9VerboseBinaryRecord *)NULL)->data.text);
+	UDATA recordsNeeded = (0 == length) ? 1 : ((length + textPerRecord - 1) / textPerRecord);
+	if (recordsNeeded > _header->recordCount) {
+		_header->lostRecords += 1;
+		return;
+	}
+
+	UDATA written = 0;
+	do {
+		UDATA count = OMR_MIN(length - written, textPerRecord);
+		U_64 sequence = 0;
+		J9VerboseBinaryRecord *record = claimRecord(&sequence);
+		record->templateIndex = J9VGC_BINARY_LITERAL_TEMPLATE;
+		record->valueCount = (U_16)count;
+		record->reserved = 0;
+		memcpy(record->data.text, string + written, count);
+		record->flags = (0 != written) ? J9VGC_BINARY_RECORD_CONTINUATION : 0;
+		written += count;
+		if (written < length) {
+			record->flags |= J9VGC_BINARY_RECORD_CONTINUED;
+		}
+		publishRecord(record, sequence);
+	} while (written < length);
+}
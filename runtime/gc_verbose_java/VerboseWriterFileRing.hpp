@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILERING_HPP_)
+#define VERBOSEWRITERFILERING_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "VerboseBinaryFormat.h"
+#include "VerboseWriter.hpp"
+
+class MM_VerboseManager;
+
+/**
+ * Output agent which directs verbosegc output to a fixed size, memory mapped ring file.
+ * @see VerboseBinaryFormat.h for the file layout
+ *
+ * Output is reduced to a template and its numeric values, so repeated events cost one fixed
+ * size record instead of a line of XML. The ring never grows and the newest records replace
+ * the oldest, so no rotation is needed and the tail of the history is never lost to a file
+ * switch. Since the file is mapped, the records written before a crash are still in the file.
+ */
+class MM_VerboseWriterFileRing : public MM_VerboseWriter
+{
+private:
+	struct TemplateEntry {
+		UDATA hash; /**< hash of the template, 0 if the entry is unused */
+		U_32 offset; /**< offset of the template from the start of the string table */
+		U_32 index; /**< index of the template in the string table */
+	};
+
+	MM_VerboseManager *_manager; /**< Verbose manager which owns this writer */
+	char *_filename; /**< name (after token substitution) of the ring file */
+	IDATA _fileDescriptor; /**< descriptor of the ring file, -1 if it is not open */
+	J9MmapHandle *_mmapHandle; /**< mapping of the ring file */
+	J9VerboseBinaryHeader *_header; /**< start of the mapped file */
+	char *_stringTable; /**< start of the string table in the mapped file */
+	J9VerboseBinaryRecord *_records; /**< start of the record ring in the mapped file */
+	TemplateEntry *_templates; /**< open addressed index of the templates already in the string table */
+	UDATA _templateTableSize; /**< number of entries in _templates (a power of 2) */
+	omrthread_monitor_t _monitor; /**< serializes writers of the ring */
+	char _templateBuffer[J9VGC_BINARY_MAX_TEMPLATE_LENGTH]; /**< scratch space for the template being built */
+	U_64 _valueBuffer[J9VGC_BINARY_MAX_TEMPLATE_LENGTH / 2]; /**< scratch space for the values of the template being built */
+
+private:
+	bool openFile(MM_EnvironmentBase *env, const char *filename);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Split a string into a template and its numeric values.
+	 * @param[in] string the output to split
+	 * @param[out] valueCount the number of values stored in _valueBuffer
+	 * @return the length of the template in _templateBuffer, or 0 if the string can not be templated
+	 */
+	UDATA buildTemplate(const char *string, UDATA *valueCount);
+
+	/**
+	 * Find the template in the string table, adding it if it is not there yet.
+	 * @return the index of the template, or J9VGC_BINARY_LITERAL_TEMPLATE if the string table is full
+	 */
+	U_32 internTemplate(UDATA length);
+
+	/**
+	 * Claim the next slot in the ring. The slot is marked unused until publishRecord() is called.
+	 */
+	J9VerboseBinaryRecord *claimRecord(U_64 *sequence);
+	void publishRecord(J9VerboseBinaryRecord *record, U_64 sequence);
+
+	void writeTemplateRecords(U_32 templateIndex, UDATA valueCount);
+	void writeLiteralRecords(const char *string, UDATA length);
+
+protected:
+	MM_VerboseWriterFileRing(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_VerboseWriterFileRing *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, const char *filename);
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, UDATA fileCount, UDATA iterations);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char *string);
+};
+
+#endif /* VERBOSEWRITERFILERING_HPP_ */
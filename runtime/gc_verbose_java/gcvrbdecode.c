@@ -0,0 +1,302 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * gcvrbdecode: convert a -Xgc:verboseFormat=binary ring file back into verbose GC XML.
+ *
+ * Usage: gcvrbdecode <ring file> [<output file>]
+ *
+ * Records are replayed oldest first. The oldest records in a ring which has wrapped usually
+ * belong to an element whose start has been overwritten, so output begins at the first
+ * top level element.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "j9comp.h"
+#include "VerboseBinaryFormat.h"
+
+#define DECODE_MAX_VALUES (J9VGC_BINARY_MAX_TEMPLATE_LENGTH / 2)
+#define DECODE_MAX_TEXT (64 * 1024)
+
+typedef struct DecodeState {
+	FILE *out;
+	const char *stringTable;
+	const U_64 *templateOffsets;
+	U_64 templateCount;
+	BOOLEAN synchronized; /* TRUE once a top level element has been seen */
+	U_32 templateIndex;
+	U_64 values[DECODE_MAX_VALUES];
+	UDATA valueCount;
+	char text[DECODE_MAX_TEXT];
+	UDATA textLength;
+	BOOLEAN overflow;
+} DecodeState;
+
+static U_8 *
+readFile(const char *fileName, UDATA *fileSize)
+{
+	U_8 *contents = NULL;
+	long length = 0;
+	FILE *file = fopen(fileName, "rb");
+
+	if (NULL == file) {
+		return NULL;
+	}
+	if ((0 == fseek(file, 0, SEEK_END)) && ((length = ftell(file)) > 0) && (0 == fseek(file, 0, SEEK_SET))) {
+		contents = (U_8 *)malloc((size_t)length);
+		if (NULL != contents) {
+			if (1 != fread(contents, (size_t)length, 1, file)) {
+				free(contents);
+				contents = NULL;
+			}
+		}
+	}
+	fclose(file);
+	*fileSize = (UDATA)length;
+	return contents;
+}
+
+/**
+ * Emit the text of one complete output (template plus values, or literal text).
+ */
+static void
+emitText(DecodeState *state, const char *text, UDATA length)
+{
+	if (!state->synchronized) {
+		/* nested lines and closing tags belong to an element whose start was overwritten */
+		if ((0 == length) || (' ' == text[0]) || ('\n' == text[0]) || ((length > 1) && ('<' == text[0]) && ('/' == text[1]))) {
+			return;
+		}
+		state->synchronized = TRUE;
+	}
+	fwrite(text, 1, length, state->out);
+}
+
+static void
+emitTemplate(DecodeState *state)
+{
+	char expanded[DECODE_MAX_TEXT];
+	UDATA length = 0;
+	UDATA valueIndex = 0;
+	const char *cursor = NULL;
+
+	if (state->templateIndex >= state->templateCount) {
+		return;
+	}
+	cursor = state->stringTable + state->templateOffsets[state->templateIndex];
+	while ('\0' != *cursor) {
+		char c = *cursor;
+		if ((J9VGC_BINARY_PLACEHOLDER_DECIMAL == c) || (J9VGC_BINARY_PLACEHOLDER_HEX_UPPER == c) || (J9VGC_BINARY_PLACEHOLDER_HEX_LOWER == c)) {
+			int width = (int)(U_8)cursor[1];
+			char number[32];
+			int printed = 0;
+			if ((0 == width) || (valueIndex >= state->valueCount)) {
+				/* corrupt record */
+				return;
+			}
+			if (J9VGC_BINARY_PLACEHOLDER_DECIMAL == c) {
+				printed = sprintf(number, "%0*llu", width, (unsigned long long)state->values[valueIndex]);
+			} else if (J9VGC_BINARY_PLACEHOLDER_HEX_UPPER == c) {
+				printed = sprintf(number, "%0*llX", width, (unsigned long long)state->values[valueIndex]);
+			} else {
+				printed = sprintf(number, "%0*llx", width, (unsigned long long)state->values[valueIndex]);
+			}
+			valueIndex += 1;
+			if ((length + (UDATA)printed) >= sizeof(expanded)) {
+				return;
+			}
+			memcpy(expanded + length, number, (size_t)printed);
+			length += (UDATA)printed;
+			cursor += 2;
+		} else {
+			if ((length + 1) >= sizeof(expanded)) {
+				return;
+			}
+			expanded[length++] = c;
+			cursor += 1;
+		}
+	}
+	emitText(state, expanded, length);
+}
+
+static void
+resetGroup(DecodeState *state)
+{
+	state->valueCount = 0;
+	state->textLength = 0;
+	state->overflow = FALSE;
+}
+
+/**
+ * Add one record to the output being assembled, emitting the output once it is complete.
+ */
+static void
+decodeRecord(DecodeState *state, const J9VerboseBinaryRecord *record, BOOLEAN startOfGroup)
+{
+	if (!startOfGroup) {
+		/* a continuation of an output we did not see the start of (or a stale slot) */
+		return;
+	}
+
+	if (J9VGC_BINARY_LITERAL_TEMPLATE == record->templateIndex) {
+		UDATA count = record->valueCount;
+		if (count > sizeof(record->data.text)) {
+			state->overflow = TRUE;
+		} else if ((state->textLength + count) < sizeof(state->text)) {
+			memcpy(state->text + state->textLength, record->data.text, count);
+			state->textLength += count;
+		} else {
+			state->overflow = TRUE;
+		}
+	} else {
+		UDATA count = record->valueCount;
+		state->templateIndex = record->templateIndex;
+		if ((count > J9VGC_BINARY_RECORD_VALUES) || ((state->valueCount + count) > DECODE_MAX_VALUES)) {
+			state->overflow = TRUE;
+		} else {
+			memcpy(state->values + state->valueCount, record->data.values, count * sizeof(U_64));
+			state->valueCount += count;
+		}
+	}
+
+	if (J9_ARE_NO_BITS_SET(record->flags, J9VGC_BINARY_RECORD_CONTINUED)) {
+		if (!state->overflow) {
+			if (J9VGC_BINARY_LITERAL_TEMPLATE == record->templateIndex) {
+				emitText(state, state->text, state->textLength);
+			} else {
+				emitTemplate(state);
+			}
+		}
+		resetGroup(state);
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	UDATA fileSize = 0;
+	U_8 *contents = NULL;
+	const J9VerboseBinaryHeader *header = NULL;
+	const J9VerboseBinaryRecord *records = NULL;
+	U_64 *templateOffsets = NULL;
+	DecodeState *state = NULL;
+	U_64 sequence = 0;
+	U_64 firstSequence = 0;
+	U_64 nextSequence = 0;
+	BOOLEAN inGroup = FALSE;
+	int rc = 1;
+
+	if ((argc < 2) || (argc > 3)) {
+		fprintf(stderr, "Usage: %s <verbose GC ring file> [<output file>]\n", argv[0]);
+		return 1;
+	}
+
+	contents = readFile(argv[1], &fileSize);
+	if (NULL == contents) {
+		fprintf(stderr, "Unable to read %s\n", argv[1]);
+		return 1;
+	}
+
+	header = (const J9VerboseBinaryHeader *)contents;
+	if ((fileSize < sizeof(J9VerboseBinaryHeader))
+		|| (J9VGC_BINARY_MAGIC != header->magic)
+		|| (J9VGC_BINARY_VERSION != header->version)
+		|| (header->fileSize > fileSize)
+		|| (header->stringTableUsed > header->stringTableSize)
+		|| ((header->stringTableOffset + header->stringTableSize) > header->recordsOffset)
+		|| (0 == header->recordCount)
+		|| ((header->recordsOffset + (header->recordCount * sizeof(J9VerboseBinaryRecord))) > header->fileSize)
+	) {
+		fprintf(stderr, "%s is not a verbose GC ring file\n", argv[1]);
+		goto done;
+	}
+
+	state = (DecodeState *)calloc(1, sizeof(DecodeState));
+	templateOffsets = (U_64 *)malloc((size_t)((header->stringCount + 1) * sizeof(U_64)));
+	if ((NULL == state) || (NULL == templateOffsets)) {
+		fprintf(stderr, "Out of memory\n");
+		goto done;
+	}
+
+	/* rebuild the template index: templates are stored back to back, each NUL terminated */
+	state->stringTable = (const char *)contents + header->stringTableOffset;
+	{
+		U_64 offset = 0;
+		while ((offset < header->stringTableUsed) && (state->templateCount < header->stringCount)) {
+			templateOffsets[state->templateCount++] = offset;
+			offset += strlen(state->stringTable + offset) + 1;
+		}
+	}
+	state->templateOffsets = templateOffsets;
+
+	if (3 == argc) {
+		state->out = fopen(argv[2], "w");
+		if (NULL == state->out) {
+			fprintf(stderr, "Unable to open %s\n", argv[2]);
+			goto done;
+		}
+	} else {
+		state->out = stdout;
+	}
+
+	records = (const J9VerboseBinaryRecord *)(contents + header->recordsOffset);
+	nextSequence = header->nextSequence;
+	if (nextSequence > header->recordCount) {
+		firstSequence = nextSequence - header->recordCount;
+	}
+
+	fprintf(state->out, "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\">\n\n");
+	for (sequence = firstSequence; sequence < nextSequence; sequence++) {
+		const J9VerboseBinaryRecord *record = &records[sequence % header->recordCount];
+		if ((sequence + 1) != record->sequence) {
+			/* the slot was being rewritten when the file was captured */
+			resetGroup(state);
+			inGroup = FALSE;
+			continue;
+		}
+		if (J9_ARE_ANY_BITS_SET(record->flags, J9VGC_BINARY_RECORD_CONTINUATION)) {
+			decodeRecord(state, record, inGroup);
+		} else {
+			resetGroup(state);
+			decodeRecord(state, record, TRUE);
+		}
+		inGroup = J9_ARE_ANY_BITS_SET(record->flags, J9VGC_BINARY_RECORD_CONTINUED);
+	}
+	fprintf(state->out, "</verbosegc>\n");
+
+	if (0 != header->lostRecords) {
+		fprintf(stderr, "%llu verbose GC outputs were too large for the ring and were not recorded\n", (unsigned long long)header->lostRecords);
+	}
+	rc = 0;
+
+done:
+	if ((NULL != state) && (NULL != state->out) && (stdout != state->out)) {
+		fclose(state->out);
+	}
+	free(state);
+	free(templateOffsets);
+	free(contents);
+	return rc;
+}
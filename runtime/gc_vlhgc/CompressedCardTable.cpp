@@ -38,6 +38,7 @@
 #include "GCExtensions.hpp"
 #include "Heap.hpp"
 #include "HeapRegionDescriptor.hpp"
+#include "IncrementalCardTable.hpp"
 
 #define BITS_PER_BYTE	8
 #define COMPRESSED_CARDS_PER_WORD	(sizeof(UDATA) * BITS_PER_BYTE)
@@ -184,6 +185,16 @@ MM_CompressedCardTable::rebuildCompressedCardTableForPartialCollect(MM_Environme
 
 	while (card < cardLast) {
 
+		if (1 == mask) {
+			/* at the start of a compressed word: a range of clean cards (the common case) produces a clean word */
+			Card *wordLast = card + (COMPRESSED_CARD_TABLE_DIV * COMPRESSED_CARDS_PER_WORD);
+			if ((wordLast <= cardLast) && (wordLast == MM_IncrementalCardTable::findFirstNonCleanCard(card, wordLast))) {
+				*compressedCard++ = AllCompressedCardsInWordClean;
+				card = wordLast;
+				continue;
+			}
+		}
+
 #if (1 == COMPRESSED_CARD_TABLE_DIV)
 
 		Card state = *card++;
@@ -300,6 +311,15 @@ MM_CompressedCardTable::cleanCardsInRange(MM_EnvironmentBase *env, MM_CardCleane
 					address += (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV);
 				}
 				compressedCardWord >>= 1;
+#if !defined(COMPRESSED_CARD_TABLE_INVERTED)
+				if (AllCompressedCardsInWordClean == compressedCardWord) {
+					/* no dirty cards left in this word - skip the cards the remaining bits are responsible for */
+					UDATA remainingBits = COMPRESSED_CARDS_PER_WORD - j - 1;
+					card += (COMPRESSED_CARD_TABLE_DIV * remainingBits);
+					address += (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV * remainingBits);
+					break;
+				}
+#endif /* !defined(COMPRESSED_CARD_TABLE_INVERTED) */
 			}
 		} else {
 			/* skip cards this word responsible for */
@@ -64,6 +64,7 @@
 #include "FinalizableObjectBuffer.hpp"
 #include "FinalizableReferenceBuffer.hpp"
 #include "FinalizeListManager.hpp"
+#include "GCThreadCountAdvisor.hpp"
 #include "GlobalAllocationManager.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
@@ -71,6 +72,7 @@
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
+#include "IncrementalCardTable.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
 #include "MemorySpace.hpp"
@@ -151,6 +153,7 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 	, _abortFlag(false)
 	, _abortInProgress(false)
 	, _regionCountCannotBeEvacuated(0)
+	, _regionCountPinned(0)
 	, _regionCountReservedNonEvacuated(0)
 	, _cacheLineAlignment(0)
 	, _clearableProcessingStarted(false)
@@ -436,6 +439,7 @@ MM_CopyForwardScheme::preProcessRegions(MM_EnvironmentVLHGC *env)
 	UDATA ownableSynchronizerCountInEden = 0;
 
 	_regionCountCannotBeEvacuated = 0;
+	_regionCountPinned = 0;
 
 	while(NULL != (region = regionIterator.nextRegion())) {
 		region->_copyForwardData._survivorBase = NULL;
@@ -451,7 +455,12 @@ MM_CopyForwardScheme::preProcessRegions(MM_EnvironmentVLHGC *env)
 				}
 				region->getOwnableSynchronizerObjectList()->startOwnableSynchronizerProcessing();
 				Assert_MM_true(region->getRememberedSetCardList()->isAccurate());
-				if ((region->_criticalRegionsInUse > 0) || (randomDecideForceNonEvacuatedRegion(_extensions->fvtest_forceCopyForwardHybridRatio))) {
+				if (region->_criticalRegionsInUse > 0) {
+					/* the region is pinned by a JNI critical section so it must not move */
+					region->_markData._noEvacuation = true;
+					_regionCountCannotBeEvacuated += 1;
+					_regionCountPinned += 1;
+				} else if (randomDecideForceNonEvacuatedRegion(_extensions->fvtest_forceCopyForwardHybridRatio)) {
 					/* set the region is noEvacuation for copyforward collector */
 					region->_markData._noEvacuation = true;
 					_regionCountCannotBeEvacuated += 1;
@@ -567,6 +576,7 @@ MM_CopyForwardScheme::postProcessRegions(MM_EnvironmentVLHGC *env)
 
 	env->_cycleState->_pgcData._survivorSetRegionCount = survivorSetRegionCount;
 	static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._nonEvacuateRegionCount = _regionCountCannotBeEvacuated;
+	static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._pinnedRegionCount = _regionCountPinned;
 }
 
 /****************************************
@@ -1606,9 +1616,21 @@ MM_CopyForwardScheme::copyForwardCollectionSet(MM_EnvironmentVLHGC *env)
 	/* Perform any master-specific setup */
 	masterSetupForCopyForward(env);
 
-	/* And perform the copy forward */
+	/* And perform the copy forward, on fewer threads than available if the previous copy-forwards had little parallel work */
+	MM_GCThreadCountAdvisor *threadCountAdvisor = _extensions->gcThreadCountAdvisor;
+	UDATA threadCount = UDATA_MAX;
+	if (NULL != threadCountAdvisor) {
+		threadCount = threadCountAdvisor->getThreadCount(env, MM_GCThreadCountAdvisor::phase_copyForward);
+	}
 	MM_CopyForwardSchemeTask copyForwardTask(env, _dispatcher, this, env->_cycleState);
-	_dispatcher->run(env, &copyForwardTask);
+	_dispatcher->run(env, &copyForwardTask, threadCount);
+
+	if (NULL != threadCountAdvisor) {
+		MM_VLHGCIncrementStats *incrementStats = &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats;
+		/* copied objects are scanned once copied, so the scan totals cover both the copied and the marked (abort or hybrid mode) objects */
+		UDATA bytesScanned = incrementStats->_copyForwardStats._scanBytesEden + incrementStats->_copyForwardStats._scanBytesNonEden;
+		threadCountAdvisor->recordWork(env, MM_GCThreadCountAdvisor::phase_copyForward, copyForwardTask.getThreadCount(), bytesScanned);
+	}
 
 	masterCleanupForCopyForward(env);
 	
@@ -2030,6 +2052,9 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 					copyLeafChildren(env, reservingContext, destinationObjectPtr);
 				}
 #endif /* J9VM_GC_LEAF_BITS */
+				if (_extensions->hotFieldCopying && !leafType && (env->_hotFieldCopyDepth < _extensions->hotFieldCopyDepth)) {
+					copyHotFieldChildren(env, reservingContext, destinationObjectPtr);
+				}
 			}
 			/* return value for updating the slot */
 			result = destinationObjectPtr;
@@ -2065,6 +2090,31 @@ MM_CopyForwardScheme::copyLeafChildren(MM_EnvironmentVLHGC* env, MM_AllocationCo
 }
 #endif /* J9VM_GC_LEAF_BITS */
 
+void
+MM_CopyForwardScheme::copyHotFieldChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr)
+{
+	J9Class *clazz = J9GC_J9OBJECT_CLAZZ(objectPtr, env);
+	if (GC_ObjectModel::SCAN_MIXED_OBJECT == _extensions->objectModel.getScanType(clazz)) {
+		UDATA hotFieldDescription = clazz->instanceHotFieldDescription;
+		/* bit 0 marks the class for hot field alignment rather than hot field copying */
+		if (0 == (hotFieldDescription & 1)) {
+			fj9object_t* scanPtr = _extensions->mixedObjectModel.getHeadlessObject(objectPtr);
+			UDATA hotBits = hotFieldDescription >> 1;
+			env->_hotFieldCopyDepth += 1;
+			while (0 != hotBits) {
+				if (1 == (hotBits & 1)) {
+					/* Copy/Forward the slot reference and perform any inter-region remember work that is required */
+					GC_SlotObject slotObject(_javaVM->omrVM, scanPtr);
+					copyAndForward(env, reservingContext, objectPtr, &slotObject);
+				}
+				hotBits >>= 1;
+				scanPtr += 1;
+			}
+			env->_hotFieldCopyDepth -= 1;
+		}
+	}
+}
+
 /**
  * Updates leaf pointers that point to an address located within the indexable object.  For example,
  * when the array layout is either inline continuous or hybrid, there will be leaf pointers that point
@@ -2325,7 +2375,7 @@ MM_CopyForwardScheme::scanReferenceObjectSlots(MM_EnvironmentVLHGC *env, MM_Allo
 			referentMustBeCleared = (0 != (referenceObjectOptions & MM_CycleState::references_clear_soft));
 			referentMustBeMarked = referentMustBeMarked || (
 				((0 == (referenceObjectOptions & MM_CycleState::references_soft_as_weak))
-				&& ((UDATA)J9GC_J9VMJAVALANGSOFTREFERENCE_AGE(env, objectPtr) < _extensions->getDynamicMaxSoftReferenceAge())));
+				&& ((UDATA)J9GC_J9VMJAVALANGSOFTREFERENCE_AGE(env, objectPtr) < _extensions->getMaxSoftReferenceAge())));
 			break;
 		case J9AccClassReferencePhantom:
 			referentMustBeCleared = (0 != (referenceObjectOptions & MM_CycleState::references_clear_phantom));
@@ -2714,12 +2764,23 @@ MM_CopyForwardScheme::getNextWorkUnitNoWait(MM_EnvironmentVLHGC *env, UDATA pref
 	ScanReason ret = SCAN_REASON_NONE;
 	/* local node first */
 	ret = getNextWorkUnitOnNode(env, preferredNumaNode);
-	if (SCAN_REASON_NONE == ret) {
+	if (SCAN_REASON_NONE != ret) {
+		if (COMMON_CONTEXT_INDEX == preferredNumaNode) {
+			/* a thread with no NUMA affinity has no local node */
+			env->_copyForwardStats._numaCommonScanCacheCount += 1;
+		} else {
+			env->_copyForwardStats._numaLocalScanCacheCount += 1;
+		}
+	} else {
 		/* we failed to find a scan cache on our preferred node */
 		if (COMMON_CONTEXT_INDEX != preferredNumaNode) {
 			/* try the common node */
 			ret = getNextWorkUnitOnNode(env, COMMON_CONTEXT_INDEX);
+			if (SCAN_REASON_NONE != ret) {
+				env->_copyForwardStats._numaCommonScanCacheCount += 1;
+			}
 		}
+		bool const foundOnCommonNode = (SCAN_REASON_NONE != ret);
 		/* now try the remaining nodes */
 		UDATA nextNode = (preferredNumaNode + 1) % nodeLists;
 		while ((SCAN_REASON_NONE == ret) && (nextNode != preferredNumaNode)) {
@@ -2728,6 +2789,15 @@ MM_CopyForwardScheme::getNextWorkUnitNoWait(MM_EnvironmentVLHGC *env, UDATA pref
 			}
 			nextNode = (nextNode + 1) % nodeLists;
 		}
+		if ((SCAN_REASON_NONE != ret) && !foundOnCommonNode) {
+			if (COMMON_CONTEXT_INDEX == preferredNumaNode) {
+				/* a thread with no NUMA affinity can't steal remote work either */
+				env->_copyForwardStats._numaCommonScanCacheCount += 1;
+			} else {
+				/* neither our own node nor the common node had work so this cache was stolen from another node */
+				env->_copyForwardStats._numaRemoteScanCacheCount += 1;
+			}
+		}
 	}
 	if (SCAN_REASON_NONE == ret && (0 != _regionCountCannotBeEvacuated) && !_abortInProgress && !abortFlagRaised()) {
 		if (env->_workStack.retrieveInputPacket(env)) {
@@ -3054,7 +3124,7 @@ MM_CopyForwardScheme::incrementalScanReferenceObjectSlots(MM_EnvironmentVLHGC *e
 	if (J9AccClassReferenceSoft == (J9CLASS_FLAGS(J9GC_J9OBJECT_CLAZZ(objectPtr, env)) & J9AccClassReferenceMask)) {
 		/* Object is a Soft Reference: mark it if not expired */
 		U_32 age = J9GC_J9VMJAVALANGSOFTREFERENCE_AGE(env, objectPtr);
-		referentMustBeMarked = age < _extensions->getDynamicMaxSoftReferenceAge();
+		referentMustBeMarked = age < _extensions->getMaxSoftReferenceAge();
 	}
 	
 	GC_SlotObject *slotObject;
@@ -3438,7 +3508,8 @@ MM_CopyForwardScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *env,
 					Card *card = cardTable->heapAddrToCardAddr(env, low);
 					Card *toCard = cardTable->heapAddrToCardAddr(env, high);
 
-					while (card < toCard) {
+					/* most cards in the collection set are clean, so skip over those runs in bulk */
+					while (toCard != (card = MM_IncrementalCardTable::findFirstNonCleanCard(card, toCard))) {
 						Card fromState = *card;
 						switch(fromState) {
 						case CARD_PGC_MUST_SCAN:
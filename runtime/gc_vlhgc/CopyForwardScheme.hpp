@@ -136,6 +136,7 @@ private:
 	bool _abortInProgress;  /**< Flag indicating that the copy forward mechanism is now operating in abort mode, which is attempting to secure integrity of the heap to continue execution */
 
 	UDATA _regionCountCannotBeEvacuated; /**<The number of regions, which can not be copyforward in collectionSet */
+	UDATA _regionCountPinned; /**< The number of regions in collectionSet which can not be copyforward because they are pinned by JNI critical sections */
 	UDATA _regionCountReservedNonEvacuated; /** the number of regions need to set Mark only in order to try to avoid abort case */
 
 	UDATA _cacheLineAlignment; /**< The number of bytes per cache line which is used to determine which boundaries in memory represent the beginning of a cache line */
@@ -956,6 +957,16 @@ private:
 	void copyLeafChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr);
 #endif /* J9VM_GC_LEAF_BITS */
 
+	/**
+	 * Copy the objects referenced from the JIT-marked hot fields of a just copied object, so that they are
+	 * placed right after it when they fall in the same compact group (see -Xgc:hotFieldCopying).
+	 * Hot children are followed recursively up to hotFieldCopyDepth references away from the first object.
+	 * @param env[in] A GC thread
+	 * @param reservingContext[in] The context to which we would prefer to copy any objects discovered
+	 * @param objectPtr[in] The copy of the object whose hot children are copied
+	 */
+	void copyHotFieldChildren(MM_EnvironmentVLHGC* env, MM_AllocationContextTarok *reservingContext, J9Object* objectPtr);
+
 	/**
 	 * Calculate estimation for allocation age based on compact group and set it to the merged region
 	 * @param[in] env The current thread
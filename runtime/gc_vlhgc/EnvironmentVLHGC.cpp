@@ -36,6 +36,7 @@ MM_EnvironmentVLHGC::MM_EnvironmentVLHGC(OMR_VMThread *omrVMThread)
 	,_scanCache(NULL)
 	,_deferredScanCache(NULL)
 	, _copyForwardCompactGroups(NULL)
+	, _hotFieldCopyDepth(0)
 	, _previousConcurrentYieldCheckBytesScanned(0)
 	, _rsclBufferControlBlockHead(NULL)
 	, _rsclBufferControlBlockTail(NULL)
@@ -55,6 +56,7 @@ MM_EnvironmentVLHGC::MM_EnvironmentVLHGC(J9JavaVM *javaVM)
 	,_scanCache(NULL)
 	,_deferredScanCache(NULL)
 	, _copyForwardCompactGroups(NULL)
+	, _hotFieldCopyDepth(0)
 	, _previousConcurrentYieldCheckBytesScanned(0)
 	, _rsclBufferControlBlockHead(NULL)
 	, _rsclBufferControlBlockTail(NULL)
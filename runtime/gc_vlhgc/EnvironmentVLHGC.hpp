@@ -66,6 +66,7 @@ public:
 	MM_CopyScanCache *_deferredScanCache; /**< a partially scanned cache, to be scanned later */
 
 	MM_CopyForwardCompactGroup *_copyForwardCompactGroups;  /**< List of copy-forward data for each compact group for the given GC thread (only for GC threads during copy forward operations) */
+	UDATA _hotFieldCopyDepth; /**< number of hot field references followed to reach the object currently being copied (only for GC threads during copy forward operations) */
 	
 	UDATA _previousConcurrentYieldCheckBytesScanned;	/**< The number of bytes scanned in the mark stats at the end of the previous shouldYieldFromTask check in concurrent mark */
 
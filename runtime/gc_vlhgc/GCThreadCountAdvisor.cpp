@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup gc_vlhgc
+ */
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#if defined(J9VM_GC_VLHGC)
+
+#include "GCThreadCountAdvisor.hpp"
+
+#include "EnvironmentVLHGC.hpp"
+#include "Forge.hpp"
+#include "GCExtensions.hpp"
+#include "ParallelDispatcher.hpp"
+
+MM_GCThreadCountAdvisor::MM_GCThreadCountAdvisor(MM_EnvironmentVLHGC *env)
+	: MM_BaseVirtual()
+	, _extensions(MM_GCExtensions::getExtensions(env))
+	, _maximumThreadCount(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_GCThreadCountAdvisor *
+MM_GCThreadCountAdvisor::newInstance(MM_EnvironmentVLHGC *env)
+{
+	MM_GCThreadCountAdvisor *advisor = (MM_GCThreadCountAdvisor *)env->getForge()->allocate(sizeof(MM_GCThreadCountAdvisor), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != advisor) {
+		new(advisor) MM_GCThreadCountAdvisor(env);
+		if (!advisor->initialize(env)) {
+			advisor->kill(env);
+			advisor = NULL;
+		}
+	}
+	return advisor;
+}
+
+void
+MM_GCThreadCountAdvisor::kill(MM_EnvironmentVLHGC *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_GCThreadCountAdvisor::initialize(MM_EnvironmentVLHGC *env)
+{
+	_maximumThreadCount = _extensions->dispatcher->threadCountMaximum();
+	for (UDATA phase = 0; phase < phase_count; phase++) {
+		_history[phase].workEstimate = 0;
+		_history[phase].lastThreadCount = 0;
+		_history[phase].lastWork = 0;
+		_history[phase].valid = false;
+	}
+	return true;
+}
+
+void
+MM_GCThreadCountAdvisor::tearDown(MM_EnvironmentVLHGC *env)
+{
+}
+
+UDATA
+MM_GCThreadCountAdvisor::getThreadCount(MM_EnvironmentVLHGC *env, Phase phase)
+{
+	PhaseHistory *history = &_history[phase];
+	if (!history->valid) {
+		/* nothing is known about the phase yet, so use every thread */
+		return UDATA_MAX;
+	}
+
+	UDATA bytesPerThread = _extensions->adaptiveThreadCountBytesPerThread;
+	UDATA threadCount = (history->workEstimate + bytesPerThread - 1) / bytesPerThread;
+	if (threadCount >= _maximumThreadCount) {
+		return UDATA_MAX;
+	}
+	return OMR_MAX(threadCount, 1);
+}
+
+void
+MM_GCThreadCountAdvisor::recordWork(MM_EnvironmentVLHGC *env, Phase phase, UDATA threadCount, UDATA bytesScanned)
+{
+	PhaseHistory *history = &_history[phase];
+	UDATA work = bytesScanned;
+
+	if (!history->valid || (work >= history->workEstimate)) {
+		/* follow an increase immediately so that the next dispatch does not run short of threads */
+		history->workEstimate = work;
+	} else {
+		history->workEstimate = (history->workEstimate + work) / 2;
+	}
+	history->lastThreadCount = threadCount;
+	history->lastWork = work;
+	history->valid = true;
+}
+
+#endif /* defined(J9VM_GC_VLHGC) */
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup gc_vlhgc
+ */
+
+#if !defined(GCTHREADCOUNTADVISOR_HPP_)
+#define GCTHREADCOUNTADVISOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#if defined(J9VM_GC_VLHGC)
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentVLHGC;
+class MM_GCExtensions;
+
+/**
+ * Chooses how many GC threads are dispatched for a parallel phase of a Balanced collection, from the
+ * amount of work the same phase had in the previous cycles.  A phase that only scanned a few megabytes
+ * is not able to keep every GC thread busy, so waking all of them only costs wake-ups and idle spinning;
+ * such phases are dispatched on fewer threads.  Work is measured in bytes scanned, which does not depend
+ * on the number of threads that did the scanning (unlike the number of scan caches or work packets, which
+ * grows with the thread count and would make the advice feed back on itself).  The work estimate follows
+ * an increase in work immediately and decays by half on each decrease, so a phase never gets much less
+ * than the threads it needed the last time.
+ * @ingroup gc_vlhgc
+ */
+class MM_GCThreadCountAdvisor : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Parallel phases whose thread count is adapted.
+	 */
+	enum Phase {
+		phase_copyForward = 0, /**< copy-forward of a partial collection */
+		phase_partialMark, /**< mark of a partial collection */
+		phase_globalMark, /**< mark work of a global collection or of a GMP increment */
+		phase_count /**< number of phases (not a phase) */
+	};
+
+private:
+	/**
+	 * History kept for each phase.
+	 */
+	struct PhaseHistory {
+		UDATA workEstimate; /**< estimated number of bytes the next dispatch of the phase will scan */
+		UDATA lastThreadCount; /**< number of threads used by the last dispatch of the phase */
+		UDATA lastWork; /**< number of bytes scanned by the last dispatch of the phase */
+		bool valid; /**< true once the phase has been measured at least once */
+	};
+
+	MM_GCExtensions *_extensions; /**< cached pointer to the extensions structure */
+	UDATA _maximumThreadCount; /**< number of GC threads available to the dispatcher */
+	PhaseHistory _history[phase_count]; /**< work history of each phase */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_GCThreadCountAdvisor *newInstance(MM_EnvironmentVLHGC *env);
+	virtual void kill(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Return the number of threads to dispatch for the next run of the specified phase.
+	 * @param env[in] the master GC thread
+	 * @param phase[in] the phase about to be dispatched
+	 * @return the thread count to pass to the dispatcher, or UDATA_MAX to use every GC thread
+	 */
+	UDATA getThreadCount(MM_EnvironmentVLHGC *env, Phase phase);
+
+	/**
+	 * Record the work done by a dispatch of the specified phase, to size the next dispatch.
+	 * @param env[in] the master GC thread
+	 * @param phase[in] the phase which was dispatched
+	 * @param threadCount[in] the number of threads which ran the phase
+	 * @param bytesScanned[in] the number of bytes of objects the phase scanned
+	 */
+	void recordWork(MM_EnvironmentVLHGC *env, Phase phase, UDATA threadCount, UDATA bytesScanned);
+
+	/**
+	 * @return the number of threads used by the last dispatch of the phase (0 if it has not been dispatched)
+	 */
+	MMINLINE UDATA getLastThreadCount(Phase phase) { return _history[phase].lastThreadCount; }
+
+	/**
+	 * @return the number of bytes scanned by the last dispatch of the phase
+	 */
+	MMINLINE UDATA getLastWork(Phase phase) { return _history[phase].lastWork; }
+
+	/**
+	 * @return the number of GC threads available to the dispatcher
+	 */
+	MMINLINE UDATA getMaximumThreadCount() { return _maximumThreadCount; }
+
+	MM_GCThreadCountAdvisor(MM_EnvironmentVLHGC *env);
+
+protected:
+	bool initialize(MM_EnvironmentVLHGC *env);
+	void tearDown(MM_EnvironmentVLHGC *env);
+};
+
+#endif /* defined(J9VM_GC_VLHGC) */
+#endif /* GCTHREADCOUNTADVISOR_HPP_ */
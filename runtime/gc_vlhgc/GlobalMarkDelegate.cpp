@@ -38,11 +38,13 @@
 #include "ClassLoaderManager.hpp"
 #include "ClassLoaderRememberedSet.hpp"
 #include "CycleState.hpp"
+#include "CycleStateVLHGC.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentVLHGC.hpp"
 #include "FinalizeListManager.hpp"
 #include "FinalizerSupport.hpp"
 #include "GCExtensions.hpp"
+#include "GCThreadCountAdvisor.hpp"
 #include "GlobalMarkCardScrubber.hpp"
 #include "GlobalMarkingScheme.hpp"
 #include "HeapMapIterator.hpp"
@@ -348,9 +350,21 @@ void
 MM_GlobalMarkDelegate::markAll(MM_EnvironmentVLHGC *env)
 {
 	_markingScheme->masterSetupForGC(env);
-	/* run the mark */
+	/* run the mark, on fewer threads than available if the previous global marks had little parallel work.
+	 * Only the complete mark is sized this way: the work of a time-limited increment depends on its thread count.
+	 */
+	MM_GCThreadCountAdvisor *threadCountAdvisor = _extensions->gcThreadCountAdvisor;
+	UDATA threadCount = UDATA_MAX;
+	if (NULL != threadCountAdvisor) {
+		threadCount = threadCountAdvisor->getThreadCount(env, MM_GCThreadCountAdvisor::phase_globalMark);
+	}
 	MM_ParallelGlobalMarkTask markTask(env, _dispatcher, _markingScheme, MARK_ALL, I_64_MAX, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	_dispatcher->run(env, &markTask, threadCount);
+
+	if (NULL != threadCountAdvisor) {
+		UDATA bytesScanned = static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._markStats._bytesScanned;
+		threadCountAdvisor->recordWork(env, MM_GCThreadCountAdvisor::phase_globalMark, markTask.getThreadCount(), bytesScanned);
+	}
 
 	/* Do any post mark checks */
 	_markingScheme->masterCleanupAfterGC(env);
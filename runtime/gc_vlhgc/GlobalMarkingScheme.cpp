@@ -856,6 +856,20 @@ MM_GlobalMarkingScheme::scanClassLoaderSlots(MM_EnvironmentVLHGC *env, J9ClassLo
 	}
 }
 
+MMINLINE void
+MM_GlobalMarkingScheme::updateNumaScanStats(MM_EnvironmentVLHGC *env, J9Object *objectPtr, UDATA nodeOfThread)
+{
+	UDATA nodeOfObject = _heapRegionManager->tableDescriptorForAddress(objectPtr)->getNumaNode();
+	if ((0 == nodeOfThread) || (0 == nodeOfObject)) {
+		/* node 0 means no affinity, so the access is neither local nor remote */
+		env->_markVLHGCStats._numaCommonObjectsScanned += 1;
+	} else if (nodeOfObject == nodeOfThread) {
+		env->_markVLHGCStats._numaLocalObjectsScanned += 1;
+	} else {
+		env->_markVLHGCStats._numaRemoteObjectsScanned += 1;
+	}
+}
+
 void
 MM_GlobalMarkingScheme::scanObject(MM_EnvironmentVLHGC *env, J9Object *objectPtr, ScanReason reason)
 {
@@ -903,11 +917,16 @@ MMINLINE void
 MM_GlobalMarkingScheme::completeScan(MM_EnvironmentVLHGC *env)
 {
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	bool const trackNumaLocality = _extensions->numaLocalityStatsEnabled;
+	UDATA const nodeOfThread = trackNumaLocality ? env->getNumaAffinity() : 0;
 	do {
 		J9Object *objectPtr = NULL;
 		while (NULL != (objectPtr = (J9Object *)env->_workStack.pop(env))) {
 			U_64 scanStartTime = j9time_hires_clock();
 			do {
+				if (trackNumaLocality && (PACKET_INVALID_OBJECT != (UDATA)objectPtr)) {
+					updateNumaScanStats(env, objectPtr, nodeOfThread);
+				}
 				scanObject(env, objectPtr, SCAN_REASON_PACKET);
 				objectPtr = (J9Object *)env->_workStack.popNoWait(env);
 			} while (NULL != objectPtr);
@@ -1633,6 +1652,8 @@ MM_GlobalMarkingScheme::processReferenceList(MM_EnvironmentVLHGC *env, J9Object*
 						/* Soft reference hasn't aged sufficiently yet - increment the age */
 						J9GC_J9VMJAVALANGSOFTREFERENCE_AGE(env, referenceObj) = age + 1;
 					}
+					/* remember how recently the referent was used, to pick the soft references cleared next */
+					env->_markVLHGCStats._softReferenceAgeStats.recordSurvivor(J9GC_J9VMJAVALANGSOFTREFERENCE_AGE(env, referenceObj), _extensions->getMaxSoftReferenceAge());
 				}
 				_interRegionRememberedSet->rememberReferenceForMark(env, referenceObj, referent);
 			} else {
@@ -293,6 +293,14 @@ private:
 	 */
 	MMINLINE void updateScanStats(MM_EnvironmentVLHGC *env, UDATA bytesScanned, ScanReason reason);
 
+	/**
+	 * Record whether an object taken from a work packet resides on the NUMA node of the scanning thread.
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] the object about to be scanned
+	 * @param nodeOfThread[in] the NUMA node the current thread has affinity with (0 for none)
+	 */
+	MMINLINE void updateNumaScanStats(MM_EnvironmentVLHGC *env, J9Object *objectPtr, UDATA nodeOfThread);
+
 	/**
 	 * Scan the specified object. The caller is responsible for recording the time
 	 * taken to scan the object in MM_MarkVLHGCStats::_scanTime
@@ -36,6 +36,13 @@
 
 #include "CardTable.hpp"
 
+#if defined(J9HAMMER)
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif /* defined(__AVX2__) */
+#endif /* defined(J9HAMMER) */
+
 class MM_EnvironmentBase;
 
 /**
@@ -53,6 +60,62 @@ private:
 
 public:
 	static MM_IncrementalCardTable *newInstance(MM_EnvironmentBase *env, MM_Heap *heap);
+
+	/**
+	 * Find the first card in the given range which is not CARD_CLEAN.
+	 * Runs of clean cards are skipped 32 (AVX2) or 16 (SSE2) cards at a time on x86-64, and a word
+	 * at a time elsewhere, so this is much cheaper than a byte-at-a-time walk over a mostly clean table.
+	 * @param card the first card in the range
+	 * @param toCard the card immediately after the range
+	 * @return the first card which is not clean, or toCard if every card in the range is clean
+	 */
+	static MMINLINE Card *
+	findFirstNonCleanCard(Card *card, Card *toCard)
+	{
+		/* step to a word boundary so the bulk of the range is read a word (or vector) at a time */
+		while ((card < toCard) && (0 != ((UDATA)card & (sizeof(UDATA) - 1)))) {
+			if (CARD_CLEAN != *card) {
+				return card;
+			}
+			card += 1;
+		}
+
+#if defined(J9HAMMER)
+#if defined(__AVX2__)
+		const __m256i cleanCards256 = _mm256_set1_epi8((char)CARD_CLEAN);
+		while (((UDATA)toCard - (UDATA)card) >= sizeof(__m256i)) {
+			__m256i cards = _mm256_loadu_si256((const __m256i *)card);
+			if (-1 != _mm256_movemask_epi8(_mm256_cmpeq_epi8(cards, cleanCards256))) {
+				/* the narrower loops below locate the non-clean card */
+				break;
+			}
+			card += sizeof(__m256i);
+		}
+#endif /* defined(__AVX2__) */
+		const __m128i cleanCards128 = _mm_set1_epi8((char)CARD_CLEAN);
+		while (((UDATA)toCard - (UDATA)card) >= sizeof(__m128i)) {
+			__m128i cards = _mm_loadu_si128((const __m128i *)card);
+			if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(cards, cleanCards128))) {
+				break;
+			}
+			card += sizeof(__m128i);
+		}
+#endif /* defined(J9HAMMER) */
+
+		/* a word of clean cards has CARD_CLEAN in every byte */
+		const UDATA cleanWord = ((UDATA)CARD_CLEAN) * (UDATA_MAX / 0xFF);
+		while (((UDATA)toCard - (UDATA)card) >= sizeof(UDATA)) {
+			if (cleanWord != *(UDATA *)card) {
+				break;
+			}
+			card += sizeof(UDATA);
+		}
+
+		while ((card < toCard) && (CARD_CLEAN == *card)) {
+			card += 1;
+		}
+		return card;
+	}
 protected:
 	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
 	virtual void tearDown(MM_EnvironmentBase *env);
@@ -56,9 +56,11 @@
 #include "EnvironmentBase.hpp"
 #include "FinalizeListManager.hpp"
 #include "FinalizerSupport.hpp"
+#include "GCThreadCountAdvisor.hpp"
 #include "GlobalAllocationManager.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapStats.hpp"
+#include "IncrementalCardTable.hpp"
 #include "IncrementalGenerationalGC.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
@@ -242,6 +244,13 @@ MM_IncrementalGenerationalGC::initialize(MM_EnvironmentVLHGC *env)
 		goto error_no_memory;
 	}
 
+	if (extensions->adaptiveThreadCount) {
+		extensions->gcThreadCountAdvisor = MM_GCThreadCountAdvisor::newInstance(env);
+		if (NULL == extensions->gcThreadCountAdvisor) {
+			goto error_no_memory;
+		}
+	}
+
 	/*
 	 * Set threshold for Nursery collection set for allocation-based aging system here as a doubled estimated "ideal" taxation interval
 	 * except it has not been hard coded in command line
@@ -323,6 +332,11 @@ MM_IncrementalGenerationalGC::tearDown(MM_EnvironmentVLHGC *env)
 		extensions->compactGroupPersistentStats = NULL;
 	}
 
+	if (NULL != extensions->gcThreadCountAdvisor) {
+		extensions->gcThreadCountAdvisor->kill(env);
+		extensions->gcThreadCountAdvisor = NULL;
+	}
+
 	if(NULL != _workPacketsForPartialGC) {
 		_workPacketsForPartialGC->kill(env);
 		_workPacketsForPartialGC = NULL;
@@ -1023,6 +1037,8 @@ MM_IncrementalGenerationalGC::runGlobalMarkPhaseIncrement(MM_EnvironmentVLHGC *e
 
 	/* If the GMP is no longer running, then we have run the final increment of the cycle. */
 	if(!isGlobalMarkPhaseRunning()) {
+		updateSoftReferenceAge(env, &_persistentGlobalMarkPhaseState._vlhgcCycleStats._markStats._softReferenceAgeStats);
+
 		reportGCCycleFinalIncrementEnding(env);
 		/* TODO: TEMPORARY: This is a temporary call that should be deleted once the new verbose format is in place */
 		/* NOTE: May want to move any tracepoints up into this routine */
@@ -1138,6 +1154,8 @@ MM_IncrementalGenerationalGC::runGlobalGarbageCollection(MM_EnvironmentVLHGC *en
 	/* Global Collection - we max out ages on all live regions to remove them from the nursery collection set */
 	setRegionAgesToMax(env);
 
+	updateSoftReferenceAge(env, &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._markStats._softReferenceAgeStats);
+
 	reportGCCycleFinalIncrementEnding(env);
 	/* TODO: TEMPORARY: This is a temporary call that should be deleted once the new verbose format is in place */
 	/* NOTE: May want to move any tracepoints up into this routine */
@@ -1187,6 +1205,16 @@ MM_IncrementalGenerationalGC::flushRememberedSetIntoCardTable(MM_EnvironmentVLHG
 	dispatcher->run(env, &flushTask);
 }
 
+void
+MM_IncrementalGenerationalGC::updateSoftReferenceAge(MM_EnvironmentVLHGC *env, MM_SoftReferenceAgeStats *ageStats)
+{
+	if (_extensions->softReferenceLRU) {
+		MM_Heap *heap = _extensions->getHeap();
+		double percentFree = ((double)heap->getApproximateActiveFreeMemorySize()) / ((double)heap->getActiveMemorySize());
+		_extensions->updateDynamicMaxSoftReferenceAge(percentFree, ageStats);
+	}
+}
+
 bool
 MM_IncrementalGenerationalGC::attemptHeapResize(MM_EnvironmentVLHGC *env, MM_AllocateDescription *allocDescription)
 {
@@ -1839,9 +1867,11 @@ MM_IncrementalGenerationalGC::assertTableClean(MM_EnvironmentVLHGC *env, Card ad
 			/* look up the card range for this region and walk it */
 			Card *lowCard = _extensions->cardTable->heapAddrToCardAddr(env, region->getLowAddress());
 			Card *highCard = _extensions->cardTable->heapAddrToCardAddr(env, region->getHighAddress());
-			for (Card *thisCard = lowCard; thisCard < highCard; thisCard++) {
+			Card *thisCard = MM_IncrementalCardTable::findFirstNonCleanCard(lowCard, highCard);
+			while (thisCard < highCard) {
 				Card cardValue = *thisCard;
 				Assert_GC_true_with_message2(env, ((additionalCleanState == cardValue) || (CARD_CLEAN == cardValue)), "The card %p is not clean, value %u\n", thisCard, cardValue);
+				thisCard = MM_IncrementalCardTable::findFirstNonCleanCard(thisCard + 1, highCard);
 			}
 		}
 	}
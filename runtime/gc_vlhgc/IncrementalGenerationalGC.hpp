@@ -55,6 +55,7 @@ class MM_MarkMap;
 class MM_MarkMapManager;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceTarok;
+class MM_SoftReferenceAgeStats;
 class MM_WorkPacketsVLHGC;
 
 /**
@@ -249,6 +250,15 @@ public:
 	 * @return true if resize is successful
 	 */
 	bool attemptHeapResize(MM_EnvironmentVLHGC *env, MM_AllocateDescription *allocDescription);
+
+	/**
+	 * Pick the soft reference clearing age of the next global mark when -Xgc:softReferenceLRU is enabled.
+	 * Only called once global marking completes, since only then have the soft references of the whole heap been seen.
+	 * Partial collections always clear soft references at the fixed maximum age.
+	 * @param env[in] The master GC thread
+	 * @param ageStats[in] ages of the soft references kept by the global mark which just completed
+	 */
+	void updateSoftReferenceAge(MM_EnvironmentVLHGC *env, MM_SoftReferenceAgeStats *ageStats);
 	
 	virtual	U_32 getGCTimePercentage(MM_EnvironmentBase *env);
 
@@ -37,11 +37,13 @@
 #include "ClassLoaderIterator.hpp"
 #include "ClassLoaderManager.hpp"
 #include "CycleState.hpp"
+#include "CycleStateVLHGC.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentVLHGC.hpp"
 #include "FinalizeListManager.hpp"
 #include "FinalizerSupport.hpp"
 #include "GCExtensions.hpp"
+#include "GCThreadCountAdvisor.hpp"
 #include "GlobalMarkCardScrubber.hpp"
 #include "HeapMapIterator.hpp"
 #include "InterRegionRememberedSet.hpp"
@@ -107,9 +109,19 @@ MM_PartialMarkDelegate::markAll(MM_EnvironmentVLHGC *env)
 {
 	_markingScheme->masterSetupForGC(env);
 
-	/* run the mark */
+	/* run the mark, on fewer threads than available if the previous partial marks had little parallel work */
+	MM_GCThreadCountAdvisor *threadCountAdvisor = _extensions->gcThreadCountAdvisor;
+	UDATA threadCount = UDATA_MAX;
+	if (NULL != threadCountAdvisor) {
+		threadCount = threadCountAdvisor->getThreadCount(env, MM_GCThreadCountAdvisor::phase_partialMark);
+	}
 	MM_ParallelPartialMarkTask markTask(env, _dispatcher, _markingScheme, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	_dispatcher->run(env, &markTask, threadCount);
+
+	if (NULL != threadCountAdvisor) {
+		UDATA bytesScanned = static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._markStats._bytesScanned;
+		threadCountAdvisor->recordWork(env, MM_GCThreadCountAdvisor::phase_partialMark, markTask.getThreadCount(), bytesScanned);
+	}
 
 	/* Do any post mark checks */
 	_markingScheme->masterCleanupAfterGC(env);
@@ -56,6 +56,7 @@
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManagerTarok.hpp"
+#include "IncrementalCardTable.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
 #include "PartialMarkingScheme.hpp"
@@ -574,7 +575,7 @@ MM_PartialMarkingScheme::scanReferenceMixedObject(MM_EnvironmentVLHGC *env, J9Ob
 		referentMustBeCleared = (0 != (referenceObjectOptions & MM_CycleState::references_clear_soft));
 		referentMustBeMarked = referentMustBeMarked || (
 			((0 == (referenceObjectOptions & MM_CycleState::references_soft_as_weak))
-			&& ((UDATA)J9GC_J9VMJAVALANGSOFTREFERENCE_AGE(env, objectPtr) < _extensions->getDynamicMaxSoftReferenceAge())));
+			&& ((UDATA)J9GC_J9VMJAVALANGSOFTREFERENCE_AGE(env, objectPtr) < _extensions->getMaxSoftReferenceAge())));
 		break;
 	case J9AccClassReferencePhantom:
 		referentMustBeCleared = (0 != (referenceObjectOptions & MM_CycleState::references_clear_phantom));
@@ -1341,7 +1342,8 @@ MM_PartialMarkingScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *en
 					Card *card = cardTable->heapAddrToCardAddr(env, low);
 					Card *toCard = cardTable->heapAddrToCardAddr(env, high);
 					
-					while (card < toCard) {
+					/* most cards in the collection set are clean, so skip over those runs in bulk */
+					while (toCard != (card = MM_IncrementalCardTable::findFirstNonCleanCard(card, toCard))) {
 						Card fromState = *card;
 						switch(fromState) {
 						case CARD_PGC_MUST_SCAN:
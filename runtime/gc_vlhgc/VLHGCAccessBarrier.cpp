@@ -270,6 +270,65 @@ MM_VLHGCAccessBarrier::copyArrayCritical(J9VMThread *vmThread, GC_ArrayObjectMod
 	}
 }
 
+/**
+ * Enter a JNI critical section which hands out a direct pointer into object.
+ * The region containing object is pinned so that it is neither evacuated nor compacted
+ * while the critical section is active. When JNI critical region pinning is enabled the
+ * pin alone keeps the data in place, so the thread does not take JNI critical access and
+ * exclusive access (and therefore GC) does not wait for it to leave the critical section.
+ *
+ * @param vmThread  the J9VMThread entering the critical section (must hold VM access)
+ * @param object    the object whose region is to be pinned, or NULL if the data can not move
+ */
+void
+MM_VLHGCAccessBarrier::enterCriticalSection(J9VMThread *vmThread, J9Object *object)
+{
+	Assert_MM_true(vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS);
+#if defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)
+	if (NULL != object) {
+		/* we need to increment this region's critical count so that we know not to compact it */
+		UDATA volatile *criticalCount = &(((MM_HeapRegionDescriptorVLHGC *)_heap->getHeapRegionManager()->regionDescriptorForAddress(object))->_criticalRegionsInUse);
+		MM_AtomicOperations::add(criticalCount, 1);
+	}
+	if (_extensions->jniCriticalRegionPinning) {
+		/* the pin is sufficient; only record the nesting so that JNI checking still sees the critical section */
+		vmThread->jniCriticalDirectCount += 1;
+	} else
+#endif /* defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)*/
+	{
+		MM_JNICriticalRegion::enterCriticalRegion(vmThread, true);
+	}
+}
+
+/**
+ * Exit a JNI critical section entered with enterCriticalSection, unpinning the region containing object.
+ *
+ * @param vmThread  the J9VMThread leaving the critical section (must hold VM access)
+ * @param object    the object passed to enterCriticalSection
+ */
+void
+MM_VLHGCAccessBarrier::exitCriticalSection(J9VMThread *vmThread, J9Object *object)
+{
+#if defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)
+	if (NULL != object) {
+		/* we need to decrement this region's critical count */
+		UDATA volatile *criticalCount = &(((MM_HeapRegionDescriptorVLHGC *)_heap->getHeapRegionManager()->regionDescriptorForAddress(object))->_criticalRegionsInUse);
+		Assert_MM_true((*criticalCount) > 0);
+		MM_AtomicOperations::subtract(criticalCount, 1);
+	}
+	if (_extensions->jniCriticalRegionPinning) {
+		if (vmThread->jniCriticalDirectCount > 0) {
+			vmThread->jniCriticalDirectCount -= 1;
+		} else {
+			Assert_MM_invalidJNICall();
+		}
+	} else
+#endif /* defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)*/
+	{
+		MM_JNICriticalRegion::exitCriticalRegion(vmThread, true);
+	}
+}
+
 void*
 MM_VLHGCAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jarray array, jboolean *isCopy)
 {
@@ -309,9 +368,10 @@ MM_VLHGCAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jarray
 				}
 			/* Corner case where there's only one arraylet leaf */
 			} else if (indexableObjectModel->isArrayletDataContiguous(arrayObject)) {
-				/* Solo arraylet leaf is contiguous so we can simply return the data associated with it */
-				MM_JNICriticalRegion::enterCriticalRegion(vmThread, true);
-				Assert_MM_true(vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS);
+				/* Solo arraylet leaf is contiguous so we can simply return the data associated with it.
+				 * Arraylet leaves never move so there is no region to pin.
+				 */
+				enterCriticalSection(vmThread, NULL);
 				GC_SlotObject objectSlot(env->getOmrVM(), arrayoidPtr);
 				data = objectSlot.readReferenceFromSlot();
 			} else {
@@ -328,15 +388,9 @@ MM_VLHGCAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jarray
 		}
 	} else {
 		// acquire access and return a direct pointer
-		MM_JNICriticalRegion::enterCriticalRegion(vmThread, true);
-		Assert_MM_true(vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS);
+		enterCriticalSection(vmThread, (J9Object *)arrayObject);
 		arrayObject = (J9IndexableObject*)J9_JNI_UNWRAP_REFERENCE(array);
 		data = (void *)indexableObjectModel->getDataPointerForContiguous(arrayObject);
-#if defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)
-		/* we need to increment this region's critical count so that we know not to compact it */
-		UDATA volatile *criticalCount = &(((MM_HeapRegionDescriptorVLHGC *)_heap->getHeapRegionManager()->regionDescriptorForAddress(arrayObject))->_criticalRegionsInUse);
-		MM_AtomicOperations::add(criticalCount, 1);
-#endif /* defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)*/
 	}
 	VM_VMAccess::inlineExitVMToJNI(vmThread);
 	return data;
@@ -405,7 +459,7 @@ MM_VLHGCAccessBarrier::jniReleasePrimitiveArrayCritical(J9VMThread* vmThread, ja
 				if (elems != data) {
 					Trc_MM_JNIReleasePrimitiveArrayCritical_invalid(vmThread, arrayObject, elems, data);
 				}
-				MM_JNICriticalRegion::exitCriticalRegion(vmThread, true);
+				exitCriticalSection(vmThread, NULL);
 			} else {
 				/* Possible to reach here if arraylet leaf has one leaf and no elements in it */
 				Assert_MM_true((1 == indexableObjectModel->numArraylets(arrayObject)) && (0 == indexableObjectModel->getSizeInElements(arrayObject)));
@@ -424,13 +478,7 @@ MM_VLHGCAccessBarrier::jniReleasePrimitiveArrayCritical(J9VMThread* vmThread, ja
 		if(elems != data) {
 			Trc_MM_JNIReleasePrimitiveArrayCritical_invalid(vmThread, arrayObject, elems, data);
 		}
-#if defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)
-		/* we need to decrement this region's critical count */
-		UDATA volatile *criticalCount = &(((MM_HeapRegionDescriptorVLHGC *)_heap->getHeapRegionManager()->regionDescriptorForAddress(arrayObject))->_criticalRegionsInUse);
-		Assert_MM_true((*criticalCount) > 0);
-		MM_AtomicOperations::subtract(criticalCount, 1);
-#endif /* defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)*/
-		MM_JNICriticalRegion::exitCriticalRegion(vmThread, true);
+		exitCriticalSection(vmThread, (J9Object *)arrayObject);
 	}
 	VM_VMAccess::inlineExitVMToJNI(vmThread);
 }
@@ -492,18 +540,12 @@ MM_VLHGCAccessBarrier::jniGetStringCritical(J9VMThread* vmThread, jstring str, j
 		vmThread->jniCriticalCopyCount += 1;
 	} else {
 		// acquire access and return a direct pointer
-		MM_JNICriticalRegion::enterCriticalRegion(vmThread, true);
-		Assert_MM_true(vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS);
+		enterCriticalSection(vmThread, (J9Object *)valueObject);
 		data = (jchar*)_extensions->indexableObjectModel.getDataPointerForContiguous(valueObject);
 
 		if (NULL != isCopy) {
 			*isCopy = JNI_FALSE;
 		}
-#if defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)
-		/* we need to increment this region's critical count so that we know not to compact it */
-		UDATA volatile *criticalCount = &(((MM_HeapRegionDescriptorVLHGC *)_heap->getHeapRegionManager()->regionDescriptorForAddress(valueObject))->_criticalRegionsInUse);
-		MM_AtomicOperations::add(criticalCount, 1);
-#endif /* defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)*/
 	}
 	VM_VMAccess::inlineExitVMToJNI(vmThread);
 	return data;
@@ -542,13 +584,7 @@ MM_VLHGCAccessBarrier::jniReleaseStringCritical(J9VMThread* vmThread, jstring st
 		}
 	} else {
 		// direct pointer, just drop access
-#if defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)
-		/* we need to decrement this region's critical count */
-		UDATA volatile *criticalCount = &(((MM_HeapRegionDescriptorVLHGC *)_heap->getHeapRegionManager()->regionDescriptorForAddress(valueObject))->_criticalRegionsInUse);
-		Assert_MM_true((*criticalCount) > 0);
-		MM_AtomicOperations::subtract(criticalCount, 1);
-#endif /* defined(J9VM_GC_MODRON_COMPACTION) || defined(J9VM_GC_MODRON_SCAVENGER)*/
-		MM_JNICriticalRegion::exitCriticalRegion(vmThread, true);
+		exitCriticalSection(vmThread, (J9Object *)valueObject);
 	}
 	VM_VMAccess::inlineExitVMToJNI(vmThread);
 }
@@ -52,6 +52,8 @@ private:
 	void copyBackArrayCritical(J9VMThread *vmThread, GC_ArrayObjectModel *indexableObjectModel,
 				J9InternalVMFunctions *functions, void *elems,
 				J9IndexableObject **arrayObject, jint mode);
+	void enterCriticalSection(J9VMThread *vmThread, J9Object *object);
+	void exitCriticalSection(J9VMThread *vmThread, J9Object *object);
 
 protected:
 	virtual bool initialize(MM_EnvironmentBase *env);
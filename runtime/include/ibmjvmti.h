@@ -188,6 +188,14 @@ enum {
 };
 
 
+/**
+ * Extended heap_filter bit for IterateThroughHeap. Setting it declares that the agent's heap callbacks
+ * may be called concurrently from several threads, which lets the VM walk the heap in parallel.
+ * Callbacks are then made in no particular heap order.
+ */
+#define COM_IBM_HEAP_FILTER_CONCURRENT_CALLBACKS	0x10000
+
+
 #define JVMTI_MONITOR_JAVA		0x01
 #define JVMTI_MONITOR_RAW		0x02
 
@@ -22,12 +22,30 @@
 
 #include "j9cfg.h"
 #include <jni.h>
+#include "j9.h"
 
 #if JAVA_SPEC_VERSION >= 11
+/**
+ * Called by the static initializer of bootstrap classes with archived static fields.
+ * Sets the fields from the heap archive in the shared cache, if there is one. The static
+ * initializer computes the fields which are still null on return.
+ */
 JNIEXPORT void JNICALL
 JVM_InitializeFromArchive(JNIEnv *env, jclass clz)
 {
-	/* A no-op implementation is ok. */
+#if defined(J9VM_OPT_SHARED_CLASSES)
+	J9VMThread *currentThread = (J9VMThread *)env;
+	J9JavaVM *vm = currentThread->javaVM;
+	J9SharedClassConfig *config = vm->sharedClassConfig;
+
+	if ((NULL != config) && (NULL != config->initializeFromHeapArchive)) {
+		J9InternalVMFunctions const * const vmFuncs = vm->internalVMFunctions;
+
+		vmFuncs->internalEnterVMFromJNI(currentThread);
+		config->initializeFromHeapArchive(currentThread, J9VM_J9CLASS_FROM_JCLASS(currentThread, clz));
+		vmFuncs->internalExitVMToJNI(currentThread);
+	}
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
 }
 #endif /* JAVA_SPEC_VERSION >= 11 */
 
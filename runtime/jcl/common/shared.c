@@ -1875,6 +1875,37 @@ Java_com_ibm_oti_shared_SharedClassStatistics_maxJitDataBytesImpl(JNIEnv* env, j
 	return (jlong)ret;
 }
 
+jlongArray JNICALL
+Java_com_ibm_oti_shared_SharedClassStatistics_lookupStatsImpl(JNIEnv* env, jobject thisObj)
+{
+	jlongArray result = NULL;
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+
+	Trc_JCL_com_ibm_oti_shared_SharedClassStatistics_lookupStatsImpl_Entry(env);
+	if ((NULL != javaVM->sharedClassConfig) && (NULL != javaVM->sharedClassConfig->getLookupStats)) {
+		J9SharedCacheLookupStats stats;
+		/* The struct only holds UDATA counters, return them in the order they are declared */
+		jsize count = (jsize)(sizeof(stats) / sizeof(UDATA));
+		UDATA *counters = (UDATA *)&stats;
+		jlong values[sizeof(stats) / sizeof(UDATA)];
+		jsize i = 0;
+
+		javaVM->sharedClassConfig->getLookupStats(javaVM, &stats);
+		for (i = 0; i < count; i++) {
+			values[i] = (jlong)counters[i];
+		}
+		result = (*env)->NewLongArray(env, count);
+		if (NULL != result) {
+			(*env)->SetLongArrayRegion(env, result, 0, count, values);
+		}
+	}
+	Trc_JCL_com_ibm_oti_shared_SharedClassStatistics_lookupStatsImpl_Exit(env, result);
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+	return result;
+}
+
 jlong JNICALL 
 Java_com_ibm_oti_shared_SharedClassStatistics_freeSpaceBytesImpl(JNIEnv* env, jobject thisObj)
 {
@@ -261,6 +261,7 @@ omr_add_exports(jclse
 	Java_com_ibm_oti_shared_SharedAbstractHelper_getIsVerboseImpl
 	Java_com_ibm_oti_shared_SharedClassAbstractHelper_initializeShareableClassloaderImpl
 	Java_com_ibm_oti_shared_SharedClassStatistics_freeSpaceBytesImpl
+	Java_com_ibm_oti_shared_SharedClassStatistics_lookupStatsImpl
 	Java_com_ibm_oti_shared_SharedClassStatistics_maxAotBytesImpl
 	Java_com_ibm_oti_shared_SharedClassStatistics_maxJitDataBytesImpl
 	Java_com_ibm_oti_shared_SharedClassStatistics_maxSizeBytesImpl
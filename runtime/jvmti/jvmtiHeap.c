@@ -96,6 +96,7 @@ typedef struct J9JVMTIHeapData {
 	jvmtiHeapTags	 tags;
 
 	const jvmtiHeapCallbacks *callbacks;
+	BOOLEAN            lockTagTable;   /** set when other threads are reporting objects at the same time, so tag table accesses must hold env->mutex */
 } J9JVMTIHeapData;
 
 
@@ -104,6 +105,7 @@ typedef struct J9JVMTIHeapData {
 static UDATA copyObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static UDATA countObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static jvmtiIterationControl iterateThroughHeapCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDesc, void * userData);
+static jvmtiError iterateThroughHeapConcurrently(J9VMThread *currentThread, J9JVMTIHeapData *iteratorData);
 
 static jvmtiIterationControl wrap_heapReferenceCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
 static jvmtiIterationControl wrap_heapIterationCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
@@ -507,6 +509,7 @@ jvmtiFollowReferences(jvmtiEnv* env, jint heap_filter, jclass klass, jobject ini
 		iteratorData.userData = (void *) user_data;
 		iteratorData.clazz = 0;
 		iteratorData.rc = JVMTI_ERROR_NONE;
+		iteratorData.lockTagTable = FALSE;
 		
 		/* Do not report anything if the class filter set by the user is an interface class.  Quote from the spec:
 		 * "If klass is an interface, no objects are reported. This applies to both the object and primitive callbacks." 
@@ -996,6 +999,10 @@ jvmtiFollowRefs_getTags(J9JVMTIHeapData * iteratorData, j9object_t  referrer, j9
 	J9JVMTIObjectTag entry, *result;
 	J9Class *clazz;
 
+	if (iteratorData->lockTagTable) {
+		omrthread_monitor_enter(iteratorData->env->mutex);
+	}
+
 	/* get the object tag */
 	entry.ref = object;
 	result = hashTableFind(iteratorData->env->objectTagTable, &entry);
@@ -1025,6 +1032,10 @@ jvmtiFollowRefs_getTags(J9JVMTIHeapData * iteratorData, j9object_t  referrer, j9
 		iteratorData->tags.referrerClassTag = 0;
 	}
 
+	if (iteratorData->lockTagTable) {
+		omrthread_monitor_exit(iteratorData->env->mutex);
+	}
+
 	return;
 }
 
@@ -1308,6 +1319,7 @@ jvmtiError JNICALL jvmtiIterateThroughHeap(jvmtiEnv* env,
 		iteratorData.userData = (void *) user_data;
 		iteratorData.clazz = 0;
 		iteratorData.rc = JVMTI_ERROR_NONE;
+		iteratorData.lockTagTable = FALSE;
 	     
 		/* Do not report anything if the class filter set by the user is an interface class.  Quote from the spec:
 		 * "If klass is an interface, no objects are reported. This applies to both the object and primitive callbacks." 
@@ -1322,8 +1334,12 @@ jvmtiError JNICALL jvmtiIterateThroughHeap(jvmtiEnv* env,
 		ensureHeapWalkable(currentThread);
 
 		/* Walk the heap */
-		vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
-		rc = iteratorData.rc;
+		if (J9_ARE_ANY_BITS_SET(heap_filter, COM_IBM_HEAP_FILTER_CONCURRENT_CALLBACKS)) {
+			rc = iterateThroughHeapConcurrently(currentThread, &iteratorData);
+		} else {
+			vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+			rc = iteratorData.rc;
+		}
 
 		vmFuncs->releaseExclusiveVMAccess(currentThread);
 
@@ -1338,6 +1354,63 @@ done:
 
 
 
+/**
+ * \brief      Walk the heap on the GC threads for IterateThroughHeap
+ * \ingroup    jvmti.heap
+ *
+ * Used when the agent has declared, with COM_IBM_HEAP_FILTER_CONCURRENT_CALLBACKS, that its
+ * callbacks may run concurrently. Each GC thread reports objects through its own copy of the
+ * iteration data, and tag table accesses are serialized on env->mutex.
+ *
+ * @param[in] currentThread  current thread, holding exclusive VM access
+ * @param[in] iteratorData   iteration data set up by the caller
+ * @return                   a jvmtiError value
+ */
+static jvmtiError
+iterateThroughHeapConcurrently(J9VMThread *currentThread, J9JVMTIHeapData *iteratorData)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions const * const mmFuncs = vm->memoryManagerFunctions;
+	UDATA threadCount = mmFuncs->j9mm_get_parallel_iteration_thread_count(vm);
+	J9JVMTIHeapData *threadData = NULL;
+	void **threadUserData = NULL;
+	jvmtiError rc = JVMTI_ERROR_NONE;
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (1 == threadCount) {
+		mmFuncs->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, iteratorData);
+		return iteratorData->rc;
+	}
+
+	threadData = j9mem_allocate_memory(threadCount * (sizeof(J9JVMTIHeapData) + sizeof(void *)), J9MEM_CATEGORY_JVMTI);
+	if (NULL == threadData) {
+		return JVMTI_ERROR_OUT_OF_MEMORY;
+	}
+	threadUserData = (void **) (threadData + threadCount);
+
+	for (i = 0; i < threadCount; i++) {
+		threadData[i] = *iteratorData;
+		threadData[i].lockTagTable = TRUE;
+		threadUserData[i] = &threadData[i];
+	}
+
+	mmFuncs->j9mm_iterate_all_objects_parallel(currentThread, vm->portLibrary, 0, iterateThroughHeapCallback, threadUserData);
+
+	/* Report the first error any of the threads ran into */
+	for (i = 0; i < threadCount; i++) {
+		if (JVMTI_ERROR_NONE != threadData[i].rc) {
+			rc = threadData[i].rc;
+			break;
+		}
+	}
+
+	j9mem_free_memory(threadData);
+	return rc;
+}
+
+
+
 /** 
  * \brief      Heap Iteration callback
  * \ingroup    jvmti.heap
@@ -1999,6 +2072,10 @@ updateObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong *origin
 {
 	J9JVMTIObjectTag entry;
 	J9JVMTIObjectTag *resultTag;
+
+	if (iteratorData->lockTagTable) {
+		omrthread_monitor_enter(iteratorData->env->mutex);
+	}
 	
 	/* The callback could have added or removed the tag. Modify the hashtable entry to
 	 * account for it */
@@ -2027,6 +2104,10 @@ updateObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong *origin
 			*originalTag = resultTag->tag;
 		}
 	}
+
+	if (iteratorData->lockTagTable) {
+		omrthread_monitor_exit(iteratorData->env->mutex);
+	}
 }
 
 
@@ -412,6 +412,21 @@ isClassCompatible(J9BytecodeVerificationData *verifyData, UDATA sourceClass, UDA
 IDATA
 isClassCompatibleByName(J9BytecodeVerificationData *verifyData, UDATA sourceClass, U_8* targetClassName, UDATA targetClassNameLength, IDATA *reasonCode);
 
+/**
+* @brief
+* @param *verifyData
+* @param *sourceName
+* @param sourceLength
+* @param *targetName
+* @param targetLength
+* @param arrayInterfaceOnly
+* @param reasonCode
+* 	output parameter denoting error conditions
+* @return IDATA
+*/
+IDATA
+isClassNameCompatible(J9BytecodeVerificationData *verifyData, U_8 *sourceName, UDATA sourceLength, U_8 *targetName, UDATA targetLength, UDATA arrayInterfaceOnly, IDATA *reasonCode);
+
 /**
 * @brief
 * @param verifyData
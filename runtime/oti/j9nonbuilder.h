@@ -1097,6 +1097,10 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA corruptValue;
 	UDATA softMaxBytes;
 	UDATA otherBytes;
+	UDATA writeMutexAcquireCount;
+	UDATA writeMutexContendedCount;
+	UDATA writeMutexWaitMicros;
+	UDATA writeMutexContendedWaitMicros;
 	/* The fields above are stats for the top layer, and the fields below are the summary for all layers */
 	UDATA ccCount;
 	UDATA ccStartedCount;
@@ -1129,8 +1133,57 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA numObjects;
 	UDATA numStartupHints;
 	UDATA startupHintBytes;
+	UDATA startupPagesReadAhead;
+	UDATA startupPagesTouched;
+	UDATA startupPagesTouchedReadAhead;
+	UDATA timestampChecksCached;
+	UDATA timestampChecksPerformed;
+	UDATA timestampChangeEvents;
+	UDATA verificationDataBytes;
+	UDATA numVerificationData;
+	UDATA cachePageSize;
+	UDATA cacheHugePageBytes;
+	UDATA cacheMappingFlags;
+	UDATA cacheNumaNodes;
 } J9SharedClassJavacoreDataDescriptor;
 
+/* Operations counted in J9SharedCacheLookupStats */
+#define J9SHR_LOOKUP_FIND_ROMCLASS 0
+#define J9SHR_LOOKUP_FIND_COMPILED_METHOD 1
+#define J9SHR_LOOKUP_STORE_COMPILED_METHOD 2
+#define J9SHR_LOOKUP_FIND_ATTACHED_DATA 3
+#define J9SHR_LOOKUP_OPERATIONS 4
+
+/* Results of a lookup. EXISTS and FULL only apply to stores, a successful store counts as a HIT. */
+#define J9SHR_LOOKUP_RESULT_HIT 0
+#define J9SHR_LOOKUP_RESULT_NOT_FOUND 1
+#define J9SHR_LOOKUP_RESULT_STALE 2
+#define J9SHR_LOOKUP_RESULT_INVALIDATED 3
+#define J9SHR_LOOKUP_RESULT_EXISTS 4
+#define J9SHR_LOOKUP_RESULT_FULL 5
+#define J9SHR_LOOKUP_RESULT_ERROR 6
+#define J9SHR_LOOKUP_RESULTS 7
+
+/* Kind of class loader a ROMClass lookup is made for, derived from the ClasspathItem it uses */
+#define J9SHR_LOOKUP_LOADER_BOOTSTRAP 0
+#define J9SHR_LOOKUP_LOADER_CLASSPATH 1
+#define J9SHR_LOOKUP_LOADER_URL 2
+#define J9SHR_LOOKUP_LOADER_TOKEN 3
+#define J9SHR_LOOKUP_LOADERS 4
+
+/* Latency bucket i counts lookups which took less than 4^i microseconds, the last bucket counts the rest */
+#define J9SHR_LOOKUP_LATENCY_BUCKETS 8
+/* ROMClass hits by the index of the classpath entry they were found at, the last bucket counts the rest */
+#define J9SHR_LOOKUP_CLASSPATH_INDICES 16
+
+typedef struct J9SharedCacheLookupStats {
+	UDATA results[J9SHR_LOOKUP_OPERATIONS][J9SHR_LOOKUP_RESULTS];
+	UDATA latencyHistogram[J9SHR_LOOKUP_OPERATIONS][J9SHR_LOOKUP_LATENCY_BUCKETS];
+	UDATA totalMicros[J9SHR_LOOKUP_OPERATIONS];
+	UDATA romClassResultsByLoader[J9SHR_LOOKUP_LOADERS][J9SHR_LOOKUP_RESULTS];
+	UDATA romClassHitsByClasspathIndex[J9SHR_LOOKUP_CLASSPATH_INDICES];
+} J9SharedCacheLookupStats;
+
 typedef struct J9SharedStringFarm {
 	char* freePtr;
 	UDATA bytesLeft;
@@ -1162,10 +1215,10 @@ typedef struct J9SharedCacheHeader {
 	UDATA updateCount;
 	J9WSRP updateCountPtr;
 	volatile UDATA readerCount;
-	UDATA unused2;
+	UDATA writeMutexContendedWaitMicros;
 	UDATA writeHash;
-	UDATA unused3;
-	UDATA unused4;
+	UDATA startupPageMapSRP;
+	UDATA startupPageMapBytes;
 	UDATA crashCntr;
 	UDATA aotBytes;
 	UDATA jitBytes;
@@ -1203,12 +1256,12 @@ typedef struct J9SharedCacheHeader {
 	UDATA corruptValue;
 	UDATA lastMetadataType;
 	UDATA writerCount;
-	UDATA unused5;
-	UDATA unused6;
+	UDATA classIndexSRP;
+	UDATA classIndexBytes;
 	U_32 softMaxBytes;
-	UDATA unused8;
-	UDATA unused9;
-	UDATA unused10;
+	UDATA writeMutexAcquireCount;
+	UDATA writeMutexContendedCount;
+	UDATA writeMutexWaitMicros;
 } J9SharedCacheHeader;
 
 #define J9SHAREDCACHEHEADER_UPDATECOUNTPTR(base) WSRP_GET((base)->updateCountPtr, UDATA*)
@@ -1248,6 +1301,8 @@ typedef struct J9SharedCacheAPI {
 	IDATA  ( *destroySharedCache)(struct J9JavaVM *vm, const char *cacheDir, const char *name, U_32 cacheType, BOOLEAN useCommandLineValues) ;
 	UDATA printStatsOptions;
 	char* methodSpecs;
+	char* snapshotFile;
+	UDATA snapshotCacheSize;
 	U_32 softMaxBytes;
 	I_32 minAOT;
 	I_32 maxAOT;
@@ -1256,6 +1311,11 @@ typedef struct J9SharedCacheAPI {
 	U_8 sharedCacheEnabled;
 	U_8 inContainer; /* It is TRUE only when xShareClassesPresent is FALSE and J9_SHARED_CACHE_DEFAULT_BOOT_SHARING(vm) is TRUE and the JVM is running in container */
 	I_8 layer;
+	U_8 cachedTimestampChecks;
+	U_8 heapArchive;
+	U_8 hugePages;
+	U_8 numaInterleave;
+	U_8 preloadClasses;
 } J9SharedCacheAPI;
 
 typedef struct J9SharedClassConfig {
@@ -1305,8 +1365,12 @@ typedef struct J9SharedClassConfig {
 	void  (*storeGCHints)(struct J9VMThread* currentThread, UDATA heapSize1, UDATA heapSize2, BOOLEAN forceReplace);
 	IDATA  (*findGCHints)(struct J9VMThread* currentThread, UDATA *heapSize1, UDATA *heapSize2);
 	void  ( *updateClasspathOpenState)(struct J9JavaVM* vm, struct J9ClassPathEntry* classPathEntries, UDATA entryIndex, UDATA entryCount, BOOLEAN isOpen);
+	void  (*initializeFromHeapArchive)(struct J9VMThread* currentThread, struct J9Class* clazz);
+	void  (*getLookupStats)(struct J9JavaVM* vm, struct J9SharedCacheLookupStats* stats);
 	struct J9MemorySegment* metadataMemorySegment;
 	struct J9Pool* classnameFilterPool;
+	struct J9Pool* heapArchivePending;
+	void* classPreloader;
 	U_32 softMaxBytes;
 	I_32 minAOT;
 	I_32 maxAOT;
@@ -1342,6 +1406,7 @@ typedef struct J9ShrCompositeCacheCommonInfo {
 	UDATA cacheIsCorrupt;
 	UDATA stringTableStarted;
 	UDATA oldWriterCount;
+	volatile UDATA writeMutexWaiters;
 } J9ShrCompositeCacheCommonInfo;
 
 #endif /* J9VM_OPT_SHARED_CLASSES */
@@ -1905,6 +1970,10 @@ typedef struct J9BytecodeVerificationData {
 	struct J9PortLibrary * portLib;
 	struct J9JavaVM* javaVM;
 	BOOLEAN createdStackMap;
+	U_8* verificationRecord;
+	UDATA verificationRecordSize;
+	UDATA verificationRecordLength;
+	UDATA verificationRecordState;
 } J9BytecodeVerificationData;
 
 /* @ddr_namespace: map_to_type=J9NativeLibrary */
@@ -4467,6 +4536,10 @@ typedef struct J9MemoryManagerFunctions {
 	I_32  ( *j9gc_get_jit_string_dedup_policy)(struct J9JavaVM *javaVM) ;
 	UDATA ( *j9gc_stringHashFn)(void *key, void *userData);
 	UDATA ( *j9gc_stringHashEqualFn)(void *leftKey, void *rightKey, void *userData);
+	UDATA  ( *j9mm_get_parallel_iteration_thread_count)(struct J9JavaVM *vm) ;
+	jvmtiIterationControl  ( *j9mm_iterate_all_objects_parallel)(struct J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateObjectDescriptor *object, void *userData), void **userData) ;
+	void*  ( *j9mm_find_region_unit_top)(struct J9JavaVM *vm, struct J9MM_IterateRegionDescriptor *region, void *base, UDATA unitSize) ;
+	jvmtiIterationControl  ( *j9mm_iterate_region_range_objects)(struct J9JavaVM *vm, J9PortLibrary *portLibrary, struct J9MM_IterateRegionDescriptor *region, void *base, void *top, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateObjectDescriptor *objectDesc, void *userData), void *userData) ;
 } J9MemoryManagerFunctions;
 
 typedef struct J9InternalVMFunctions {
@@ -61,6 +61,8 @@ jlong JNICALL
 Java_com_ibm_oti_shared_SharedClassStatistics_minJitDataBytesImpl(JNIEnv* env, jobject thisObj);
 jlong JNICALL
 Java_com_ibm_oti_shared_SharedClassStatistics_maxJitDataBytesImpl(JNIEnv* env, jobject thisObj);
+jlongArray JNICALL
+Java_com_ibm_oti_shared_SharedClassStatistics_lookupStatsImpl(JNIEnv* env, jobject thisObj);
 jboolean JNICALL 
 Java_com_ibm_oti_shared_SharedAbstractHelper_getIsVerboseImpl (JNIEnv* env, jobject thisObj);
 void JNICALL 
@@ -224,6 +224,43 @@ typedef struct AttachedDataWrapper {
 #define ADWDATA(adw) (((U_8*)(adw)) + sizeof(AttachedDataWrapper))
 #define ADWITEM(adw) (((U_8*)(adw)) - sizeof(ShcItem))
 
+/* The class index lives at the end of the readWrite area (J9SharedCacheHeader.classIndexSRP).
+ * J9SharedCacheHeader.classIndexSRP and classIndexBytes are only valid if J9SHR_EXTRA_FLAGS_CLASS_INDEX is set.
+ * It is a J9SharedClassIndexHeader followed by an SRP hashtable of J9SharedClassIndexEntry
+ * which maps the hash of a class name to the ROMClass, scoped ROMClass and orphan items stored under it.
+ */
+typedef struct J9SharedClassIndexHeader {
+	UDATA indexedSRP; /* offset from the cache header of the ShcItemHdr of the first item not yet indexed, 0 if nothing is indexed */
+	UDATA flags;
+} J9SharedClassIndexHeader;
+
+#define J9SHR_CLASS_INDEX_FULL 0x1
+
+typedef struct J9SharedClassIndexEntry {
+	U_32 nameHash;
+	U_32 itemOffset; /* offset of the ShcItem from the cache header, 0 if the entry is not yet filled in */
+} J9SharedClassIndexEntry;
+
+#define CLASSINDEXTABLE(cih) (((U_8*)(cih)) + sizeof(J9SharedClassIndexHeader))
+
+/* A heap archive record (J9SHR_DATA_TYPE_HEAPARCHIVE) is a J9SharedHeapArchiveHeader followed by U_32 words
+ * describing objectCount objects, each one after the objects it refers to, and then fieldCount static fields
+ * which refer to the objects by their index (starting at 1) in the record.
+ */
+typedef struct J9SharedHeapArchiveHeader {
+	J9ShrOffset romClassOffset; /* ROMClass of the class whose static fields are archived */
+	U_32 objectCount;
+	U_32 fieldCount;
+} J9SharedHeapArchiveHeader;
+
+/* A class preload list (J9SHR_DATA_TYPE_PRELOAD_CLASSES) is a J9SharedClassPreloadListHeader followed by classCount
+ * entries, each a U_16 length and the UTF8 name of a bootstrap class. Superclasses are listed before their subclasses.
+ * The entries are not aligned.
+ */
+typedef struct J9SharedClassPreloadListHeader {
+	U_32 classCount;
+} J9SharedClassPreloadListHeader;
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,12 +55,15 @@
 #define J9SHR_DATA_TYPE_STARTUP_HINTS 10
 #define J9SHR_DATA_TYPE_AOTCLASSCHAIN 11
 #define J9SHR_DATA_TYPE_AOTTHUNK 12
-#define J9SHR_DATA_TYPE_MAX 12
+#define J9SHR_DATA_TYPE_HEAPARCHIVE 13
+#define J9SHR_DATA_TYPE_PRELOAD_CLASSES 14
+#define J9SHR_DATA_TYPE_MAX 14
 
 #define J9SHR_ATTACHED_DATA_TYPE_UNKNOWN  0
 #define J9SHR_ATTACHED_DATA_TYPE_JITPROFILE  1
 #define J9SHR_ATTACHED_DATA_TYPE_JITHINT  2
-#define J9SHR_ATTACHED_DATA_TYPE_MAX 2
+#define J9SHR_ATTACHED_DATA_TYPE_VERIFICATION  3
+#define J9SHR_ATTACHED_DATA_TYPE_MAX 3
 
 #define J9SHR_RUNTIMEFLAG_ENABLE_TIMESTAMP_CHECKS  1
 #define J9SHR_RUNTIMEFLAG_ENABLE_LOCAL_CACHEING  2
@@ -164,6 +167,7 @@
 #define J9SHR_EXTRA_FLAGS_MPROTECT_PARTIAL_PAGES 0x40
 #define J9SHR_EXTRA_FLAGS_RESTRICT_CLASSPATHS 0x80
 #define J9SHR_EXTRA_FLAGS_MPROTECT_PARTIAL_PAGES_ON_STARTUP 0x100
+#define J9SHR_EXTRA_FLAGS_CLASS_INDEX 0x200
 
 #define J9SHR_RESOURCE_TYPE_UNKNOWN 0
 #define J9SHR_ATTACHED_DATA_NO_FLAGS 0
@@ -176,6 +180,12 @@
 #define J9SHR_JIT_SPACE_FULL		0x4
 #define J9SHR_AVAILABLE_SPACE_FULL	0x8
 
+/* Flags in J9SharedClassJavacoreDataDescriptor.cacheMappingFlags */
+#define J9SHR_MAPPING_HUGE_PAGES_REQUESTED 0x1
+#define J9SHR_MAPPING_HUGE_PAGES_ADVISED 0x2
+#define J9SHR_MAPPING_NUMA_INTERLEAVE_REQUESTED 0x4
+#define J9SHR_MAPPING_NUMA_INTERLEAVED 0x8
+
 #define J9SHR_ALL_CACHE_FULL_BITS (J9SHR_BLOCK_SPACE_FULL | J9SHR_AOT_SPACE_FULL | J9SHR_JIT_SPACE_FULL | J9SHR_AVAILABLE_SPACE_FULL)
 
 /* The following flags are used by the return code of SH_CompositeCacheImpl::tryAdjustMinMaxSizes() to indicate whether
@@ -24,12 +24,18 @@
 #include <string.h>
 #include "FileStream.hpp"
 #include "../oti/util_api.h"
+#include "zlib.h"
+
+/* Size of the buffer holding compressed data before it is written to the file */
+#define FILESTREAM_ZBUFFER_SIZE (256 * 1024)
 
 /* Constructor */
 FileStream::FileStream(J9PortLibrary* portLibrary) :
 	_PortLibrary(portLibrary),
 	_FileHandle(-1),
-	_Error(0)
+	_Error(0),
+	_ZStream(NULL),
+	_ZBuffer(NULL)
 {
 	/* Nothing to do */
 }
@@ -42,11 +48,29 @@ FileStream::~FileStream()
 
 /* Method for opening the file */
 void
-FileStream::open(const char* fileName)
+FileStream::open(const char* fileName, bool compress)
 {
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
 	if (fileName[0] != '-' ) {
 		_FileHandle = j9cached_file_open(_PortLibrary, fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenCreateNoTag, 0666);
 		_Error = 0;
+
+		if (compress && (_FileHandle != -1)) {
+			_ZStream = (z_stream_s*)j9mem_allocate_memory(sizeof(z_stream), OMRMEM_CATEGORY_VM);
+			_ZBuffer = (char*)j9mem_allocate_memory(FILESTREAM_ZBUFFER_SIZE, OMRMEM_CATEGORY_VM);
+			if ((NULL == _ZStream) || (NULL == _ZBuffer)) {
+				_Error = -1;
+			} else {
+				memset(_ZStream, 0, sizeof(z_stream));
+				/* windowBits of 15 + 16 selects a gzip wrapper rather than a raw zlib stream */
+				if (Z_OK != deflateInit2(_ZStream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY)) {
+					j9mem_free_memory(_ZStream);
+					_ZStream = NULL;
+					_Error = -1;
+				}
+			}
+		}
 	}
 }
 
@@ -54,6 +78,8 @@ FileStream::open(const char* fileName)
 void 
 FileStream::close(void)
 {
+	closeCompression();
+
 	if (_FileHandle != -1) {
 		j9cached_file_sync(_PortLibrary, _FileHandle);
 		j9cached_file_close(_PortLibrary, _FileHandle);
@@ -76,6 +102,17 @@ bool FileStream::hasError(void) const
 /* Method for writing characters described by a pointer and a length to the file*/
 void
 FileStream::writeCharacters(const char* data, IDATA length)
+{
+	if (NULL != _ZStream) {
+		deflateData(data, length, Z_NO_FLUSH);
+	} else {
+		writeRaw(data, length);
+	}
+}
+
+/* Method for writing data to the file without compression */
+void
+FileStream::writeRaw(const char* data, IDATA length)
 {
 	if (_FileHandle != -1 && ! _Error) {
 		IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
@@ -86,6 +123,45 @@ FileStream::writeCharacters(const char* data, IDATA length)
 	}
 }
 
+/* Method for compressing data and writing the compressed form to the file */
+void
+FileStream::deflateData(const char* data, IDATA length, int flush)
+{
+	_ZStream->next_in = (Bytef*)data;
+	_ZStream->avail_in = (uInt)length;
+
+	do {
+		_ZStream->next_out = (Bytef*)_ZBuffer;
+		_ZStream->avail_out = FILESTREAM_ZBUFFER_SIZE;
+		int rc = deflate(_ZStream, flush);
+		if ((Z_STREAM_ERROR == rc) || (0 != _Error)) {
+			_Error = -1;
+			break;
+		}
+		writeRaw(_ZBuffer, FILESTREAM_ZBUFFER_SIZE - _ZStream->avail_out);
+	} while (0 == _ZStream->avail_out);
+}
+
+/* Method for flushing the compressed stream and releasing its resources */
+void
+FileStream::closeCompression(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (NULL != _ZStream) {
+		if (! _Error) {
+			deflateData(NULL, 0, Z_FINISH);
+		}
+		deflateEnd(_ZStream);
+		j9mem_free_memory(_ZStream);
+		_ZStream = NULL;
+	}
+	if (NULL != _ZBuffer) {
+		j9mem_free_memory(_ZBuffer);
+		_ZBuffer = NULL;
+	}
+}
+
 void
 FileStream::writeCharacters(const char* data)
 {
@@ -25,6 +25,8 @@
 /* Includes */
 #include "j9port.h"
 
+struct z_stream_s;
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* Class for writing to a file                                                                    */
@@ -39,8 +41,8 @@ public :
 	/* Destructor */
 	~FileStream();
 
-	/* Method for opening the file */
-	void open(const char* fileName);
+	/* Method for opening the file, optionally gzip compressing everything written to it */
+	void open(const char* fileName, bool compress = false);
 
 	/* Method for closing the file */
 	void close(void);
@@ -59,11 +61,18 @@ private :
 	FileStream(const FileStream& source);
 	FileStream& operator=(const FileStream& source);
 
+	/* Methods for compressed output */
+	void writeRaw(const char* data, IDATA length);
+	void deflateData(const char* data, IDATA length, int flush);
+	void closeCompression(void);
+
 protected :
 	/* Declared data */
 	J9PortLibrary* _PortLibrary;
 	IDATA          _FileHandle;
 	IDATA          _Error;
+	z_stream_s*    _ZStream;
+	char*          _ZBuffer;
 };
 
 #endif
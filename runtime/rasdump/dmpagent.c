@@ -173,6 +173,7 @@ static const J9RASdumpRequest rasDumpRequests[] =
 
 static void updatePercentLastToken(J9JavaVM *vm, char *label);
 static omr_error_t makePath (J9JavaVM *vm, char *label);
+static BOOLEAN isCompressedHeapDump(J9RASdumpAgent *agent);
 static char* allocString (J9JavaVM *vm, UDATA numBytes);
 static omr_error_t mergeAgent (J9JavaVM *vm, J9RASdumpAgent *agent, const J9RASdumpSettings *settings);
 static IDATA fixDumpLabel (J9JavaVM *vm, const J9RASdumpSpec *spec, char **labelPtr, IDATA newLabel);
@@ -937,11 +938,28 @@ doJavaDump(J9RASdumpAgent *agent, char *label, J9RASdumpContext *context)
 }
 
 
+/*
+ * opts=PHD+COMPRESS writes the PHD file gzipped, with ".gz" added to its name
+ */
+static BOOLEAN
+isCompressedHeapDump(J9RASdumpAgent *agent)
+{
+	return (NULL != agent->dumpOptions) && (NULL != strstr(agent->dumpOptions, "PHD")) && (NULL != strstr(agent->dumpOptions, "COMPRESS"));
+}
+
 omr_error_t
 doHeapDump(J9RASdumpAgent *agent, char *label, J9RASdumpContext *context)
 {
 	J9JavaVM *vm = context->javaVM;
 
+	if (isCompressedHeapDump(agent)) {
+		/* Name the file as it is written, so that the %last token and the dump list report the real file */
+		UDATA length = strlen(label);
+		if (((length < 3) || (0 != strcmp(&label[length - 3], ".gz"))) && ((length + 3) < J9_MAX_DUMP_PATH)) {
+			strcat(label, ".gz");
+		}
+	}
+
 	if (makePath(vm, label) == OMR_ERROR_INTERNAL) {
 		/* Nowhere available to write the dump, we are done, makePath() will have issued error message */
 		return OMR_ERROR_INTERNAL;
@@ -1862,7 +1880,7 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 					"        [+<name>...]     (see -Xdump:request)\n");
 
 				if (strcmp(spec->name, "heap") == 0) {
-					j9tty_err_printf(PORTLIB, "\n  opts=PHD|CLASSIC\n");
+					j9tty_err_printf(PORTLIB, "\n  opts=PHD|CLASSIC|PARALLEL|COMPRESS\n");
 				} else if (strcmp(spec->name, "tool") == 0) {
 					j9tty_err_printf(PORTLIB, "\n  opts=WAIT<msec>|ASYNC\n");
 #ifdef J9ZOS390
@@ -2819,6 +2837,13 @@ runDumpAgent(struct J9JavaVM *vm, J9RASdumpAgent * agent, J9RASdumpContext * con
 					}
 
 					if (agent->dumpOptions && strstr(agent->dumpOptions, "CLASSIC")) {
+						/* the classic dump is not compressed, see runHeapdump */
+						if (isCompressedHeapDump(agent)) {
+							UDATA labelLength = strlen(label);
+							if ((labelLength >= 3) && (strcmp(&label[labelLength - 3], ".gz") == 0)) {
+								label[labelLength - 3] = '\0';
+							}
+						}
 						/* do label hackery for classic, see writeClassicHeapdump */
 						if (reqLen >= 4 && strcmp(&label[reqLen - 4], ".phd") == 0) {
 							strcpy(&label[reqLen - 4], ".txt");
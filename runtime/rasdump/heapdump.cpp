@@ -39,10 +39,20 @@ static jvmtiIterationControl binaryHeapDumpHeapIteratorCallback   (J9JavaVM* vm,
 static jvmtiIterationControl binaryHeapDumpSpaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
 static jvmtiIterationControl binaryHeapDumpRegionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectIteratorCallback (J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor,  void* userData);
+static jvmtiIterationControl binaryHeapDumpRegionCollectorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+static jvmtiIterationControl binaryHeapDumpParallelObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor, void* userData);
+static int J9THREAD_PROC binaryHeapDumpHelperThreadProc(void* entryArg);
 
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorTraitsCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 
+/* Limits for the parallel heap walk (opts=PARALLEL) */
+#define HEAPDUMP_MAX_HELPER_THREADS 16
+#define HEAPDUMP_UNITS_PER_HELPER 2
+#define HEAPDUMP_UNIT_SIZE (4 * 1024 * 1024)
+#define HEAPDUMP_INITIAL_UNIT_BUFFER_SIZE (64 * 1024)
+#define HEAPDUMP_MAX_BUFFERED_UNIT_SIZE (64 * 1024 * 1024)
+
 #define allClassesStartDo(vm, state, loader) \
 	vm->internalVMFunctions->allClassesStartDo(state, vm, loader)
 
@@ -756,6 +766,9 @@ private :
 	friend jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpHeapIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor* heapDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl binaryHeapDumpRegionCollectorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl binaryHeapDumpParallelObjectIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, void* userData);
+	friend int J9THREAD_PROC binaryHeapDumpHelperThreadProc(void* entryArg);
 
 	/* Nested class for determining the characteristics of the references */
 	class ReferenceTraits
@@ -828,6 +841,10 @@ private :
 
 		/* Method for setting the object back to its initial state (i.e. empty) */
 		void clear(void);
+
+		/* Methods for saving the cache of a unit and replaying it onto the cache of the whole dump */
+		void save(const void** cache, int* index) const;
+		void merge(const void* const* cache, int index, int rotation);
 		
 	private :
 		/* Prevent use of the copy constructor and assignment operator */
@@ -839,11 +856,68 @@ private :
 		int         _Index;
 	};
 
+	/* Records for one unit of a region, written to memory by a helper thread and appended to the file in address order */
+	struct UnitOutput
+	{
+		J9MM_IterateRegionDescriptor* _Region;        /* the region the unit is part of */
+		void*                        _Base;           /* the first object of the unit */
+		void*                        _Top;            /* the end of the unit */
+		J9MM_IterateObjectDescriptor _FirstObject;  /* written by the master thread, since its address offset depends on the previous unit */
+		bool                         _HasFirstObject;
+		bool                         _Direct;         /* too large to buffer, so walked by the master thread */
+		volatile UDATA               _State;
+		void*                        _LastObject;
+		const void*                  _Cache[4];       /* class cache at the end of the unit */
+		int                          _CacheIndex;
+		char*                        _Data;
+		UDATA                        _Size;
+		UDATA                        _Capacity;
+		U_32*                        _ShortRecords;   /* offsets of short records, whose class cache index must be adjusted when merging */
+		UDATA                        _ShortRecordCount;
+		UDATA                        _ShortRecordCapacity;
+	};
+
+	/* State shared by the master and helper threads of a parallel walk */
+	struct ParallelWalk
+	{
+		BinaryHeapDumpWriter*         _Master;
+		J9MM_IterateRegionDescriptor* _Regions;
+		UDATA                         _RegionCount;
+		UDATA                         _RegionCapacity;
+		UDATA                         _NextRegion;      /* region the next unit is split from */
+		void*                         _NextBase;        /* where the next unit starts in that region (NULL for the region start) */
+		UnitOutput*                   _Units;           /* units in address order, split from the regions as they are claimed */
+		UDATA                         _UnitCount;       /* units split so far */
+		UDATA                         _UnitCapacity;    /* most units the regions can be split into */
+		UDATA                         _MergedUnits;     /* units already appended to the file */
+		UDATA                         _Window;          /* maximum number of units buffered ahead of the merge */
+		UDATA                         _ActiveHelpers;
+		bool                          _Abort;
+		omrthread_monitor_t           _Monitor;
+	};
+
+	enum {
+		UNIT_PENDING = 0,
+		UNIT_CLAIMED,
+		UNIT_COMPLETE,
+		UNIT_FAILED
+	};
+
 	friend class ReferenceTraits;
 	friend class ReferenceWriter;
 
+	/* Constructor for the writers used by helper threads to encode regions into memory */
+	BinaryHeapDumpWriter(BinaryHeapDumpWriter* master);
+
 	/* Internal methods */
 	void             openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDesriptor);
+	bool             writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor);
+	UnitOutput*      splitNextUnit(ParallelWalk* walk);
+	void             mergeUnit(UnitOutput* unit);
+	void             walkUnit(UnitOutput* unit);
+	void             helperThreadMain(ParallelWalk* walk);
+	bool             appendToUnit(const char* data, IDATA length);
+	void             noteShortRecord(void);
 	void             writeDumpFileHeader(void);
 	void             writeDumpFileTrailer(void);
 	void             writeFullVersionRecord(void);
@@ -873,6 +947,11 @@ private :
 	ClassCache        _ClassCache;
 	bool              _FileMode;
 	bool              _Error;
+	bool              _Parallel;       /* opts=PARALLEL: walk regions on helper threads */
+	bool              _Compress;       /* opts=COMPRESS: gzip the dump file */
+	UnitOutput*       _UnitOutput;     /* for helper writers, the unit being encoded */
+	UDATA             _WalkThreads;    /* number of threads which walked the heap */
+	U_64              _WalkTime;       /* microseconds spent walking the heap */
 
 	/* Static methods returning constant values */
 	inline static const char* identifierField(void)        {return "portable heap dump";}
@@ -1107,6 +1186,39 @@ BinaryHeapDumpWriter::ClassCache::clear(void)
 	_Index = 0;
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ClassCache::save() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::ClassCache::save(const void** cache, int* index) const
+{
+	for (int i = 0; i < 4; i++) {
+		cache[i] = _Cache[i];
+	}
+
+	*index = _Index;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ClassCache::merge() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::ClassCache::merge(const void* const* cache, int index, int rotation)
+{
+	/* A unit is encoded starting from an empty cache, so the reader holds the unit's entry i in entry (i + rotation) */
+	for (int i = 0; i < 4; i++) {
+		if (0 != cache[i]) {
+			_Cache[(i + rotation) % 4] = cache[i];
+		}
+	}
+
+	_Index = (index + rotation) % 4;
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::BinaryHeapDumpWriter() method implementation                             */
@@ -1124,7 +1236,12 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_OutputStream(context->javaVM->portLibrary),
 	_CurrentObject(0),
 	_FileMode(false),
-	_Error(false)
+	_Error(false),
+	_Parallel(false),
+	_Compress(false),
+	_UnitOutput(NULL),
+	_WalkThreads(1),
+	_WalkTime(0)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
 
@@ -1132,8 +1249,16 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	if ((agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "PHD") == 0)) {
 		return;
 	}
+
+	U_64 startTime = j9time_hires_clock();
+
+	/* Check for the optional parallel walk and compression */
+	if (agent->dumpOptions != 0) {
+		_Parallel = (strstr(agent->dumpOptions, "PARALLEL") != 0);
+		_Compress = (strstr(agent->dumpOptions, "COMPRESS") != 0);
+	}
 	
-	/* Remember the file name */
+	/* Remember the file name, doHeapDump() has already added ".gz" to it for opts=COMPRESS */
 	_FileName += fileName;
 	
 	/* Handle the cases of multiple dump files and a single dump file separately */
@@ -1142,7 +1267,7 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
 		
 		/* It's a single file so open it */
-		_OutputStream.open(_FileName.data());
+		_OutputStream.open(_FileName.data(), _Compress);
 	
 		/* Performance measuring code 
 		startTimer();
@@ -1184,6 +1309,39 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 			}
 		}
 	}
+
+	/* Trace how long the dump took, the heap is walked with the VM paused so this is the pause it caused */
+	if (! _Error) {
+		U_64 dumpTime = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MILLISECONDS);
+		Trc_dump_heapdumpTime_Event1(dumpTime, _WalkTime / 1000, _WalkThreads);
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::BinaryHeapDumpWriter(BinaryHeapDumpWriter*) method implementation        */
+/*                                                                                                */
+/**************************************************************************************************/
+BinaryHeapDumpWriter::BinaryHeapDumpWriter(BinaryHeapDumpWriter* master) :
+	_Id(0),
+	_RegionStart(NULL),
+	_RegionEnd(NULL),
+	_Context(master->_Context),
+	_Agent(master->_Agent),
+	_VirtualMachine(master->_VirtualMachine),
+	_PortLibrary(master->_PortLibrary),
+	_FileName(master->_PortLibrary),
+	_OutputStream(master->_PortLibrary),
+	_CurrentObject(0),
+	_FileMode(false),
+	_Error(false),
+	_Parallel(false),
+	_Compress(false),
+	_UnitOutput(NULL),
+	_WalkThreads(0),
+	_WalkTime(0)
+{
+	/* Nothing to do - the helper writer only encodes the units given to walkUnit() */
 }
 
 /**************************************************************************************************/
@@ -1227,20 +1385,24 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		_ClassCache.clear();
 
 		/* Open the file */
-		_OutputStream.open(fileName.data());
+		_OutputStream.open(fileName.data(), _Compress);
 
 		/* Start writing the file */
 		writeDumpFileHeader();
 	}
 
 	/* Iterate through the regions etc. */
-	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
-			_VirtualMachine,
-			_PortLibrary,
-			spaceDescriptor,
-			j9mm_iterator_flag_regions_read_only,
-			binaryHeapDumpRegionIteratorCallback,
-			this);
+	U_64 walkStartTime = j9time_hires_clock();
+	if (!_Parallel || !writeRegionsInParallel(spaceDescriptor)) {
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+				_VirtualMachine,
+				_PortLibrary,
+				spaceDescriptor,
+				j9mm_iterator_flag_regions_read_only,
+				binaryHeapDumpRegionIteratorCallback,
+				this);
+	}
+	_WalkTime += j9time_hires_delta(walkStartTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
 
 	/* Handle the single and multiple dump file cases separately */
 	if (_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS) {
@@ -1269,6 +1431,350 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 	}
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeRegionsInParallel() method implementation                           */
+/*                                                                                                */
+/**************************************************************************************************/
+bool
+BinaryHeapDumpWriter::writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	ParallelWalk walk;
+	memset(&walk, 0, sizeof(walk));
+	walk._Master = this;
+
+	/* Count the regions and the units they may be split into, there is nothing to gain unless there are at least two units */
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+			_VirtualMachine,
+			_PortLibrary,
+			spaceDescriptor,
+			j9mm_iterator_flag_regions_read_only,
+			binaryHeapDumpRegionCollectorCallback,
+			&walk);
+	if (walk._UnitCapacity < 2) {
+		return false;
+	}
+
+	UDATA threadCount = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET);
+	if (threadCount > HEAPDUMP_MAX_HELPER_THREADS) {
+		threadCount = HEAPDUMP_MAX_HELPER_THREADS;
+	}
+	if (threadCount > walk._UnitCapacity) {
+		threadCount = walk._UnitCapacity;
+	}
+	if (threadCount < 2) {
+		return false;
+	}
+
+	/* Record the regions, the units are split from them as the helpers claim them */
+	walk._Regions = (J9MM_IterateRegionDescriptor*)j9mem_allocate_memory(walk._RegionCount * sizeof(J9MM_IterateRegionDescriptor), OMRMEM_CATEGORY_VM);
+	walk._Units = (UnitOutput*)j9mem_allocate_memory(walk._UnitCapacity * sizeof(UnitOutput), OMRMEM_CATEGORY_VM);
+	if ((NULL == walk._Regions) || (NULL == walk._Units)) {
+		j9mem_free_memory(walk._Regions);
+		j9mem_free_memory(walk._Units);
+		return false;
+	}
+	memset(walk._Units, 0, walk._UnitCapacity * sizeof(UnitOutput));
+	walk._RegionCapacity = walk._RegionCount;
+	walk._RegionCount = 0;
+	walk._UnitCapacity = 0;
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+			_VirtualMachine,
+			_PortLibrary,
+			spaceDescriptor,
+			j9mm_iterator_flag_regions_read_only,
+			binaryHeapDumpRegionCollectorCallback,
+			&walk);
+
+	if (0 != omrthread_monitor_init_with_name(&walk._Monitor, 0, "Heap dump parallel walk")) {
+		j9mem_free_memory(walk._Regions);
+		j9mem_free_memory(walk._Units);
+		return false;
+	}
+
+	/* Start the helpers, which may each run a few units ahead of the merge */
+	walk._Window = threadCount * HEAPDUMP_UNITS_PER_HELPER;
+	omrthread_monitor_enter(walk._Monitor);
+	for (UDATA i = 0; i < threadCount; i++) {
+		walk._ActiveHelpers += 1;
+		if (0 != omrthread_create(NULL, _VirtualMachine->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, 0, binaryHeapDumpHelperThreadProc, &walk)) {
+			walk._ActiveHelpers -= 1;
+			break;
+		}
+	}
+	_WalkThreads = walk._ActiveHelpers + 1;
+	omrthread_monitor_exit(walk._Monitor);
+
+	/* Append the units to the file in address order */
+	UDATA unitIndex = 0;
+	for (unitIndex = 0; !_Error; unitIndex++) {
+		UnitOutput* unit = NULL;
+
+		omrthread_monitor_enter(walk._Monitor);
+		while ((unitIndex >= walk._UnitCount) && (walk._NextRegion < walk._RegionCount) && (0 != walk._ActiveHelpers)) {
+			omrthread_monitor_wait(walk._Monitor);
+		}
+		if (unitIndex < walk._UnitCount) {
+			unit = &walk._Units[unitIndex];
+		} else {
+			/* Every helper has gone, so split the rest of the heap here */
+			unit = splitNextUnit(&walk);
+			if (NULL != unit) {
+				unit->_Direct = true;
+			}
+		}
+		if (NULL != unit) {
+			while (!unit->_Direct && (UNIT_COMPLETE != unit->_State) && (UNIT_FAILED != unit->_State) && (0 != walk._ActiveHelpers)) {
+				omrthread_monitor_wait(walk._Monitor);
+			}
+		}
+		omrthread_monitor_exit(walk._Monitor);
+
+		if (NULL == unit) {
+			break;
+		}
+
+		if (UNIT_COMPLETE == unit->_State) {
+			mergeUnit(unit);
+		} else {
+			/* The unit is too large to buffer, or its helper ran out of memory, so walk it here */
+			_Id = unit->_Region->id;
+			_RegionStart = (char*)unit->_Region->regionStart;
+			_RegionEnd = (char*)((UDATA)unit->_Region->regionStart + unit->_Region->regionSize);
+			_VirtualMachine->memoryManagerFunctions->j9mm_iterate_region_range_objects(
+					_VirtualMachine, _PortLibrary, unit->_Region, unit->_Base, unit->_Top, 0, binaryHeapDumpObjectIteratorCallback, this);
+		}
+
+		j9mem_free_memory(unit->_Data);
+		j9mem_free_memory(unit->_ShortRecords);
+		unit->_Data = NULL;
+		unit->_ShortRecords = NULL;
+
+		omrthread_monitor_enter(walk._Monitor);
+		walk._MergedUnits = unitIndex + 1;
+		omrthread_monitor_notify_all(walk._Monitor);
+		omrthread_monitor_exit(walk._Monitor);
+	}
+
+	/* Stop the helpers and wait for them to finish with the shared state */
+	omrthread_monitor_enter(walk._Monitor);
+	walk._Abort = true;
+	omrthread_monitor_notify_all(walk._Monitor);
+	while (0 != walk._ActiveHelpers) {
+		omrthread_monitor_wait(walk._Monitor);
+	}
+	omrthread_monitor_exit(walk._Monitor);
+
+	for (; unitIndex < walk._UnitCount; unitIndex++) {
+		j9mem_free_memory(walk._Units[unitIndex]._Data);
+		j9mem_free_memory(walk._Units[unitIndex]._ShortRecords);
+	}
+	omrthread_monitor_destroy(walk._Monitor);
+	j9mem_free_memory(walk._Units);
+	j9mem_free_memory(walk._Regions);
+
+	return true;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::splitNextUnit() method implementation                                    */
+/*                                                                                                */
+/**************************************************************************************************/
+BinaryHeapDumpWriter::UnitOutput*
+BinaryHeapDumpWriter::splitNextUnit(ParallelWalk* walk)
+{
+	/* Called with the walk monitor held: units are split in address order, so the merge can follow them */
+	if ((walk->_NextRegion >= walk->_RegionCount) || (walk->_UnitCount >= walk->_UnitCapacity)) {
+		return NULL;
+	}
+
+	J9MM_IterateRegionDescriptor* region = &walk->_Regions[walk->_NextRegion];
+	void* regionTop = (void*)((UDATA)region->regionStart + region->regionSize);
+	void* base = (NULL == walk->_NextBase) ? region->regionStart : walk->_NextBase;
+	void* top = regionTop;
+
+	/* Only the object headers of this unit are walked to find where it ends. Each unit but the last of a
+	 * region is at least HEAPDUMP_UNIT_SIZE bytes so the capacity suffices, but the last unit of the array
+	 * always takes the rest of its region. */
+	if ((walk->_UnitCount + 1) < walk->_UnitCapacity) {
+		top = _VirtualMachine->memoryManagerFunctions->j9mm_find_region_unit_top(_VirtualMachine, region, base, HEAPDUMP_UNIT_SIZE);
+	}
+	if (top < regionTop) {
+		walk->_NextBase = top;
+	} else {
+		walk->_NextRegion += 1;
+		walk->_NextBase = NULL;
+	}
+
+	UnitOutput* unit = &walk->_Units[walk->_UnitCount];
+	walk->_UnitCount += 1;
+	unit->_Region = region;
+	unit->_Base = base;
+	unit->_Top = top;
+	unit->_Direct = (((UDATA)top - (UDATA)base) > HEAPDUMP_MAX_BUFFERED_UNIT_SIZE);
+	return unit;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::mergeUnit() method implementation                                        */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::mergeUnit(UnitOutput* unit)
+{
+	if (!unit->_HasFirstObject) {
+		/* Nothing was written for the unit */
+		return;
+	}
+
+	/* The first record's address offset is relative to the end of the previous unit, so write it here */
+	writeObjectRecord(&unit->_FirstObject);
+	if (_Error) {
+		return;
+	}
+
+	/* The unit was encoded starting from an empty class cache, so short records must be
+	 * adjusted to the entries the reader will have used for the unit's classes */
+	int rotation = _ClassCache.index();
+	if (0 != rotation) {
+		for (UDATA i = 0; i < unit->_ShortRecordCount; i++) {
+			char* flags = unit->_Data + unit->_ShortRecords[i];
+			int cacheIndex = (((*flags >> 5) & 0x03) + rotation) % 4;
+			*flags = (char)((*flags & ~0x60) | ((cacheIndex << 5) & 0x60));
+		}
+	}
+
+	writeCharacters(unit->_Data, unit->_Size);
+
+	_ClassCache.merge(unit->_Cache, unit->_CacheIndex, rotation);
+	_CurrentObject = unit->_LastObject;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::walkUnit() method implementation                                         */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::walkUnit(UnitOutput* unit)
+{
+	/* Start the unit from a known state so it can be merged after any other unit */
+	_UnitOutput = unit;
+	_CurrentObject = 0;
+	_ClassCache.clear();
+	_Error = false;
+
+	_Id = unit->_Region->id;
+	_RegionStart = (char*)unit->_Region->regionStart;
+	_RegionEnd = (char*)((UDATA)unit->_Region->regionStart + unit->_Region->regionSize);
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_region_range_objects(
+			_VirtualMachine, _PortLibrary, unit->_Region, unit->_Base, unit->_Top, 0, binaryHeapDumpParallelObjectIteratorCallback, this);
+
+	unit->_LastObject = _CurrentObject;
+	_ClassCache.save(unit->_Cache, &unit->_CacheIndex);
+	_UnitOutput = NULL;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::helperThreadMain() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::helperThreadMain(ParallelWalk* walk)
+{
+	omrthread_monitor_enter(walk->_Monitor);
+	while (!walk->_Abort) {
+		/* Bound the memory used by waiting for the master thread to catch up */
+		if (walk->_UnitCount >= (walk->_MergedUnits + walk->_Window)) {
+			omrthread_monitor_wait(walk->_Monitor);
+			continue;
+		}
+
+		UnitOutput* unit = splitNextUnit(walk);
+		if (NULL == unit) {
+			break;
+		}
+		if (unit->_Direct) {
+			/* Units too large to buffer are left to the master thread */
+			omrthread_monitor_notify_all(walk->_Monitor);
+			continue;
+		}
+		unit->_State = UNIT_CLAIMED;
+		omrthread_monitor_exit(walk->_Monitor);
+
+		walkUnit(unit);
+
+		omrthread_monitor_enter(walk->_Monitor);
+		unit->_State = _Error ? UNIT_FAILED : UNIT_COMPLETE;
+		omrthread_monitor_notify_all(walk->_Monitor);
+	}
+	walk->_ActiveHelpers -= 1;
+	omrthread_monitor_notify_all(walk->_Monitor);
+	omrthread_monitor_exit(walk->_Monitor);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::appendToUnit() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+bool
+BinaryHeapDumpWriter::appendToUnit(const char* data, IDATA length)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	UnitOutput* unit = _UnitOutput;
+
+	if ((unit->_Size + length) > unit->_Capacity) {
+		UDATA capacity = (0 == unit->_Capacity) ? HEAPDUMP_INITIAL_UNIT_BUFFER_SIZE : (unit->_Capacity * 2);
+		while ((unit->_Size + length) > capacity) {
+			capacity *= 2;
+		}
+		char* newData = (char*)j9mem_allocate_memory(capacity, OMRMEM_CATEGORY_VM);
+		if (NULL == newData) {
+			return false;
+		}
+		memcpy(newData, unit->_Data, unit->_Size);
+		j9mem_free_memory(unit->_Data);
+		unit->_Data = newData;
+		unit->_Capacity = capacity;
+	}
+
+	memcpy(unit->_Data + unit->_Size, data, length);
+	unit->_Size += length;
+	return true;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::noteShortRecord() method implementation                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::noteShortRecord(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	UnitOutput* unit = _UnitOutput;
+
+	if (unit->_ShortRecordCount == unit->_ShortRecordCapacity) {
+		UDATA capacity = (0 == unit->_ShortRecordCapacity) ? 1024 : (unit->_ShortRecordCapacity * 2);
+		U_32* records = (U_32*)j9mem_allocate_memory(capacity * sizeof(U_32), OMRMEM_CATEGORY_VM);
+		if (NULL == records) {
+			_Error = true;
+			return;
+		}
+		memcpy(records, unit->_ShortRecords, unit->_ShortRecordCount * sizeof(U_32));
+		j9mem_free_memory(unit->_ShortRecords);
+		unit->_ShortRecords = records;
+		unit->_ShortRecordCapacity = capacity;
+	}
+
+	unit->_ShortRecords[unit->_ShortRecordCount++] = (U_32)unit->_Size;
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::writeDumpFileHeader() method implementation                              */
@@ -1465,6 +1971,11 @@ BinaryHeapDumpWriter::writeNormalObjectRecord(J9MM_IterateObjectDescriptor* obje
 		    (((int)referenceTraits.count() << 3) & 0x18) |
 		    ( addressOffsetEncoding   << 2  & 0x04) |
 		    ( referenceOffsetEncoding       & 0x03);
+
+		/* Remember where the class cache index is written so it can be adjusted when the unit is merged */
+		if (NULL != _UnitOutput) {
+			noteShortRecord();
+		}
 		    
 		/* Write the tag/flags */
 		writeNumber(flags, 1);
@@ -2395,9 +2906,13 @@ void
 BinaryHeapDumpWriter::writeCharacters (const char* data, IDATA length)
 {
 	if (!_Error) {
-		_OutputStream.writeCharacters(data,length);
+		if (NULL != _UnitOutput) {
+			_Error = !appendToUnit(data, length);
+		} else {
+			_OutputStream.writeCharacters(data,length);
 
-		checkForIOError();
+			checkForIOError();
+		}
 	}
 }
 
@@ -2405,9 +2920,13 @@ void
 BinaryHeapDumpWriter::writeCharacters (const char* data)
 {
 	if (!_Error) {
-		_OutputStream.writeCharacters(data);
+		if (NULL != _UnitOutput) {
+			_Error = !appendToUnit(data, strlen(data));
+		} else {
+			_OutputStream.writeCharacters(data);
 
-		checkForIOError();
+			checkForIOError();
+		}
 	}
 }
 
@@ -2415,9 +2934,22 @@ void
 BinaryHeapDumpWriter::writeNumber (IDATA data, int length)
 {
 	if (!_Error) {
-		_OutputStream.writeNumber(data, length);
+		if (NULL != _UnitOutput) {
+			/* Encode the number in network order, as FileStream does */
+			IDATA number = data;
+			int   count  = (length > 8) ? 8 : length;
+			char  buffer[8] = {0,0,0,0,0,0,0,0};
+
+			while (count-- > 0) {
+				buffer[count] = (char)(number & 0xFF);
+				number >>= 8;
+			}
+			_Error = !appendToUnit(buffer, length);
+		} else {
+			_OutputStream.writeNumber(data, length);
 
-		checkForIOError();
+			checkForIOError();
+		}
 	}
 }
 
@@ -2459,6 +2991,52 @@ binaryHeapDumpObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor*
 	return ((BinaryHeapDumpWriter*)userData)->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
 }
 
+static jvmtiIterationControl
+binaryHeapDumpRegionCollectorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData)
+{
+	BinaryHeapDumpWriter::ParallelWalk* walk = (BinaryHeapDumpWriter::ParallelWalk*)userData;
+
+	/* Without a region array this only counts the regions */
+	if (NULL != walk->_Regions) {
+		if (walk->_RegionCount >= walk->_RegionCapacity) {
+			return JVMTI_ITERATION_ABORT;
+		}
+		walk->_Regions[walk->_RegionCount] = *regionDescription;
+	}
+	walk->_RegionCount += 1;
+
+	/* Every unit but the last of a region is at least HEAPDUMP_UNIT_SIZE bytes */
+	walk->_UnitCapacity += (regionDescription->regionSize + HEAPDUMP_UNIT_SIZE - 1) / HEAPDUMP_UNIT_SIZE;
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+binaryHeapDumpParallelObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor, void* userData)
+{
+	BinaryHeapDumpWriter* heapDumpWriter = (BinaryHeapDumpWriter*)userData;
+	BinaryHeapDumpWriter::UnitOutput* unit = heapDumpWriter->_UnitOutput;
+
+	if (unit->_HasFirstObject) {
+		heapDumpWriter->writeObjectRecord(objectDescriptor);
+	} else if (!J9VM_IS_INITIALIZED_HEAPCLASS_VM(vm, objectDescriptor->object)) {
+		/* Leave the first record to the master thread and encode the rest relative to this object */
+		unit->_FirstObject = *objectDescriptor;
+		unit->_HasFirstObject = true;
+		heapDumpWriter->_CurrentObject = objectDescriptor->object;
+	}
+	return heapDumpWriter->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
+static int J9THREAD_PROC
+binaryHeapDumpHelperThreadProc(void* entryArg)
+{
+	BinaryHeapDumpWriter::ParallelWalk* walk = (BinaryHeapDumpWriter::ParallelWalk*)entryArg;
+	BinaryHeapDumpWriter helper(walk->_Master);
+
+	helper.helperThreadMain(walk);
+	return 0;
+}
+
 static jvmtiIterationControl
 binaryHeapDumpObjectReferenceIteratorTraitsCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData)
 {
@@ -2497,7 +3075,20 @@ runHeapdump(char *label, J9RASdumpContext *context, J9RASdumpAgent* agent)
 	}
 
 	if (agent->dumpOptions && strstr(agent->dumpOptions, "CLASSIC")) {
-		writeClassicHeapdump(label, context, agent);
+		if (strstr(agent->dumpOptions, "PHD") && strstr(agent->dumpOptions, "COMPRESS")) {
+			/* Only the PHD file is compressed, so the classic dump is named without the ".gz" added by doHeapDump() */
+			char classicLabel[EsMaxPath]; /* J9_MAX_DUMP_PATH */
+			UDATA length = strlen(label);
+
+			strncpy(classicLabel, label, sizeof(classicLabel));
+			classicLabel[sizeof(classicLabel) - 1] = '\0';
+			if ((length >= 3) && (length < sizeof(classicLabel)) && (0 == strcmp(&classicLabel[length - 3], ".gz"))) {
+				classicLabel[length - 3] = '\0';
+			}
+			writeClassicHeapdump(classicLabel, context, agent);
+		} else {
+			writeClassicHeapdump(label, context, agent);
+		}
 	}
 
 	if (agent->dumpOptions && strstr(agent->dumpOptions, "PHD")) {
@@ -284,6 +284,7 @@ private :
 	void writeSharedClassSectionTopLayerStatsHelper(J9SharedClassJavacoreDataDescriptor* javacoreData, bool multiLayerStats);
 	void writeSharedClassSectionTopLayerStatsSummaryHelper(J9SharedClassJavacoreDataDescriptor* javacoreData);
 	void writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJavacoreDataDescriptor* javacoreData);
+	void writeSharedClassSectionLookupStatsHelper(void);
 
 #endif
 	void writeTrailer(void);
@@ -3200,6 +3201,60 @@ JavaCoreDumpWriter::writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJav
 	);
 	_OutputStream.writeInteger(javacoreData->numStartupHints, "%zu");
 
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTSPR            Startup pages read ahead from disk        = "
+	);
+	_OutputStream.writeInteger(javacoreData->startupPagesReadAhead, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTSPT            Startup pages accessed                    = "
+	);
+	_OutputStream.writeInteger(javacoreData->startupPagesTouched, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTSPA            Startup faults avoided by read ahead      = "
+	);
+	_OutputStream.writeInteger(javacoreData->startupPagesTouchedReadAhead, "%zu");
+
+	if (0 != (javacoreData->timestampChecksCached + javacoreData->timestampChecksPerformed)) {
+		_OutputStream.writeCharacters(
+				"\n2SCLTEXTTSC            Timestamp checks from cache               = "
+		);
+		_OutputStream.writeInteger(javacoreData->timestampChecksCached, "%zu");
+
+		_OutputStream.writeCharacters(
+				"\n2SCLTEXTTSF            Timestamp checks from file system         = "
+		);
+		_OutputStream.writeInteger(javacoreData->timestampChecksPerformed, "%zu");
+
+		_OutputStream.writeCharacters(
+				"\n2SCLTEXTTSE            Timestamp file change events              = "
+		);
+		_OutputStream.writeInteger(javacoreData->timestampChangeEvents, "%zu");
+	}
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTNVR            Number Verification Records               = "
+	);
+	_OutputStream.writeInteger(javacoreData->numVerificationData, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTVRB            Verification Record bytes                 = "
+	);
+	_OutputStream.writeInteger(javacoreData->verificationDataBytes, "%zu");
+
+	if (0 != javacoreData->cachePageSize) {
+		_OutputStream.writeCharacters(
+				"\n2SCLTEXTCPS            Cache page size                           = "
+		);
+		_OutputStream.writeInteger(javacoreData->cachePageSize, "%zu");
+
+		_OutputStream.writeCharacters(
+				"\n2SCLTEXTCHP            Cache bytes mapped with huge pages        = "
+		);
+		_OutputStream.writeInteger(javacoreData->cacheHugePageBytes, "%zu");
+	}
+
 	_OutputStream.writeCharacters(
 			"\n2SCLTEXTNJC            Number JCL Entries                        = "
 	);
@@ -3217,6 +3272,83 @@ JavaCoreDumpWriter::writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJav
 	_OutputStream.writeCharacters("\n");
 }
 
+void
+JavaCoreDumpWriter::writeSharedClassSectionLookupStatsHelper(void)
+{
+	static const char* const operationNames[J9SHR_LOOKUP_OPERATIONS] = {
+			"Find ROMClass            ",
+			"Find AOT method          ",
+			"Store AOT method         ",
+			"Find attached data       "
+	};
+	static const char* const loaderNames[J9SHR_LOOKUP_LOADERS] = {
+			"Bootstrap loader         ",
+			"Classpath loader         ",
+			"URL loader               ",
+			"Token loader             "
+	};
+	J9SharedCacheLookupStats stats;
+
+	memset(&stats, 0, sizeof(J9SharedCacheLookupStats));
+	_VirtualMachine->sharedClassConfig->getLookupStats(_Context->javaVM, &stats);
+
+	_OutputStream.writeCharacters(
+			"NULL\n"
+			"1SCLTEXTLKS       Cache Lookups by this JVM\n"
+			"NULL               ------------------\n"
+			"1SCLTEXTLKH           Operation                Hit        Not found  Stale      Invalid    Exists     Full       Error      Total usec\n"
+			"NULL\n"
+	);
+	for (UDATA op = 0; op < J9SHR_LOOKUP_OPERATIONS; op++) {
+		_OutputStream.writeCharacters("2SCLTEXTLKO           ");
+		_OutputStream.writeCharacters(operationNames[op]);
+		for (UDATA result = 0; result < J9SHR_LOOKUP_RESULTS; result++) {
+			_OutputStream.writeInteger(stats.results[op][result], "%-10zu ");
+		}
+		_OutputStream.writeInteger(stats.totalMicros[op], "%zu");
+		_OutputStream.writeCharacters("\n");
+	}
+
+	/* Bucket i counts the lookups which took less than 4^i microseconds */
+	_OutputStream.writeCharacters(
+			"NULL\n"
+			"1SCLTEXTLKH           Latency                  <1us       <4us       <16us      <64us      <256us     <1ms       <4ms       >=4ms\n"
+			"NULL\n"
+	);
+	for (UDATA op = 0; op < J9SHR_LOOKUP_OPERATIONS; op++) {
+		_OutputStream.writeCharacters("2SCLTEXTLKL           ");
+		_OutputStream.writeCharacters(operationNames[op]);
+		for (UDATA bucket = 0; bucket < J9SHR_LOOKUP_LATENCY_BUCKETS; bucket++) {
+			_OutputStream.writeInteger(stats.latencyHistogram[op][bucket], "%-10zu ");
+		}
+		_OutputStream.writeCharacters("\n");
+	}
+
+	_OutputStream.writeCharacters(
+			"NULL\n"
+			"1SCLTEXTLKH           ROMClass lookups by      Hit        Not found  Stale      Invalid    Exists     Full       Error\n"
+			"NULL\n"
+	);
+	for (UDATA loader = 0; loader < J9SHR_LOOKUP_LOADERS; loader++) {
+		_OutputStream.writeCharacters("2SCLTEXTLKC           ");
+		_OutputStream.writeCharacters(loaderNames[loader]);
+		for (UDATA result = 0; result < J9SHR_LOOKUP_RESULTS; result++) {
+			_OutputStream.writeInteger(stats.romClassResultsByLoader[loader][result], "%-10zu ");
+		}
+		_OutputStream.writeCharacters("\n");
+	}
+
+	/* The last index also counts the hits at any later classpath entry */
+	_OutputStream.writeCharacters(
+			"NULL\n"
+			"2SCLTEXTLKI           ROMClass hits by classpath index   = "
+	);
+	for (UDATA index = 0; index < J9SHR_LOOKUP_CLASSPATH_INDICES; index++) {
+		_OutputStream.writeInteger(stats.romClassHitsByClasspathIndex[index], "%zu ");
+	}
+	_OutputStream.writeCharacters("\n");
+}
+
 void
 JavaCoreDumpWriter::writeSharedClassSection(void)
 {
@@ -3259,6 +3391,10 @@ JavaCoreDumpWriter::writeSharedClassSection(void)
 			writeSharedClassSectionTopLayerStatsSummaryHelper(&javacoreData);
 		}
 
+		if (NULL != _VirtualMachine->sharedClassConfig->getLookupStats) {
+			writeSharedClassSectionLookupStatsHelper();
+		}
+
 		/* Write the section trailer */
 		_OutputStream.writeCharacters(
 			"NULL\n"
@@ -75,6 +75,7 @@ IDATA J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				char* ctrlDirName = NULL;
 				char* cacheDirPermStr = NULL;
 				char* methodSpecs = NULL;
+				char* snapshotFile = NULL;
 #if !defined(WIN32) && !defined(WIN64)
 				char defaultCacheDir[J9SH_MAXPATH];
 				IDATA ret = 0;
@@ -156,7 +157,7 @@ IDATA J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				}
 								
 				vm->sharedCacheAPI->parseResult = parseArgs(vm, optionsBufferPtr, &runtimeFlags, &verboseFlags, &cacheName, &modContext,
-								&expireTime, &ctrlDirName, &cacheDirPermStr, &methodSpecs, &printStatsOptions, &storageKeyTesting);
+								&expireTime, &ctrlDirName, &cacheDirPermStr, &methodSpecs, &snapshotFile, &printStatsOptions, &storageKeyTesting);
 				if ((RESULT_PARSE_FAILED == vm->sharedCacheAPI->parseResult)
 				){
 					return J9VMDLLMAIN_FAILED;
@@ -197,6 +198,13 @@ IDATA J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 					}
 					memcpy(vm->sharedCacheAPI->methodSpecs, methodSpecs, strlen(methodSpecs) + 1);
 				}
+				if (NULL != snapshotFile) {
+					vm->sharedCacheAPI->snapshotFile = (char *) j9mem_allocate_memory(strlen(snapshotFile) + 1, J9MEM_CATEGORY_CLASSES);
+					if (NULL == vm->sharedCacheAPI->snapshotFile) {
+						return J9VMDLLMAIN_FAILED;
+					}
+					memcpy(vm->sharedCacheAPI->snapshotFile, snapshotFile, strlen(snapshotFile) + 1);
+				}
 
 				if (runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_PERSISTENT_CACHE) {
 					vm->sharedCacheAPI->cacheType = J9PORT_SHR_CACHE_TYPE_PERSISTENT;
@@ -63,6 +63,7 @@ extern "C" {
 
 static char* formatAttachedDataString(J9VMThread* currentThread, U_8 *attachedData, UDATA attachedDataLength, char *attachedDataStringBuffer, UDATA bufferLength);
 static void checkROMClassUTF8SRPs(J9ROMClass *romClass);
+static UDATA attachedDataLookupResult(const U_8* result, IDATA corruptOffset);
 /* If you make this sleep a lot longer, it almost eliminates store contention
  * because the VMs get out of step with each other, but you delay excessively */
 #define WRITE_HASH_WAIT_MAX_MICROS 80000
@@ -243,6 +244,27 @@ SH_CacheMap::dontNeedMetadata(J9VMThread* currentThread)
 
 }
 
+/**
+ * Store the pages of each cache layer accessed during startup, so that
+ * they are read ahead when the next JVM attaches to the cache.
+ */
+void
+SH_CacheMap::storeStartupPages(J9VMThread* currentThread)
+{
+	SH_CompositeCacheImpl* ccToUse = _ccHead;
+
+	if (_startupPagesStored) {
+		return;
+	}
+	_startupPagesStored = true;
+	while (NULL != ccToUse) {
+		if (ccToUse->isStarted()) {
+			ccToUse->storeStartupPages(currentThread);
+		}
+		ccToUse = ccToUse->getNext();
+	}
+}
+
 /**
  * Builds a new SH_CacheMap for retrieving cache statistics
  *
@@ -293,6 +315,8 @@ SH_CacheMap::initialize(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, Bl
 	_isSerialized = false;
 	_isAssertEnabled = true;
 	_metadataReleased = false;
+	_startupPagesStored = false;
+	memset(&_lookupStats, 0, sizeof(_lookupStats));
 	
 	/* TODO: Need this function to be able to return pass/fail */
 #if defined(J9SHR_CACHELET_SUPPORT)
@@ -368,6 +392,7 @@ SH_CacheMap::cleanup(J9VMThread* currentThread)
 	
 	Trc_SHR_CM_cleanup_Entry(currentThread);
 
+	_tsm->cleanup(currentThread);
 	walkManager = managers()->startDo(currentThread, 0, &state);
 	while (walkManager) {
 		walkManager->cleanup(currentThread);
@@ -679,6 +704,10 @@ error:
 		/* THREADING: We want the cache mutex here as we are reading all available data. Don't want updates happening as we read. */
 
 		if (ccToUse->enterWriteMutex(currentThread, false, fnName) == 0) {
+			if ((ccToUse == _ccHead) && (!isReadOnly)) {
+				/* Index anything stored by JVMs which did not update the class index, so it is deferred by readCache() */
+				updateClassIndex(currentThread, ccToUse);
+			}
 			/* populate the hashtables */
 			itemsRead = readCache(currentThread, ccToUse, -1, false);
 			ccToUse->protectPartiallyFilledPages(currentThread);
@@ -805,6 +834,8 @@ error:
 	}
 #endif
 
+	_tsm->startup(currentThread);
+
 	Trc_SHR_CM_startup_ExitOK(currentThread);
 	return 0;
 }
@@ -1024,6 +1055,23 @@ SH_CacheMap::updateROMSegmentListForCache(J9VMThread* currentThread, SH_Composit
 	Trc_SHR_CM_updateROMSegmentList_Exit(currentThread, currentSegment);
 }
 
+/**
+ * Add the ROMClasses committed to a cache layer since the last call to its class index,
+ * so that later JVMs can find them without reading them into the ROMClass manager at startup.
+ *
+ * THREADING: Must hold the cache write mutex
+ * @param[in] cache The cache layer
+ */
+void
+SH_CacheMap::updateClassIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache)
+{
+	SH_Manager* manager = NULL;
+
+	if (getAndStartManagerForType(currentThread, TYPE_ROMCLASS, &manager) == TYPE_ROMCLASS) {
+		_rcm->updateClassIndex(currentThread, cache);
+	}
+}
+
 /** 
  * Assume cc is initialized OK
  * @retval 1 success
@@ -2291,6 +2339,7 @@ SH_CacheMap::commitROMClass(J9VMThread* currentThread, ShcItem* itemInCache, SH_
 	}
 	/*If storeNew() fails, we still need to update the segment list, and commit the update.*/
 	cacheAreaForAllocate->commitUpdate(currentThread, false);
+	updateClassIndex(currentThread, cacheAreaForAllocate);
 	updateROMSegmentList(currentThread, true);
 
 	/* Try to reset the writeHash field in the cache. We have loaded a class from disk have now stored it.
@@ -2377,6 +2426,7 @@ SH_CacheMap::commitOrphanROMClass(J9VMThread* currentThread, ShcItem* itemInCach
 	}
 	/*If storeNew() fails, we still need to update the segment list, and commit the update.*/
 	cacheAreaForAllocate->commitUpdate(currentThread, false);
+	updateClassIndex(currentThread, cacheAreaForAllocate);
 	updateROMSegmentList(currentThread, true);
 
 	/* Try to reset the writeHash field in the cache. We have loaded a class from disk have now stored it.
@@ -2691,6 +2741,8 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 	SH_ROMClassManager* localRCM;
 	UDATA hash = 0;
 	bool useWriteHash = _ccHead->isUsingWriteHash();
+	PORT_ACCESS_FROM_PORT(_portlib);
+	U_64 lookupStartTime = j9time_hires_clock();
 
 	Trc_SHR_Assert_ShouldHaveLocalMutex(currentThread->javaVM->classMemorySegments->segmentMutex);
 
@@ -2700,6 +2752,7 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 		/* trace exception is at level 1 and trace exit message is at level 2 as per CMVC 155318/157683 */
 		Trc_SHR_CM_findROMClass_NoROMClassManager_Exception(currentThread, path, cp->getHelperID());
 		Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
+		recordROMClassLookup(currentThread, cp, J9SHR_LOOKUP_RESULT_ERROR, -1, lookupStartTime);
 		return NULL;
 	}
 
@@ -2708,6 +2761,7 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 		if (cp->flags & MARKED_STALE_FLAG) {
 			 /* no level 1 trace event here since this could cause performance problem stated in CMVC 155318/157683 */
 			Trc_SHR_CM_findROMClass_ExitStaleClasspath(currentThread, path);
+			recordROMClassLookup(currentThread, cp, J9SHR_LOOKUP_RESULT_STALE, -1, lookupStartTime);
 			return NULL;
 		}
 	}
@@ -2719,6 +2773,7 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 	if (_ccHead->enterReadMutex(currentThread, fnName) != 0) {
 		Trc_SHR_CM_findROMClass_FailedMutex(currentThread, path, cp->getHelperID());
 		Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
+		recordROMClassLookup(currentThread, cp, J9SHR_LOOKUP_RESULT_ERROR, -1, lookupStartTime);
 		return NULL;
 	}
 
@@ -2727,6 +2782,7 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 		/* trace event is at level 1 and trace exit message is at level 2 as per CMVC 155318/157683 */
 		Trc_SHR_CM_findROMClass_Exit_Null_Event(currentThread, path, cp->getHelperID());
 		Trc_SHR_CM_findROMClass_Exit_Null(currentThread);
+		recordROMClassLookup(currentThread, cp, J9SHR_LOOKUP_RESULT_ERROR, -1, lookupStartTime);
 		return NULL;
 	}
 	
@@ -2748,7 +2804,6 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 	*/
 	if ((*_runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_REDUCE_STORE_CONTENTION) && (rc & LOCATE_ROMCLASS_RETURN_DO_TRY_WAIT)) {
 		if (true == useWriteHash) {
-			PORT_ACCESS_FROM_VMC(currentThread);
 			hash = currentThread->javaVM->internalVMFunctions->computeHashForUTF8((U_8*)path, (U_16)pathLen);
 			UDATA result = _ccHead->testAndSetWriteHash(currentThread, hash);
 			if (result==1) {			/* Another JVM in the middle of loading class with same hash - wait for update */
@@ -2890,6 +2945,9 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 			*foundAtIndex = locateResult.foundAtIndex;
 		}
 		returnVal = (J9ROMClass*)getAddressFromJ9ShrOffset(&((locateResult.known)->romClassOffset));
+		if (!_startupPagesStored) {
+			recordStartupAccess(currentThread, returnVal, returnVal->romSize);
+		}
 #if !defined(J9ZOS390) && !defined(AIXPPC)
 		if (_metadataReleased
 #if defined(LINUX)
@@ -2918,9 +2976,11 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 		/* trace event is at level 1 and trace exit message is at level 2 as per CMVC 155318/157683 */
 		Trc_SHR_CM_findROMClass_Exit_Found_Event(currentThread, path, returnVal, locateResult.foundAtIndex, cp->getHelperID());
 		Trc_SHR_CM_findROMClass_Exit_Found(currentThread, path, returnVal, locateResult.foundAtIndex);
+		recordROMClassLookup(currentThread, cp, J9SHR_LOOKUP_RESULT_HIT, locateResult.foundAtIndex, lookupStartTime);
 	} else {
 		/* no level 1 trace event here due to performance problem stated in CMVC 155318/157683 */
 		Trc_SHR_CM_findROMClass_Exit_NotFound(currentThread, path);
+		recordROMClassLookup(currentThread, cp, J9_ARE_ANY_BITS_SET(rc, LOCATE_ROMCLASS_RETURN_DO_MARK_CPEI_STALE) ? J9SHR_LOOKUP_RESULT_STALE : J9SHR_LOOKUP_RESULT_NOT_FOUND, -1, lookupStartTime);
 	}
 	return returnVal;
 }
@@ -2952,7 +3012,12 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 		}
 		break;
 	case TYPE_ATTACHED_DATA:
-		if (0 != (*_runtimeFlags & RUNTIME_FLAGS_PREVENT_JIT_DATA_UPDATE)) {
+		if (J9SHR_ATTACHED_DATA_TYPE_VERIFICATION == resourceDescriptor->getResourceDataSubType()) {
+			if (0 != (*_runtimeFlags & RUNTIME_FLAGS_PREVENT_BLOCK_DATA_UPDATE)) {
+				increaseUnstoredBytes(totalLength);
+				return NULL;
+			}
+		} else if (0 != (*_runtimeFlags & RUNTIME_FLAGS_PREVENT_JIT_DATA_UPDATE)) {
 			return NULL;
 		}
 		break;
@@ -2996,6 +3061,8 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 			(J9SHR_ATTACHED_DATA_TYPE_JITHINT == resourceSubType)
 		){
 			itemInCache = (ShcItem*)(cacheAreaForAllocate->allocateJIT(currentThread, itemPtr, dataLength));
+		} else if (J9SHR_ATTACHED_DATA_TYPE_VERIFICATION == resourceSubType) {
+			itemInCache = (ShcItem*)(cacheAreaForAllocate->allocateBlock(currentThread, itemPtr, align, wrapperLength));
 		}
 		break;
 	default :
@@ -3335,12 +3402,34 @@ SH_CacheMap::storeCompiledMethod(J9VMThread* currentThread, const J9ROMMethod* r
 	const U_8* result;
 	SH_CompiledMethodManager::SH_CompiledMethodResourceDescriptor descriptor(dataStart, (U_32)dataSize, codeStart, (U_32)codeSize);
 	SH_CompiledMethodManager* localCMM;
+	PORT_ACCESS_FROM_PORT(_portlib);
+	U_64 lookupStartTime = j9time_hires_clock();
+	UDATA lookupResult = J9SHR_LOOKUP_RESULT_ERROR;
 	
 	if (!(localCMM = getCompiledMethodManager(currentThread))) { 
+		recordLookup(currentThread, J9SHR_LOOKUP_STORE_COMPILED_METHOD, J9SHR_LOOKUP_RESULT_ERROR, lookupStartTime);
 		return NULL;
 	}
 
 	result = (const U_8*)storeROMClassResource(currentThread, romMethod, localCMM, &descriptor, forceReplace, NULL);
+
+	switch ((UDATA)result) {
+	case J9SHR_RESOURCE_STORE_EXISTS:
+		lookupResult = J9SHR_LOOKUP_RESULT_EXISTS;
+		break;
+	case J9SHR_RESOURCE_STORE_INVALIDATED:
+		lookupResult = J9SHR_LOOKUP_RESULT_INVALIDATED;
+		break;
+	case J9SHR_RESOURCE_STORE_FULL:
+		lookupResult = J9SHR_LOOKUP_RESULT_FULL;
+		break;
+	default:
+		if (J9SHR_RESOURCE_MAX_ERROR_VALUE < (UDATA)result) {
+			lookupResult = J9SHR_LOOKUP_RESULT_HIT;
+		}
+		break;
+	}
+	recordLookup(currentThread, J9SHR_LOOKUP_STORE_COMPILED_METHOD, lookupResult, lookupStartTime);
 	
 	return result;
 }
@@ -3364,13 +3453,32 @@ SH_CacheMap::findCompiledMethod(J9VMThread* currentThread, const J9ROMMethod* ro
 	const U_8* result;
 	SH_CompiledMethodManager::SH_CompiledMethodResourceDescriptor descriptor;
 	SH_CompiledMethodManager* localCMM;
+	UDATA localFlags = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+	U_64 lookupStartTime = j9time_hires_clock();
 
 	if (!(localCMM = getCompiledMethodManager(currentThread))) { 
+		recordLookup(currentThread, J9SHR_LOOKUP_FIND_COMPILED_METHOD, J9SHR_LOOKUP_RESULT_ERROR, lookupStartTime);
 		return NULL;
 	}
 
-	result = (const U_8*)findROMClassResource(currentThread, romMethod, localCMM, &descriptor, true, NULL, flags);
+	result = (const U_8*)findROMClassResource(currentThread, romMethod, localCMM, &descriptor, true, NULL, &localFlags);
+	if (NULL != flags) {
+		*flags |= localFlags;
+	}
 	if (NULL != result) {
+		recordLookup(currentThread, J9SHR_LOOKUP_FIND_COMPILED_METHOD, J9SHR_LOOKUP_RESULT_HIT, lookupStartTime);
+	} else if (J9_ARE_ANY_BITS_SET(localFlags, J9SHR_AOT_METHOD_FLAG_INVALIDATED)) {
+		recordLookup(currentThread, J9SHR_LOOKUP_FIND_COMPILED_METHOD, J9SHR_LOOKUP_RESULT_INVALIDATED, lookupStartTime);
+	} else {
+		recordLookup(currentThread, J9SHR_LOOKUP_FIND_COMPILED_METHOD, J9SHR_LOOKUP_RESULT_NOT_FOUND, lookupStartTime);
+	}
+	if (NULL != result) {
+		if (!_startupPagesStored) {
+			const CompiledMethodWrapper* cmw = (const CompiledMethodWrapper*)(result - sizeof(CompiledMethodWrapper));
+
+			recordStartupAccess(currentThread, cmw, sizeof(CompiledMethodWrapper) + cmw->dataLength + cmw->codeLength);
+		}
 #if !defined(J9ZOS390) && !defined(AIXPPC)
 		if (_metadataReleased
 #if defined(LINUX)
@@ -3412,6 +3520,122 @@ SH_CacheMap::findCompiledMethod(J9VMThread* currentThread, const J9ROMMethod* ro
 	return result;
 }
 
+/**
+ * Record the cache pages accessed by a ROMClass or AOT method found during startup.
+ * @param [in] address start of the data found
+ * @param [in] length length of the data found
+ */
+void
+SH_CacheMap::recordStartupAccess(J9VMThread* currentThread, const void* address, UDATA length)
+{
+	SH_CompositeCacheImpl* ccToUse = _ccHead;
+
+	while ((NULL != ccToUse) && !ccToUse->recordStartupAccess(currentThread, address, length)) {
+		ccToUse = ccToUse->getNext();
+	}
+}
+
+/**
+ * Get the stripe of the lookup counters updated by a thread.
+ * Threads mostly update different stripes, so the atomic adds to the counters are rarely contended.
+ * @param [in] currentThread The current thread
+ * @return The counters to update
+ */
+J9SharedCacheLookupStats*
+SH_CacheMap::getLookupStatsStripe(J9VMThread* currentThread)
+{
+	/* J9VMThreads are allocated at least 256 bytes apart */
+	return &_lookupStats[(((UDATA)currentThread) >> 8) % CACHEMAP_LOOKUP_STATS_STRIPES];
+}
+
+/**
+ * Count a lookup made by this JVM and add its latency to the histogram of the operation.
+ * The counters are not protected by any mutex, so they are updated atomically.
+ * @param [in] currentThread The current thread
+ * @param [in] operation J9SHR_LOOKUP_FIND_ROMCLASS, J9SHR_LOOKUP_FIND_COMPILED_METHOD, ...
+ * @param [in] result J9SHR_LOOKUP_RESULT_HIT, J9SHR_LOOKUP_RESULT_NOT_FOUND, ...
+ * @param [in] startTime j9time_hires_clock() taken when the lookup started
+ */
+void
+SH_CacheMap::recordLookup(J9VMThread* currentThread, UDATA operation, UDATA result, U_64 startTime)
+{
+	J9SharedCacheLookupStats* stats = getLookupStatsStripe(currentThread);
+	PORT_ACCESS_FROM_PORT(_portlib);
+	UDATA micros = (UDATA)j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	UDATA bucket = 0;
+	UDATA bucketLimit = 1;
+
+	/* bucket i holds the lookups that took less than 4^i microseconds, the last bucket holds the rest */
+	while ((bucket < (J9SHR_LOOKUP_LATENCY_BUCKETS - 1)) && (micros >= bucketLimit)) {
+		bucket += 1;
+		bucketLimit <<= 2;
+	}
+
+	VM_AtomicSupport::add(&stats->results[operation][result], 1);
+	VM_AtomicSupport::add(&stats->latencyHistogram[operation][bucket], 1);
+	VM_AtomicSupport::add(&stats->totalMicros[operation], micros);
+}
+
+/**
+ * Count a ROMClass lookup by the kind of class loader that made it and, for hits,
+ * by the index of the classpath entry the class was found at.
+ * @param [in] currentThread The current thread
+ * @param [in] cp The classpath of the caller, or NULL
+ * @param [in] result J9SHR_LOOKUP_RESULT_HIT, J9SHR_LOOKUP_RESULT_NOT_FOUND, ...
+ * @param [in] foundAtIndex The index the class was found at, or -1
+ * @param [in] startTime j9time_hires_clock() taken when the lookup started
+ */
+void
+SH_CacheMap::recordROMClassLookup(J9VMThread* currentThread, ClasspathItem* cp, UDATA result, IDATA foundAtIndex, U_64 startTime)
+{
+	J9SharedCacheLookupStats* stats = getLookupStatsStripe(currentThread);
+	UDATA loader = J9SHR_LOOKUP_LOADER_CLASSPATH;
+
+	if ((NULL != cp) && ((void*)cp == _sharedClassConfig->bootstrapCPI)) {
+		loader = J9SHR_LOOKUP_LOADER_BOOTSTRAP;
+	} else if (NULL != cp) {
+		switch (cp->getType()) {
+		case CP_TYPE_TOKEN:
+			loader = J9SHR_LOOKUP_LOADER_TOKEN;
+			break;
+		case CP_TYPE_URL:
+			loader = J9SHR_LOOKUP_LOADER_URL;
+			break;
+		default:
+			break;
+		}
+	}
+	VM_AtomicSupport::add(&stats->romClassResultsByLoader[loader][result], 1);
+
+	if ((J9SHR_LOOKUP_RESULT_HIT == result) && (0 <= foundAtIndex)) {
+		UDATA index = OMR_MIN((UDATA)foundAtIndex, J9SHR_LOOKUP_CLASSPATH_INDICES - 1);
+		VM_AtomicSupport::add(&stats->romClassHitsByClasspathIndex[index], 1);
+	}
+
+	recordLookup(currentThread, J9SHR_LOOKUP_FIND_ROMCLASS, result, startTime);
+}
+
+/**
+ * Sum the lookup counters of this JVM over all stripes.
+ * The counters can be updated while they are summed, so the snapshot is not exact.
+ * @param [out] stats Filled with the counters
+ */
+void
+SH_CacheMap::getLookupStats(J9SharedCacheLookupStats* stats)
+{
+	/* Every field of J9SharedCacheLookupStats is a UDATA counter */
+	UDATA* total = (UDATA*)stats;
+
+	memset(stats, 0, sizeof(J9SharedCacheLookupStats));
+	for (UDATA stripe = 0; stripe < CACHEMAP_LOOKUP_STATS_STRIPES; stripe++) {
+		UDATA* counters = (UDATA*)&_lookupStats[stripe];
+
+		for (UDATA i = 0; i < (sizeof(J9SharedCacheLookupStats) / sizeof(UDATA)); i++) {
+			total[i] += counters[i];
+		}
+	}
+}
+
 /**
  * Record the minimum and maximum addresses accessed in the shared classes cache.
  * @param [in] metadataAddress address accessed in metadata
@@ -3463,7 +3687,8 @@ SH_CacheMap::storeAttachedData(J9VMThread* currentThread, const void* addressInC
 		return J9SHR_RESOURCE_STORE_ERROR;
 	}
 
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	/* Verification data is keyed by a ROMClass rather than a ROMMethod, and is not JIT data */
+	if ((localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) && (J9SHR_ATTACHED_DATA_TYPE_VERIFICATION != data->type)) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char *pSubcstr = subcstr;
 		const char *pType = attachedTypeString(data->type);
@@ -3685,13 +3910,16 @@ SH_CacheMap::findAttachedDataAPI(J9VMThread* currentThread, const void* addressI
 
 	Trc_SHR_CM_findAttachedDataAPI_Entry(currentThread, addressInCache, addressInCache);
 
-	if (localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
+	if ((localVerboseFlags  & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) && (J9SHR_ATTACHED_DATA_TYPE_VERIFICATION != data->type)) {
 		char subcstr[VERBOSE_BUFFER_SIZE];
 		const char* pSubcstr = subcstr;
 		subcstr[0] = 0;
 		const char *pType = attachedTypeString(data->type);
 
+		U_64 lookupStartTime = j9time_hires_clock();
+
 		result = findAttachedData(currentThread, addressInCache, data, corruptOffset, &pSubcstr);
+		recordLookup(currentThread, J9SHR_LOOKUP_FIND_ATTACHED_DATA, attachedDataLookupResult(result, *corruptOffset), lookupStartTime);
 
 		if(addressInCache && isAddressInCache(addressInCache, 0, false, false)) {
 			J9ClassLoader* loader;
@@ -3719,7 +3947,10 @@ SH_CacheMap::findAttachedDataAPI(J9VMThread* currentThread, const void* addressI
 			CACHEMAP_PRINT3(localVerboseFlags, J9NLS_SHRC_CM_FIND_FAILED_VERBOSE_ATTACHED_NOCLASSINFO_MSG, pType, addressInCache, pSubcstr);
 		}
 	} else {
+		U_64 lookupStartTime = j9time_hires_clock();
+
 		result = findAttachedData(currentThread, addressInCache, data, corruptOffset, NULL);
+		recordLookup(currentThread, J9SHR_LOOKUP_FIND_ATTACHED_DATA, attachedDataLookupResult(result, *corruptOffset), lookupStartTime);
 	}
 
 	Trc_SHR_CM_findAttachedDataAPI_Exit(currentThread, result);
@@ -4406,14 +4637,28 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 			}
 			descriptor->aotBytes += walk->getAOTBytes();
 			descriptor->romClassBytes += ((UDATA)(walk->getSegmentAllocPtr()) - (UDATA)(walk->getBaseAddress()));
+			UDATA pagesReadAhead = 0;
+			UDATA pagesTouched = 0;
+			UDATA pagesTouchedReadAhead = 0;
+
+			walk->getStartupPageStats(&pagesReadAhead, &pagesTouched, &pagesTouchedReadAhead);
+			descriptor->startupPagesReadAhead += pagesReadAhead;
+			descriptor->startupPagesTouched += pagesTouched;
+			descriptor->startupPagesTouchedReadAhead += pagesTouchedReadAhead;
 		}
 		walk = walk->getPrevious();
 	}
+	_tsm->getTimestampCheckStats(&descriptor->timestampChecksCached, &descriptor->timestampChecksPerformed, &descriptor->timestampChangeEvents);
 	
 	descriptor->runtimeFlags = *_runtimeFlags;
 	descriptor->cacheName = _cacheName;
 	descriptor->feature = getJVMFeature(vm);
 
+	descriptor->objectBytes = 0;
+	descriptor->numObjects = 0;
+	descriptor->verificationDataBytes = 0;
+	descriptor->numVerificationData = 0;
+
 	if (_bdm && (_bdm->getState() == MANAGER_STATE_STARTED)) {
 		UDATA type;
 		
@@ -4450,6 +4695,10 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 				descriptor->numStartupHints = _bdm->getNumOfType(type);
 				descriptor->startupHintBytes = _bdm->getDataBytesForType(type);
 				break;
+			case J9SHR_DATA_TYPE_HEAPARCHIVE:
+				descriptor->objectBytes = _bdm->getDataBytesForType(type);
+				descriptor->numObjects = _bdm->getNumOfType(type);
+				break;
 			default:
 				descriptor->indexedDataBytes += _bdm->getDataBytesForType(type);
 			}
@@ -4474,9 +4723,6 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 		descriptor->numStartupHints = 0;
 	}
 
-	descriptor->objectBytes = 0;
-	descriptor->numObjects = 0;
-	
 	if (_adm && (MANAGER_STATE_STARTED == _adm->getState())) {
 		UDATA type;
 		for (type = 0; type <= J9SHR_ATTACHED_DATA_TYPE_MAX; type++) {
@@ -4491,6 +4737,10 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 				descriptor->jitHintDataBytes += _adm->getDataBytesForType(type);
 				descriptor->numJitHints += _adm->getNumOfType(type);
 				break;
+			case J9SHR_ATTACHED_DATA_TYPE_VERIFICATION:
+				descriptor->verificationDataBytes = _adm->getDataBytesForType(type);
+				descriptor->numVerificationData = _adm->getNumOfType(type);
+				break;
 			default:
 				Trc_SHR_CM_getJavacoreData_InvalidAttachedDataType(type);
 				Trc_SHR_Assert_ShouldNeverHappen();
@@ -4513,6 +4763,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 					descriptor->aotDataBytes -
 					descriptor->aotClassChainDataBytes -
 					descriptor->aotThunkDataBytes -
+					descriptor->verificationDataBytes -
 					descriptor->indexedDataBytes -
 					descriptor->objectBytes -
 					descriptor->debugAreaSize;
@@ -4522,7 +4773,14 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 	}
 	
 	if (_rcm && (_rcm->getState() == MANAGER_STATE_STARTED)) {
+		UDATA deferredNonStale = 0;
+		UDATA deferredStale = 0;
+
 		_rcm->getNumItems(NULL, &nonstale, &stale);
+		/* ROMClasses in the class index which have not been looked up yet are not in the hashtable */
+		_rcm->getNumDeferredItems(&deferredNonStale, &deferredStale);
+		nonstale += deferredNonStale;
+		stale += deferredStale;
 		descriptor->numStaleClasses = stale;
 		descriptor->numROMClasses = stale + nonstale;
 		if (descriptor->numROMClasses > 0) {
@@ -5252,6 +5510,26 @@ SH_CacheMap::printCacheStatsTopLayerStatsHelper(J9VMThread* currentThread, UDATA
 		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_DEBUGAREA_USED_BYTES, javacoreData->debugAreaLineNumberTableBytes + javacoreData->debugAreaLocalVariableTableBytes);
 	}
 	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_DEBUGAREA_USED, javacoreData->debugAreaUsed);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_WRITE_MUTEX_ACQUIRED, javacoreData->writeMutexAcquireCount);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_WRITE_MUTEX_CONTENDED, javacoreData->writeMutexContendedCount);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_WRITE_MUTEX_WAIT_MICROS, javacoreData->writeMutexWaitMicros);
+	if (0 != javacoreData->writeMutexContendedCount) {
+		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_WRITE_MUTEX_AVG_WAIT_MICROS, javacoreData->writeMutexContendedWaitMicros / javacoreData->writeMutexContendedCount);
+	}
+	if (0 != javacoreData->cachePageSize) {
+		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_CACHE_PAGE_SIZE, javacoreData->cachePageSize);
+		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_CACHE_HUGE_PAGE_BYTES, javacoreData->cacheHugePageBytes);
+	}
+	if (J9_ARE_ANY_BITS_SET(javacoreData->cacheMappingFlags, J9SHR_MAPPING_HUGE_PAGES_REQUESTED) && (0 == javacoreData->cacheHugePageBytes)) {
+		CACHEMAP_PRINT(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_HUGE_PAGES_FALLBACK);
+	}
+	if (J9_ARE_ANY_BITS_SET(javacoreData->cacheMappingFlags, J9SHR_MAPPING_NUMA_INTERLEAVE_REQUESTED)) {
+		if (J9_ARE_ANY_BITS_SET(javacoreData->cacheMappingFlags, J9SHR_MAPPING_NUMA_INTERLEAVED)) {
+			CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_NUMA_INTERLEAVE_NODES, javacoreData->cacheNumaNodes);
+		} else {
+			CACHEMAP_PRINT(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_NUMA_INTERLEAVE_FALLBACK);
+		}
+	}
 }
 /*
  * Helper funtion to print the statistics summary of the top layer cache.
@@ -6936,6 +7214,24 @@ SH_CacheMap::isAddressInROMClassSegment(const void* address) {
 	return _cc->isAddressInROMClassSegment(address);
 }
 
+/**
+ * Get the offset of a ROMClass in the shared cache
+ *
+ * @param [in] romClass The ROMClass
+ * @param [out] offset The offset of romClass in the cache
+ *
+ * @return true if romClass is in the cache, false otherwise
+ */
+bool
+SH_CacheMap::getROMClassOffset(const J9ROMClass* romClass, J9ShrOffset* offset)
+{
+	if (!isAddressInCache(romClass, romClass->romSize, false, false)) {
+		return false;
+	}
+	getJ9ShrOffsetFromAddress(romClass, offset);
+	return true;
+}
+
 
 /**
  *	Set the string table initialized state
@@ -7302,6 +7598,8 @@ SH_CacheMap::attachedTypeString(UDATA type)
 		return "JITPROFILE";
 	case J9SHR_ATTACHED_DATA_TYPE_JITHINT:
 		return "JITHINT";
+	case J9SHR_ATTACHED_DATA_TYPE_VERIFICATION:
+		return "VERIFICATION";
 	default:
 		Trc_SHR_CM_attachedTypeString_Error(type);
 		Trc_SHR_Assert_ShouldNeverHappen();
@@ -7315,6 +7613,24 @@ SH_CacheMap::isCacheCorruptReported(void)
 	return _cacheCorruptReported;
 }
 
+/**
+ * Classify the result of findAttachedData() for the lookup counters.
+ * @param [in] result The value returned by findAttachedData()
+ * @param [in] corruptOffset The corruptOffset set by findAttachedData()
+ * @return A J9SHR_LOOKUP_RESULT_* value
+ */
+static UDATA
+attachedDataLookupResult(const U_8* result, IDATA corruptOffset)
+{
+	if (NULL == result) {
+		/* corrupt data is counted as invalidated, it has to be updated before it can be used */
+		return (-1 == corruptOffset) ? J9SHR_LOOKUP_RESULT_NOT_FOUND : J9SHR_LOOKUP_RESULT_INVALIDATED;
+	} else if (J9SHR_RESOURCE_MAX_ERROR_VALUE >= (UDATA)result) {
+		return J9SHR_LOOKUP_RESULT_ERROR;
+	}
+	return J9SHR_LOOKUP_RESULT_HIT;
+}
+
 /**
  * Print a series of bytes as hexadecimal characters into a buffer.
  * The data are truncated silently if the buffer is too small.
@@ -40,6 +40,8 @@
 #define CM_CACHE_STORE_PREREQ_ID_FAILED -3
 
 #define J9SHR_UNIQUE_CACHE_ID_BUFSIZE  (J9SH_MAXPATH + 35)
+/* Number of copies of the lookup counters, which threads update depending on their J9VMThread address */
+#define CACHEMAP_LOOKUP_STATS_STRIPES 8
 
 typedef struct MethodSpecTable {
 	char* className;
@@ -127,6 +129,8 @@ public:
 
 	void dontNeedMetadata(J9VMThread* currentThread);
 
+	void storeStartupPages(J9VMThread* currentThread);
+
 	/**
 	 * This function is extremely hot.
 	 * Peeks to see whether compiled code exists for a given ROMMethod in the CompiledMethodManager hashtable
@@ -155,6 +159,8 @@ public:
 	/* @see SharedCache.hpp */
 	virtual UDATA getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor* descriptor);
 
+	void getLookupStats(J9SharedCacheLookupStats* stats);
+
 	/* @see SharedCache.hpp */
 	virtual IDATA markStale(J9VMThread* currentThread, ClasspathEntryItem* cpei, bool hasWriteMutex);
 
@@ -242,6 +248,8 @@ public:
 
 	bool isAddressInROMClassSegment(const void* address);
 
+	bool getROMClassOffset(const J9ROMClass* romClass, J9ShrOffset* offset);
+
 	void getRomClassAreaBounds(void ** romClassAreaStart, void ** romClassAreaEnd);
 
 	UDATA getReadWriteBytes(void);
@@ -325,6 +333,8 @@ private:
 	UDATA _cacheletCntr;
 	J9Pool* _ccPool;
 	bool _metadataReleased;
+	bool _startupPagesStored;
+	J9SharedCacheLookupStats _lookupStats[CACHEMAP_LOOKUP_STATS_STRIPES];	/* lookups made by this JVM, summed by getLookupStats() */
 	
 	/* True iff (*_runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_NESTED). Set in startup().
 	 * This flag is a misnomer. It indicates the cache is growable (chained), which also
@@ -385,6 +395,10 @@ private:
 
 	void updateROMSegmentListForCache(J9VMThread* currentThread, SH_CompositeCacheImpl* forCache);
 
+	void updateClassIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache);
+
+	void recordStartupAccess(J9VMThread* currentThread, const void* address, UDATA length);
+
 	const char* attachedTypeString(UDATA type);
 
 	UDATA initializeROMSegmentList(J9VMThread* currentThread);
@@ -416,6 +430,12 @@ private:
 	
 	bool isAddressInReleasedMetaDataBounds(J9VMThread* currentThread, UDATA address) const;
 
+	J9SharedCacheLookupStats* getLookupStatsStripe(J9VMThread* currentThread);
+
+	void recordLookup(J9VMThread* currentThread, UDATA operation, UDATA result, U_64 startTime);
+
+	void recordROMClassLookup(J9VMThread* currentThread, ClasspathItem* cp, UDATA result, IDATA foundAtIndex, U_64 startTime);
+
 	SH_CompositeCacheImpl* getCacheAreaForDataType(J9VMThread* currentThread, UDATA dataType, UDATA dataLength);
 
 	IDATA startManager(J9VMThread* currentThread, SH_Manager* manager);
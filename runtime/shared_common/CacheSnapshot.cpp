@@ -0,0 +1,658 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Shared_Common
+ */
+
+#include "j9.h"
+#include "j9port.h"
+#include "j9shrnls.h"
+#include "j2sever.h"
+#include "util_api.h"
+#include "ut_j9shr.h"
+#include "sharedconsts.h"
+#include "OSCache.hpp"
+#include "CacheMap.hpp"
+#include "CompositeCacheImpl.hpp"
+#include "CacheSnapshot.hpp"
+#include "zlib.h"
+#include <string.h>
+
+#define SNAPSHOT_BUFFER_SIZE (256 * 1024)
+/* The used part of a layer is the segment area, the metadata and the two ends of the class debug area */
+#define SNAPSHOT_MAX_REGIONS 3
+/* avail_in of a z_stream is a uInt, so regions are compressed in pieces of at most this size */
+#define SNAPSHOT_MAX_INPUT_CHUNK (1024 * 1024 * 1024)
+#define SNAPSHOT_TEMP_FILE_PREFIX "."
+#define SNAPSHOT_TEMP_FILE_SUFFIX ".import"
+
+#define SNAPSHOT_ERR_TRACE1(var1, p1) if (verboseFlags) j9nls_printf(PORTLIB, J9NLS_ERROR, var1, p1)
+#define SNAPSHOT_ERR_TRACE3(var1, p1, p2, p3) if (verboseFlags) j9nls_printf(PORTLIB, J9NLS_ERROR, var1, p1, p2, p3)
+
+typedef struct J9SharedCacheSnapshotStream {
+	J9PortLibrary* portLibrary;
+	IDATA fd;
+	z_stream zStream;
+	U_8* buffer;
+	bool streamEnd;
+} J9SharedCacheSnapshotStream;
+
+static void reportPortError(J9PortLibrary* portLibrary, UDATA verboseFlags);
+static bool writeSnapshotBytes(J9SharedCacheSnapshotStream* stream, const void* data, UDATA length, int flush);
+static bool exportLayer(J9SharedCacheSnapshotStream* stream, SH_CompositeCacheImpl* cc);
+static bool readSnapshotBytes(J9SharedCacheSnapshotStream* stream, void* data, UDATA length);
+static bool isSnapshotStreamComplete(J9SharedCacheSnapshotStream* stream);
+static void getLayerFileName(J9JavaVM* vm, const char* cacheDirName, const char* cacheName, I_8 layer, bool isTempFile, char* buffer);
+
+/**
+ * Print the error number and message of the last failed port library call
+ */
+static void
+reportPortError(J9PortLibrary* portLibrary, UDATA verboseFlags)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+	I_32 errorno = j9error_last_error_number();
+	const char* errormsg = j9error_last_error_message();
+
+	SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_PORT_ERROR_NUMBER, errorno);
+	Trc_SHR_Assert_True(errormsg != NULL);
+	SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_PORT_ERROR_MESSAGE, errormsg);
+}
+
+/**
+ * Compress data and write the compressed bytes to the snapshot file.
+ *
+ * @param [in] stream The snapshot being written
+ * @param [in] data The bytes to compress
+ * @param [in] length The number of bytes to compress, may be 0
+ * @param [in] flush Z_NO_FLUSH, or Z_FINISH to end the compressed stream
+ *
+ * @return true on success, false if compression failed or the file could not be written
+ */
+static bool
+writeSnapshotBytes(J9SharedCacheSnapshotStream* stream, const void* data, UDATA length, int flush)
+{
+	PORT_ACCESS_FROM_PORT(stream->portLibrary);
+	U_8* cursor = (U_8*)data;
+
+	do {
+		UDATA chunk = OMR_MIN(length, (UDATA)SNAPSHOT_MAX_INPUT_CHUNK);
+		int chunkFlush = (chunk == length) ? flush : Z_NO_FLUSH;
+
+		stream->zStream.next_in = (Bytef*)cursor;
+		stream->zStream.avail_in = (uInt)chunk;
+		do {
+			IDATA produced = 0;
+			int zrc = Z_OK;
+
+			stream->zStream.next_out = (Bytef*)stream->buffer;
+			stream->zStream.avail_out = SNAPSHOT_BUFFER_SIZE;
+			zrc = deflate(&stream->zStream, chunkFlush);
+			if (Z_STREAM_ERROR == zrc) {
+				Trc_SHR_SNAP_writeSnapshotBytes_deflateFailed(zrc);
+				return false;
+			}
+			produced = SNAPSHOT_BUFFER_SIZE - stream->zStream.avail_out;
+			if ((produced > 0) && (produced != j9file_write(stream->fd, stream->buffer, produced))) {
+				return false;
+			}
+		} while (0 == stream->zStream.avail_out);
+		cursor += chunk;
+		length -= chunk;
+	} while (length > 0);
+
+	return true;
+}
+
+/**
+ * Write the used regions of one layer of the cache to the snapshot.
+ * The segment area grows up from the cache header and the metadata grows down to the class debug area.
+ * Line number tables grow up from the start of the class debug area and local variable tables grow down from its end.
+ *
+ * @param [in] stream The snapshot being written
+ * @param [in] cc The layer to write
+ *
+ * @return true on success, false otherwise
+ */
+static bool
+exportLayer(J9SharedCacheSnapshotStream* stream, SH_CompositeCacheImpl* cc)
+{
+	U_8* osStart = (U_8*)cc->getOSCacheStart();
+	J9SharedCacheHeader* theca = cc->getCacheHeaderAddress();
+	U_8* cacheEnd = (U_8*)cc->getCacheEndAddress();
+	U_8* regionStart[SNAPSHOT_MAX_REGIONS];
+	U_8* regionEnd[SNAPSHOT_MAX_REGIONS];
+	J9SharedCacheSnapshotLayer layerRecord;
+	J9SharedCacheHeader headerCopy;
+	U_32 i = 0;
+
+	layerRecord.layer = cc->getLayer();
+	layerRecord.fileSize = cc->getTotalSize();
+	regionStart[0] = osStart;
+	regionEnd[0] = (U_8*)cc->getSegmentAllocPtr();
+	regionStart[1] = (U_8*)cc->getMetaAllocPtr();
+	if (0 == theca->debugRegionSize) {
+		regionEnd[1] = cacheEnd;
+		layerRecord.regionCount = 2;
+	} else {
+		regionEnd[1] = WSRP_GET(theca->lineNumberTableNextSRP, U_8*);
+		regionStart[2] = WSRP_GET(theca->localVariableTableNextSRP, U_8*);
+		regionEnd[2] = cacheEnd;
+		layerRecord.regionCount = 3;
+	}
+
+	for (i = 0; i < layerRecord.regionCount; i++) {
+		if ((regionStart[i] > regionEnd[i])
+			|| ((i > 0) && (regionEnd[i - 1] > regionStart[i]))
+			|| ((U_64)(regionEnd[i] - osStart) > layerRecord.fileSize)
+		) {
+			Trc_SHR_SNAP_exportLayer_badLayout(layerRecord.layer, regionEnd[0], regionStart[1], cacheEnd);
+			return false;
+		}
+	}
+	if (regionEnd[0] < ((U_8*)theca + sizeof(J9SharedCacheHeader))) {
+		Trc_SHR_SNAP_exportLayer_badLayout(layerRecord.layer, regionEnd[0], regionStart[1], cacheEnd);
+		return false;
+	}
+
+	if (!writeSnapshotBytes(stream, &layerRecord, sizeof(layerRecord), Z_NO_FLUSH)) {
+		return false;
+	}
+	for (i = 0; i < layerRecord.regionCount; i++) {
+		J9SharedCacheSnapshotRegion regionRecord;
+
+		regionRecord.offset = regionStart[i] - osStart;
+		regionRecord.length = regionEnd[i] - regionStart[i];
+		if (!writeSnapshotBytes(stream, &regionRecord, sizeof(regionRecord), Z_NO_FLUSH)) {
+			return false;
+		}
+		if (0 == i) {
+			U_8* afterHeader = (U_8*)theca + sizeof(J9SharedCacheHeader);
+
+			/* The imported cache is not attached to any JVM, so clear the counts in the copy of the cache header */
+			memcpy(&headerCopy, theca, sizeof(J9SharedCacheHeader));
+			headerCopy.vmCntr = 0;
+			headerCopy.readerCount = 0;
+			headerCopy.writerCount = 0;
+			if (!writeSnapshotBytes(stream, osStart, (U_8*)theca - osStart, Z_NO_FLUSH)
+				|| !writeSnapshotBytes(stream, &headerCopy, sizeof(J9SharedCacheHeader), Z_NO_FLUSH)
+				|| !writeSnapshotBytes(stream, afterHeader, regionEnd[0] - afterHeader, Z_NO_FLUSH)
+			) {
+				return false;
+			}
+		} else {
+			if (!writeSnapshotBytes(stream, regionStart[i], (UDATA)regionRecord.length, Z_NO_FLUSH)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Write a compressed snapshot of the used regions of every layer of the shared cache the JVM is attached to.
+ * The top layer is locked while it is written, the lower layers are only read.
+ *
+ * @param [in] vm The current J9JavaVM
+ * @param [in] cacheName The name of the cache
+ * @param [in] snapshotFileName The file to write
+ *
+ * @return 0 on success, -1 on failure
+ */
+IDATA
+j9shr_export_snapshot(J9JavaVM* vm, const char* cacheName, const char* snapshotFileName)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	IDATA rc = -1;
+	UDATA verboseFlags = vm->sharedCacheAPI->verboseFlags;
+	J9VMThread* currentThread = vm->internalVMFunctions->currentVMThread(vm);
+	SH_CacheMap* cm = (SH_CacheMap*)vm->sharedClassConfig->sharedClassCache;
+	SH_CompositeCacheImpl* topLayer = (SH_CompositeCacheImpl*)cm->getCompositeCacheAPI();
+	SH_CompositeCacheImpl* bottomLayer = NULL;
+	SH_CompositeCacheImpl* cc = NULL;
+	I_32 mode = (J9_ARE_ALL_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_GROUP_ACCESS)) ? J9SH_CACHE_FILE_MODE_USERDIR_WITH_GROUPACCESS : J9SH_CACHE_FILE_MODE_USERDIR_WITHOUT_GROUPACCESS;
+	J9SharedCacheSnapshotStream stream;
+	J9SharedCacheSnapshotHeader header;
+	bool deflateStarted = false;
+	IDATA lockRc1 = -1;
+	IDATA lockRc2 = -1;
+	UDATA ignore = 0;
+
+	Trc_SHR_SNAP_j9shr_export_snapshot_Entry(cacheName, snapshotFileName);
+
+	memset(&stream, 0, sizeof(stream));
+	memset(&header, 0, sizeof(header));
+	stream.portLibrary = PORTLIB;
+	stream.fd = j9file_open(snapshotFileName, EsOpenCreate | EsOpenWrite | EsOpenTruncate, mode);
+	if (-1 == stream.fd) {
+		reportPortError(PORTLIB, verboseFlags);
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_SNAPSHOT_FILE_OPEN, snapshotFileName);
+		goto done;
+	}
+	stream.buffer = (U_8*)j9mem_allocate_memory(SNAPSHOT_BUFFER_SIZE, J9MEM_CATEGORY_CLASSES);
+	if (NULL == stream.buffer) {
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, snapshotFileName);
+		goto done;
+	}
+	if (Z_OK != deflateInit(&stream.zStream, Z_DEFAULT_COMPRESSION)) {
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, snapshotFileName);
+		goto done;
+	}
+	deflateStarted = true;
+
+	if (!topLayer->isRunningReadOnly()) {
+		lockRc1 = topLayer->enterWriteMutex(currentThread, false, "j9shr_export_snapshot");
+		if (0 != lockRc1) {
+			SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_SHRINIT_ERROR_ENTER_MUTEX, cacheName);
+			goto done;
+		}
+		if (topLayer->getReadWriteBytes() > 0) {
+			/* readWriteBytes can be 0, in such case, do not need to call enterReadWriteAreaMutex() */
+			lockRc2 = topLayer->enterReadWriteAreaMutex(currentThread, false, &ignore, &ignore);
+			if (0 != lockRc2) {
+				SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_SHRINIT_ERROR_ENTER_MUTEX, cacheName);
+				goto done;
+			}
+		}
+	}
+
+	memcpy(header.eyecatcher, J9SH_COMPRESSED_SNAPSHOT_EYECATCHER, J9SH_COMPRESSED_SNAPSHOT_EYECATCHER_LENGTH);
+	header.formatVersion = J9SH_COMPRESSED_SNAPSHOT_FORMAT_VERSION;
+	header.buildID = getOpenJ9Sha();
+	setCurrentCacheVersion(vm, J2SE_VERSION(vm), &header.versionData);
+	header.versionData.cacheType = J9PORT_SHR_CACHE_TYPE_PERSISTENT;
+	for (cc = topLayer; NULL != cc; cc = cc->getNext()) {
+		header.layerCount += 1;
+		bottomLayer = cc;
+	}
+	if ((IDATA)sizeof(header) != j9file_write(stream.fd, &header, sizeof(header))) {
+		reportPortError(PORTLIB, verboseFlags);
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, snapshotFileName);
+		goto done;
+	}
+
+	/* Write the layers in the order they are created on import */
+	for (cc = bottomLayer; NULL != cc; cc = cc->getPrevious()) {
+		if (!exportLayer(&stream, cc)) {
+			SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, snapshotFileName);
+			goto done;
+		}
+	}
+	if (!writeSnapshotBytes(&stream, NULL, 0, Z_FINISH)) {
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, snapshotFileName);
+		goto done;
+	}
+	if (0 != j9file_sync(stream.fd)) {
+		reportPortError(PORTLIB, verboseFlags);
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, snapshotFileName);
+		goto done;
+	}
+	rc = 0;
+
+done:
+	if (0 == lockRc2) {
+		topLayer->exitReadWriteAreaMutex(currentThread, J9SHR_STRING_POOL_OK);
+	}
+	if (0 == lockRc1) {
+		topLayer->exitWriteMutex(currentThread, "j9shr_export_snapshot");
+	}
+	if (deflateStarted) {
+		Trc_SHR_SNAP_j9shr_export_snapshot_compressed((U_64)stream.zStream.total_in, (U_64)stream.zStream.total_out);
+		deflateEnd(&stream.zStream);
+	}
+	if (NULL != stream.buffer) {
+		j9mem_free_memory(stream.buffer);
+	}
+	if (-1 != stream.fd) {
+		j9file_close(stream.fd);
+		if (0 != rc) {
+			j9file_unlink(snapshotFileName);
+		}
+	}
+	Trc_SHR_SNAP_j9shr_export_snapshot_Exit(rc);
+	return rc;
+}
+
+/**
+ * Read exactly length decompressed bytes from the snapshot file.
+ *
+ * @param [in] stream The snapshot being read
+ * @param [out] data The buffer to fill
+ * @param [in] length The number of bytes to read, at most SNAPSHOT_BUFFER_SIZE
+ *
+ * @return true on success, false if the file could not be read or the compressed stream is corrupt or ended early
+ */
+static bool
+readSnapshotBytes(J9SharedCacheSnapshotStream* stream, void* data, UDATA length)
+{
+	PORT_ACCESS_FROM_PORT(stream->portLibrary);
+
+	stream->zStream.next_out = (Bytef*)data;
+	stream->zStream.avail_out = (uInt)length;
+	while (0 != stream->zStream.avail_out) {
+		int zrc = Z_OK;
+
+		if (stream->streamEnd) {
+			return false;
+		}
+		if (0 == stream->zStream.avail_in) {
+			IDATA bytesRead = j9file_read(stream->fd, stream->buffer, SNAPSHOT_BUFFER_SIZE);
+
+			if (bytesRead <= 0) {
+				return false;
+			}
+			stream->zStream.next_in = (Bytef*)stream->buffer;
+			stream->zStream.avail_in = (uInt)bytesRead;
+		}
+		zrc = inflate(&stream->zStream, Z_NO_FLUSH);
+		if (Z_STREAM_END == zrc) {
+			stream->streamEnd = true;
+		} else if (Z_OK != zrc) {
+			Trc_SHR_SNAP_readSnapshotBytes_inflateFailed(zrc);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Check that the compressed stream ends after the last layer.
+ *
+ * @return true if the stream ended, false if there is more data or the stream is corrupt
+ */
+static bool
+isSnapshotStreamComplete(J9SharedCacheSnapshotStream* stream)
+{
+	U_8 extra = 0;
+
+	if (!stream->streamEnd && readSnapshotBytes(stream, &extra, 1)) {
+		return false;
+	}
+	return stream->streamEnd;
+}
+
+/**
+ * Get the path of the cache file of a layer. Temporary files start with a '.' so they are not listed as caches.
+ */
+static void
+getLayerFileName(J9JavaVM* vm, const char* cacheDirName, const char* cacheName, I_8 layer, bool isTempFile, char* buffer)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9PortShcVersion versionData;
+	char nameWithVGen[CACHE_ROOT_MAXLEN];
+
+	setCurrentCacheVersion(vm, J2SE_VERSION(vm), &versionData);
+	versionData.cacheType = J9PORT_SHR_CACHE_TYPE_PERSISTENT;
+	SH_OSCache::getCacheVersionAndGen(PORTLIB, vm, nameWithVGen, CACHE_ROOT_MAXLEN, cacheName, &versionData, OSCACHE_CURRENT_CACHE_GEN, true, layer);
+	if (isTempFile) {
+		j9str_printf(PORTLIB, buffer, J9SH_MAXPATH, "%s%s%s%s", cacheDirName, SNAPSHOT_TEMP_FILE_PREFIX, nameWithVGen, SNAPSHOT_TEMP_FILE_SUFFIX);
+	} else {
+		/* No check for the return value of getCachePathName() as it always returns 0 */
+		SH_OSCache::getCachePathName(PORTLIB, cacheDirName, buffer, J9SH_MAXPATH, nameWithVGen);
+	}
+}
+
+/**
+ * Create the layers of a persistent cache from a compressed snapshot written by j9shr_export_snapshot().
+ * Each layer is written to a temporary file first, the cache files are only created once every layer was read.
+ * The cache metadata refers to its data by offset, so each layer keeps the size it was exported with. If a cache
+ * size was requested with -Xscmx, the import fails unless it matches the size of the top layer.
+ *
+ * @param [in] vm The current J9JavaVM
+ * @param [in] ctrlDirName The cache directory specified on the command line, or NULL
+ * @param [in] runtimeFlags The runtime flags of the shared classes configuration
+ * @param [in] verboseFlags Flags controlling the verbose output
+ * @param [in] cacheName The name of the cache to create
+ * @param [in] snapshotFileName The file to read
+ *
+ * @return 0 on success, -1 on failure
+ */
+IDATA
+j9shr_import_snapshot(J9JavaVM* vm, const char* ctrlDirName, U_64 runtimeFlags, UDATA verboseFlags, const char* cacheName, const char* snapshotFileName)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	IDATA rc = -1;
+	char cacheDirName[J9SH_MAXPATH];
+	char pathFileName[J9SH_MAXPATH];
+	char tempFileName[J9SH_MAXPATH];
+	bool isGroupAccess = J9_ARE_ALL_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_GROUP_ACCESS);
+	I_32 mode = 0;
+	J9SharedCacheSnapshotStream stream;
+	J9SharedCacheSnapshotHeader header;
+	J9PortShcVersion versionData;
+	U_8* regionBuffer = NULL;
+	bool inflateStarted = false;
+	IDATA cacheFd = -1;
+	I_8 layersCreated = 0;
+	I_8 layersMoved = 0;
+	I_8 layer = 0;
+	UDATA cacheDirLen = 0;
+
+	Trc_SHR_SNAP_j9shr_import_snapshot_Entry(cacheName, snapshotFileName);
+
+	memset(&stream, 0, sizeof(stream));
+	stream.portLibrary = PORTLIB;
+	stream.fd = -1;
+	if (J9_ARE_ALL_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_CACHEDIR_PRESENT)) {
+		mode = isGroupAccess ? J9SH_CACHE_FILE_MODE_USERDIR_WITH_GROUPACCESS : J9SH_CACHE_FILE_MODE_USERDIR_WITHOUT_GROUPACCESS;
+	} else {
+		mode = isGroupAccess ? J9SH_CACHE_FILE_MODE_DEFAULTDIR_WITH_GROUPACCESS : J9SH_CACHE_FILE_MODE_DEFAULTDIR_WITHOUT_GROUPACCESS;
+	}
+
+	if (-1 == SH_OSCache::getCacheDir(vm, ctrlDirName, cacheDirName, J9SH_MAXPATH, J9PORT_SHR_CACHE_TYPE_PERSISTENT)) {
+		/* NLS message has been printed out inside SH_OSCache::getCacheDir() if verbose flag is not 0 */
+		goto done;
+	}
+	if (-1 == SH_OSCache::createCacheDir(PORTLIB, cacheDirName, vm->sharedCacheAPI->cacheDirPerm, false)) {
+		/* remove trailing '/' */
+		cacheDirLen = strlen(cacheDirName);
+		if ((cacheDirLen > 1) && ('/' == cacheDirName[cacheDirLen - 1])) {
+			cacheDirName[cacheDirLen - 1] = '\0';
+		}
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_OSCACHE_CREATECACHEDIR_FAILED_V2, cacheDirName);
+		goto done;
+	}
+
+	/* Never replace any layer of an existing cache */
+	setCurrentCacheVersion(vm, J2SE_VERSION(vm), &versionData);
+	versionData.cacheType = J9PORT_SHR_CACHE_TYPE_PERSISTENT;
+	for (layer = 0; layer <= J9SH_LAYER_NUM_MAX_VALUE; layer++) {
+		char nameWithVGen[CACHE_ROOT_MAXLEN];
+
+		SH_OSCache::getCacheVersionAndGen(PORTLIB, vm, nameWithVGen, CACHE_ROOT_MAXLEN, cacheName, &versionData, OSCACHE_CURRENT_CACHE_GEN, true, layer);
+		if (1 == SH_OSCache::statCache(PORTLIB, cacheDirName, nameWithVGen, false)) {
+			SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_CACHE_EXISTS, cacheName);
+			goto done;
+		}
+	}
+
+	stream.fd = j9file_open(snapshotFileName, EsOpenRead, 0);
+	if (-1 == stream.fd) {
+		reportPortError(PORTLIB, verboseFlags);
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_SNAPSHOT_FILE_OPEN, snapshotFileName);
+		goto done;
+	}
+	if ((IDATA)sizeof(header) != j9file_read(stream.fd, &header, sizeof(header))
+		|| (0 != memcmp(header.eyecatcher, J9SH_COMPRESSED_SNAPSHOT_EYECATCHER, J9SH_COMPRESSED_SNAPSHOT_EYECATCHER_LENGTH))
+		|| (J9SH_COMPRESSED_SNAPSHOT_FORMAT_VERSION != header.formatVersion)
+		|| (0 == header.layerCount)
+		|| (header.layerCount > (J9SH_LAYER_NUM_MAX_VALUE + 1))
+	) {
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_CORRUPT, snapshotFileName);
+		goto done;
+	}
+	if ((header.buildID != getOpenJ9Sha())
+		|| (0 != memcmp(&header.versionData, &versionData, sizeof(J9PortShcVersion)))
+	) {
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_INCOMPATIBLE, snapshotFileName);
+		goto done;
+	}
+
+	stream.buffer = (U_8*)j9mem_allocate_memory(SNAPSHOT_BUFFER_SIZE, J9MEM_CATEGORY_CLASSES);
+	regionBuffer = (U_8*)j9mem_allocate_memory(SNAPSHOT_BUFFER_SIZE, J9MEM_CATEGORY_CLASSES);
+	if ((NULL == stream.buffer) || (NULL == regionBuffer) || (Z_OK != inflateInit(&stream.zStream))) {
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_READ, snapshotFileName);
+		goto done;
+	}
+	inflateStarted = true;
+
+	for (layer = 0; layer < (I_8)header.layerCount; layer++) {
+		J9SharedCacheSnapshotLayer layerRecord;
+		U_64 regionEnd = 0;
+		U_32 i = 0;
+
+		if (!readSnapshotBytes(&stream, &layerRecord, sizeof(layerRecord))) {
+			SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_CORRUPT, snapshotFileName);
+			goto done;
+		}
+		if ((layer != layerRecord.layer)
+			|| (layerRecord.fileSize > MAX_CC_SIZE)
+			|| (0 == layerRecord.regionCount)
+			|| (layerRecord.regionCount > SNAPSHOT_MAX_REGIONS)
+		) {
+			Trc_SHR_SNAP_j9shr_import_snapshot_invalidRecord(layer);
+			SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_CORRUPT, snapshotFileName);
+			goto done;
+		}
+		if ((layer == (I_8)(header.layerCount - 1))
+			&& (0 != vm->sharedCacheAPI->snapshotCacheSize)
+			&& ((U_64)vm->sharedCacheAPI->snapshotCacheSize != layerRecord.fileSize)
+		) {
+			SNAPSHOT_ERR_TRACE3(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_SIZE_MISMATCH, snapshotFileName, layerRecord.fileSize, (U_64)vm->sharedCacheAPI->snapshotCacheSize);
+			goto done;
+		}
+
+		getLayerFileName(vm, cacheDirName, cacheName, layer, true, tempFileName);
+		cacheFd = j9file_open(tempFileName, EsOpenCreate | EsOpenWrite | EsOpenTruncate, mode);
+		if (-1 == cacheFd) {
+			reportPortError(PORTLIB, verboseFlags);
+			SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, tempFileName);
+			goto done;
+		}
+		layersCreated = layer + 1;
+		/* The free space between the regions is never written, so the cache file is sparse */
+		if (0 != j9file_set_length(cacheFd, (I_64)layerRecord.fileSize)) {
+			reportPortError(PORTLIB, verboseFlags);
+			SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, tempFileName);
+			goto done;
+		}
+
+		for (i = 0; i < layerRecord.regionCount; i++) {
+			J9SharedCacheSnapshotRegion regionRecord;
+			U_64 remaining = 0;
+
+			if (!readSnapshotBytes(&stream, &regionRecord, sizeof(regionRecord))) {
+				SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_CORRUPT, snapshotFileName);
+				goto done;
+			}
+			if ((regionRecord.offset < regionEnd)
+				|| (regionRecord.length > layerRecord.fileSize)
+				|| (regionRecord.offset > (layerRecord.fileSize - regionRecord.length))
+			) {
+				Trc_SHR_SNAP_j9shr_import_snapshot_invalidRecord(layer);
+				SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_CORRUPT, snapshotFileName);
+				goto done;
+			}
+			if ((I_64)regionRecord.offset != j9file_seek(cacheFd, (I_64)regionRecord.offset, EsSeekSet)) {
+				reportPortError(PORTLIB, verboseFlags);
+				SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, tempFileName);
+				goto done;
+			}
+			remaining = regionRecord.length;
+			while (remaining > 0) {
+				UDATA chunk = (UDATA)OMR_MIN(remaining, (U_64)SNAPSHOT_BUFFER_SIZE);
+
+				if (!readSnapshotBytes(&stream, regionBuffer, chunk)) {
+					SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_CORRUPT, snapshotFileName);
+					goto done;
+				}
+				if ((IDATA)chunk != j9file_write(cacheFd, regionBuffer, chunk)) {
+					reportPortError(PORTLIB, verboseFlags);
+					SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, tempFileName);
+					goto done;
+				}
+				remaining -= chunk;
+			}
+			regionEnd = regionRecord.offset + regionRecord.length;
+		}
+
+		if (0 != j9file_sync(cacheFd)) {
+			reportPortError(PORTLIB, verboseFlags);
+			SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, tempFileName);
+			goto done;
+		}
+		j9file_close(cacheFd);
+		cacheFd = -1;
+		Trc_SHR_SNAP_j9shr_import_snapshot_layerCreated(layer, layerRecord.fileSize);
+	}
+
+	if (!isSnapshotStreamComplete(&stream)) {
+		SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_CORRUPT, snapshotFileName);
+		goto done;
+	}
+
+	for (layer = 0; layer < layersCreated; layer++) {
+		getLayerFileName(vm, cacheDirName, cacheName, layer, true, tempFileName);
+		getLayerFileName(vm, cacheDirName, cacheName, layer, false, pathFileName);
+		if (0 != j9file_move(tempFileName, pathFileName)) {
+			reportPortError(PORTLIB, verboseFlags);
+			SNAPSHOT_ERR_TRACE1(J9NLS_SHRC_ERROR_COMPRESSED_SNAPSHOT_WRITE, pathFileName);
+			goto done;
+		}
+		layersMoved = layer + 1;
+	}
+	rc = 0;
+
+done:
+	if (-1 != cacheFd) {
+		j9file_close(cacheFd);
+	}
+	if (0 != rc) {
+		for (layer = 0; layer < layersCreated; layer++) {
+			if (layer < layersMoved) {
+				getLayerFileName(vm, cacheDirName, cacheName, layer, false, pathFileName);
+				j9file_unlink(pathFileName);
+			} else {
+				getLayerFileName(vm, cacheDirName, cacheName, layer, true, tempFileName);
+				j9file_unlink(tempFileName);
+			}
+		}
+	}
+	if (inflateStarted) {
+		inflateEnd(&stream.zStream);
+	}
+	if (NULL != regionBuffer) {
+		j9mem_free_memory(regionBuffer);
+	}
+	if (NULL != stream.buffer) {
+		j9mem_free_memory(stream.buffer);
+	}
+	if (-1 != stream.fd) {
+		j9file_close(stream.fd);
+	}
+	Trc_SHR_SNAP_j9shr_import_snapshot_Exit(rc);
+	return rc;
+}
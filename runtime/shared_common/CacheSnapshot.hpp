@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(CACHESNAPSHOT_HPP_INCLUDE)
+#define CACHESNAPSHOT_HPP_INCLUDE
+
+/* @ddr_namespace: default */
+#include "j9.h"
+#include "shchelp.h"
+
+#define J9SH_COMPRESSED_SNAPSHOT_EYECATCHER "J9SCSNAP"
+#define J9SH_COMPRESSED_SNAPSHOT_EYECATCHER_LENGTH 8
+#define J9SH_COMPRESSED_SNAPSHOT_FORMAT_VERSION 1
+
+/* DO NOT use UDATA/IDATA in the snapshot records so that the file layout does not depend on the JVM that wrote it.
+ *
+ * A compressed snapshot file is a J9SharedCacheSnapshotHeader followed by a zlib stream. For each layer of the cache,
+ * starting at layer 0, the stream holds a J9SharedCacheSnapshotLayer and then regionCount J9SharedCacheSnapshotRegions,
+ * each followed by the bytes of the cache file it describes. The free space between the regions is not stored,
+ * it reads as zero in the sparse cache file created on import.
+ */
+typedef struct J9SharedCacheSnapshotHeader {
+	char eyecatcher[J9SH_COMPRESSED_SNAPSHOT_EYECATCHER_LENGTH];
+	U_32 formatVersion;
+	U_32 layerCount;
+	U_64 buildID;
+	J9PortShcVersion versionData;
+} J9SharedCacheSnapshotHeader;
+
+typedef struct J9SharedCacheSnapshotLayer {
+	I_32 layer;
+	U_32 regionCount;
+	U_64 fileSize;
+} J9SharedCacheSnapshotLayer;
+
+typedef struct J9SharedCacheSnapshotRegion {
+	U_64 offset; /* from the start of the cache file */
+	U_64 length;
+} J9SharedCacheSnapshotRegion;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+IDATA j9shr_export_snapshot(struct J9JavaVM* vm, const char* cacheName, const char* snapshotFileName);
+
+IDATA j9shr_import_snapshot(struct J9JavaVM* vm, const char* ctrlDirName, U_64 runtimeFlags, UDATA verboseFlags, const char* cacheName, const char* snapshotFileName);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+#endif /* !defined(CACHESNAPSHOT_HPP_INCLUDE) */
@@ -0,0 +1,476 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * The class preloader builds the RAM classes of bootstrap classes on helper threads while main() starts.
+ *
+ * When a JVM running with -Xshareclasses:preloadClasses leaves the startup phase, it stores the names of the
+ * bootstrap classes it loaded from the cache in a J9SHR_DATA_TYPE_PRELOAD_CLASSES record, under the same command
+ * line key as the startup hints. Superclasses are listed before their subclasses. A later JVM with the same command
+ * line finds the list once the VM is initialized and loads those classes on a few system daemon threads, so the
+ * lookups made by the application find the classes already built. The classes are loaded but not initialized,
+ * so no Java code runs on the helper threads.
+ *
+ * A list is not updated by later JVMs. It is only replaced when more than CLASS_PRELOADER_MAX_FAILED_PERCENT
+ * of its classes fail to load, which happens when the bootstrap classes on the command line change, or when the
+ * list is malformed.
+ */
+
+#include "shrinit.h"
+#include "j9cp.h"
+#include "util_api.h"
+#include "ut_j9shr.h"
+#include <string.h>
+
+/* Limit on the number of helper threads */
+#define CLASS_PRELOADER_MAX_THREADS 4
+/* Share of the classes of a preload list which may fail to load before the list is replaced */
+#define CLASS_PRELOADER_MAX_FAILED_PERCENT 10
+
+typedef struct J9SharedClassPreloader {
+	J9JavaVM* vm;
+	omrthread_monitor_t monitor;
+	const U_8* cursor; /* next entry of the preload list in the cache */
+	const U_8* end;
+	UDATA activeThreads;
+	UDATA classesLoaded;
+	UDATA classesFailed;
+	bool listFound;
+	bool listStale;
+	bool stopRequested;
+} J9SharedClassPreloader;
+
+/**
+ * Check that the entries of a preload list record lie within the record
+ *
+ * @param [in] data The record
+ * @param [in] length The length of the record in bytes
+ *
+ * @return true if the record is well formed, false otherwise
+ */
+static bool
+isValidPreloadList(const U_8* data, UDATA length)
+{
+	J9SharedClassPreloadListHeader header;
+	const U_8* cursor = data + sizeof(J9SharedClassPreloadListHeader);
+	const U_8* end = data + length;
+	U_32 i = 0;
+
+	if (length < sizeof(J9SharedClassPreloadListHeader)) {
+		return false;
+	}
+	memcpy(&header, data, sizeof(J9SharedClassPreloadListHeader));
+	for (i = 0; i < header.classCount; i++) {
+		U_16 nameLength = 0;
+
+		if ((UDATA)(end - cursor) < sizeof(U_16)) {
+			return false;
+		}
+		memcpy(&nameLength, cursor, sizeof(U_16));
+		cursor += sizeof(U_16);
+		if ((UDATA)(end - cursor) < nameLength) {
+			return false;
+		}
+		cursor += nameLength;
+	}
+	return cursor == end;
+}
+
+/**
+ * Compare the depth of two classes so that superclasses sort before their subclasses
+ */
+static int
+compareClassDepth(const void* left, const void* right)
+{
+	UDATA leftDepth = J9CLASS_DEPTH(*(J9Class**)left);
+	UDATA rightDepth = J9CLASS_DEPTH(*(J9Class**)right);
+
+	if (leftDepth < rightDepth) {
+		return -1;
+	}
+	if (leftDepth > rightDepth) {
+		return 1;
+	}
+	return 0;
+}
+
+/**
+ * Check whether a class can appear in the preload list
+ */
+static bool
+isPreloadableClass(J9JavaVM* vm, J9Class* clazz)
+{
+	J9ROMClass* romClass = clazz->romClass;
+
+	return !J9ROMCLASS_IS_ARRAY(romClass)
+		&& !J9_IS_CLASS_OBSOLETE(clazz)
+		&& j9shr_isAddressInCache(vm, romClass, romClass->romSize, FALSE);
+}
+
+/**
+ * Helper thread which loads the classes of the preload list until the list is exhausted or a stop is requested.
+ */
+static int J9THREAD_PROC
+preloadClassesThreadProc(void* entryArg)
+{
+	J9SharedClassPreloader* preloader = (J9SharedClassPreloader*)entryArg;
+	J9JavaVM* vm = preloader->vm;
+	J9InternalVMFunctions* vmFuncs = vm->internalVMFunctions;
+	J9VMThread* currentThread = NULL;
+	UDATA classesLoaded = 0;
+	UDATA classesFailed = 0;
+
+	if (JNI_OK == vmFuncs->attachSystemDaemonThread(vm, &currentThread, "Shared Class Preloader")) {
+		for (;;) {
+			U_16 nameLength = 0;
+			U_8* name = NULL;
+
+			omrthread_monitor_enter(preloader->monitor);
+			if (!preloader->stopRequested && (preloader->cursor < preloader->end)) {
+				memcpy(&nameLength, preloader->cursor, sizeof(U_16));
+				name = (U_8*)preloader->cursor + sizeof(U_16);
+				preloader->cursor = name + nameLength;
+			}
+			omrthread_monitor_exit(preloader->monitor);
+			if (NULL == name) {
+				break;
+			}
+
+			vmFuncs->internalEnterVMFromJNI(currentThread);
+			if (NULL == vmFuncs->internalFindClassUTF8(currentThread, name, nameLength, vm->systemClassLoader, 0)) {
+				/* The application will see the same failure when it loads the class itself */
+				currentThread->currentException = NULL;
+				classesFailed += 1;
+				Trc_SHR_CP_preloadClassesThreadProc_LoadFailed(currentThread, nameLength, name);
+			} else {
+				classesLoaded += 1;
+			}
+			vmFuncs->internalExitVMToJNI(currentThread);
+		}
+		vmFuncs->DetachCurrentThread((JavaVM*)vm);
+	}
+
+	omrthread_monitor_enter(preloader->monitor);
+	preloader->classesLoaded += classesLoaded;
+	preloader->classesFailed += classesFailed;
+	preloader->activeThreads -= 1;
+	Trc_SHR_CP_preloadClassesThreadProc_Finished(classesLoaded, classesFailed, preloader->activeThreads);
+	omrthread_monitor_notify_all(preloader->monitor);
+	omrthread_exit(preloader->monitor);
+	return 0;
+}
+
+/**
+ * Allocate the state of the class preloader
+ *
+ * @param [in] vm The Java VM
+ *
+ * @return true on success, false otherwise
+ */
+bool
+j9shr_createClassPreloader(J9JavaVM* vm)
+{
+	J9SharedClassPreloader* preloader = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	preloader = (J9SharedClassPreloader*)j9mem_allocate_memory(sizeof(J9SharedClassPreloader), J9MEM_CATEGORY_CLASSES);
+	if (NULL == preloader) {
+		return false;
+	}
+	memset(preloader, 0, sizeof(J9SharedClassPreloader));
+	preloader->vm = vm;
+	if (0 != omrthread_monitor_init(&preloader->monitor, 0)) {
+		j9mem_free_memory(preloader);
+		return false;
+	}
+	vm->sharedClassConfig->classPreloader = preloader;
+	return true;
+}
+
+/**
+ * Free the state of the class preloader. The state is left allocated if a helper thread is still running,
+ * which only happens if the JVM exits without triggering J9HOOK_VM_SHUTTING_DOWN.
+ *
+ * @param [in] vm The Java VM
+ */
+void
+j9shr_destroyClassPreloader(J9JavaVM* vm)
+{
+	J9SharedClassPreloader* preloader = (J9SharedClassPreloader*)vm->sharedClassConfig->classPreloader;
+	UDATA activeThreads = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL == preloader) {
+		return;
+	}
+	omrthread_monitor_enter(preloader->monitor);
+	preloader->stopRequested = true;
+	activeThreads = preloader->activeThreads;
+	omrthread_monitor_exit(preloader->monitor);
+
+	vm->sharedClassConfig->classPreloader = NULL;
+	if (0 == activeThreads) {
+		omrthread_monitor_destroy(preloader->monitor);
+		j9mem_free_memory(preloader);
+	} else {
+		Trc_SHR_CP_j9shr_destroyClassPreloader_ThreadsActive(activeThreads);
+	}
+}
+
+/**
+ * Check whether the preload list of the cache should be replaced by the classes loaded by this JVM.
+ * A list is only judged once all its classes have been loaded, so that the failures are counted.
+ *
+ * @param [in] preloader The class preloader
+ *
+ * @return true if the list is malformed or too many of its classes failed to load, false otherwise
+ */
+static bool
+isPreloadListStale(J9SharedClassPreloader* preloader)
+{
+	bool stale = preloader->listStale;
+
+	omrthread_monitor_enter(preloader->monitor);
+	if (!stale && (0 == preloader->activeThreads) && (preloader->cursor >= preloader->end)) {
+		UDATA classesProcessed = preloader->classesLoaded + preloader->classesFailed;
+
+		stale = (preloader->classesFailed * 100) > (classesProcessed * CLASS_PRELOADER_MAX_FAILED_PERCENT);
+	}
+	omrthread_monitor_exit(preloader->monitor);
+	return stale;
+}
+
+/**
+ * J9HOOK_VM_INITIALIZED handler which starts the helper threads if the cache holds a preload list
+ * for the command line of this JVM.
+ *
+ * Nothing is preloaded while a JVMTI agent is loaded. An agent can enable the ClassFileLoadHook event
+ * from its own VMInit callback, which may run after this handler, and the classes loaded before
+ * that would bypass it.
+ */
+void
+hookStartClassPreload(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData)
+{
+	J9VMThread* currentThread = ((J9VMInitEvent*)voidData)->vmThread;
+	J9JavaVM* vm = currentThread->javaVM;
+	J9SharedClassPreloader* preloader = NULL;
+	J9SharedDataDescriptor descriptor = {0};
+	char* key = NULL;
+	UDATA threadCount = 0;
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if ((NULL == vm->sharedClassConfig) || (NULL == vm->sharedClassConfig->classPreloader)) {
+		return;
+	}
+	preloader = (J9SharedClassPreloader*)vm->sharedClassConfig->classPreloader;
+
+	/* JVMTI reserves J9HOOK_VM_CLASS_LOAD_HOOK as soon as an agent is loaded */
+	if (J9_EVENT_IS_RESERVED(vm->hookInterface, J9HOOK_VM_CLASS_LOAD_HOOK)
+		|| J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_CLASS_LOAD_HOOK)
+		|| J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_CLASS_LOAD_HOOK2)
+	) {
+		/* A JVM with an agent neither uses nor records a preload list */
+		preloader->listFound = true;
+		Trc_SHR_CP_hookStartClassPreload_AgentLoaded(currentThread);
+		return;
+	}
+
+	key = generateStartupHintsKey(vm);
+	if (NULL == key) {
+		Trc_SHR_CP_hookStartClassPreload_NullKey(currentThread);
+		return;
+	}
+	if (0 < j9shr_findSharedData(currentThread, key, strlen(key), J9SHR_DATA_TYPE_PRELOAD_CLASSES, FALSE, &descriptor, NULL)) {
+		preloader->listFound = true;
+		if (!isValidPreloadList(descriptor.address, descriptor.length)) {
+			preloader->listStale = true;
+			Trc_SHR_CP_hookStartClassPreload_InvalidList(currentThread, descriptor.length);
+		} else {
+			preloader->cursor = descriptor.address + sizeof(J9SharedClassPreloadListHeader);
+			preloader->end = descriptor.address + descriptor.length;
+		}
+	}
+	j9mem_free_memory(key);
+
+	if (preloader->cursor >= preloader->end) {
+		Trc_SHR_CP_hookStartClassPreload_NoList(currentThread);
+		return;
+	}
+
+	/* Leave half of the CPUs to the main thread and the JIT */
+	threadCount = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_ONLINE) / 2;
+	if (0 == threadCount) {
+		threadCount = 1;
+	}
+	threadCount = OMR_MIN(threadCount, CLASS_PRELOADER_MAX_THREADS);
+
+	for (i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+
+		omrthread_monitor_enter(preloader->monitor);
+		preloader->activeThreads += 1;
+		omrthread_monitor_exit(preloader->monitor);
+		if (0 != omrthread_create(&thread, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, 0, preloadClassesThreadProc, preloader)) {
+			omrthread_monitor_enter(preloader->monitor);
+			preloader->activeThreads -= 1;
+			omrthread_monitor_exit(preloader->monitor);
+			break;
+		}
+	}
+	Trc_SHR_CP_hookStartClassPreload_ThreadsStarted(currentThread, i, descriptor.length);
+}
+
+/**
+ * J9HOOK_VM_SHUTTING_DOWN handler which stops the helper threads and waits for them to detach.
+ * The hook is triggered without VM access, so a helper thread loading a class can still complete.
+ */
+void
+hookStopClassPreload(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData)
+{
+	J9VMThread* currentThread = ((J9VMShutdownEvent*)voidData)->vmThread;
+	J9JavaVM* vm = currentThread->javaVM;
+	J9SharedClassPreloader* preloader = NULL;
+
+	if ((NULL == vm->sharedClassConfig) || (NULL == vm->sharedClassConfig->classPreloader)) {
+		return;
+	}
+	preloader = (J9SharedClassPreloader*)vm->sharedClassConfig->classPreloader;
+
+	omrthread_monitor_enter(preloader->monitor);
+	preloader->stopRequested = true;
+	while (0 != preloader->activeThreads) {
+		omrthread_monitor_wait(preloader->monitor);
+	}
+	Trc_SHR_CP_hookStopClassPreload_Stopped(currentThread, preloader->classesLoaded, preloader->classesFailed);
+	omrthread_monitor_exit(preloader->monitor);
+}
+
+/**
+ * Store the list of bootstrap classes loaded from the cache, if no list was found for the command line
+ * of this JVM, or if the list found is stale. Called when the JVM leaves the startup phase.
+ *
+ * @param [in] currentThread The current thread
+ */
+void
+j9shr_storeClassPreloadList(J9VMThread* currentThread)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	J9SharedClassConfig* config = vm->sharedClassConfig;
+	J9SharedClassPreloader* preloader = (J9SharedClassPreloader*)config->classPreloader;
+	J9InternalVMFunctions* vmFuncs = vm->internalVMFunctions;
+	J9SharedClassPreloadListHeader header;
+	J9SharedDataDescriptor descriptor = {0};
+	J9ClassWalkState walkState;
+	J9Class** classes = NULL;
+	J9Class* clazz = NULL;
+	U_8* data = NULL;
+	U_8* cursor = NULL;
+	char* key = NULL;
+	UDATA classCount = 0;
+	UDATA dataLength = sizeof(J9SharedClassPreloadListHeader);
+	UDATA i = 0;
+	bool replaceList = false;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if ((NULL == preloader) || J9_ARE_ANY_BITS_SET(config->runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY)) {
+		return;
+	}
+	if (preloader->listFound) {
+		if (!isPreloadListStale(preloader)) {
+			return;
+		}
+		replaceList = true;
+		Trc_SHR_CP_j9shr_storeClassPreloadList_ReplacingList(currentThread, preloader->classesLoaded, preloader->classesFailed);
+	}
+
+	clazz = vmFuncs->allClassesStartDo(&walkState, vm, vm->systemClassLoader);
+	while (NULL != clazz) {
+		if (isPreloadableClass(vm, clazz)) {
+			classCount += 1;
+		}
+		clazz = vmFuncs->allClassesNextDo(&walkState);
+	}
+	vmFuncs->allClassesEndDo(&walkState);
+	if (0 == classCount) {
+		return;
+	}
+
+	classes = (J9Class**)j9mem_allocate_memory(classCount * sizeof(J9Class*), J9MEM_CATEGORY_CLASSES);
+	if (NULL == classes) {
+		Trc_SHR_CP_j9shr_storeClassPreloadList_OutOfMemory(currentThread, classCount * sizeof(J9Class*));
+		return;
+	}
+
+	/* Bootstrap classes are never unloaded, so the second walk finds at least classCount classes */
+	clazz = vmFuncs->allClassesStartDo(&walkState, vm, vm->systemClassLoader);
+	i = 0;
+	while ((NULL != clazz) && (i < classCount)) {
+		if (isPreloadableClass(vm, clazz)) {
+			classes[i] = clazz;
+			dataLength += sizeof(U_16) + J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(clazz->romClass));
+			i += 1;
+		}
+		clazz = vmFuncs->allClassesNextDo(&walkState);
+	}
+	vmFuncs->allClassesEndDo(&walkState);
+
+	J9_SORT(classes, classCount, sizeof(J9Class*), compareClassDepth);
+
+	data = (U_8*)j9mem_allocate_memory(dataLength, J9MEM_CATEGORY_CLASSES);
+	if (NULL == data) {
+		Trc_SHR_CP_j9shr_storeClassPreloadList_OutOfMemory(currentThread, dataLength);
+		goto done;
+	}
+	header.classCount = (U_32)classCount;
+	memcpy(data, &header, sizeof(J9SharedClassPreloadListHeader));
+	cursor = data + sizeof(J9SharedClassPreloadListHeader);
+	for (i = 0; i < classCount; i++) {
+		J9UTF8* className = J9ROMCLASS_CLASSNAME(classes[i]->romClass);
+		U_16 nameLength = J9UTF8_LENGTH(className);
+
+		memcpy(cursor, &nameLength, sizeof(U_16));
+		cursor += sizeof(U_16);
+		memcpy(cursor, J9UTF8_DATA(className), nameLength);
+		cursor += nameLength;
+	}
+
+	key = generateStartupHintsKey(vm);
+	if (NULL == key) {
+		Trc_SHR_CP_j9shr_storeClassPreloadList_NullKey(currentThread);
+		goto done;
+	}
+	descriptor.address = data;
+	descriptor.length = dataLength;
+	descriptor.type = J9SHR_DATA_TYPE_PRELOAD_CLASSES;
+	descriptor.flags = replaceList ? J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE_OVERWRITE : J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE;
+	if (NULL == j9shr_storeSharedData(currentThread, key, strlen(key), &descriptor)) {
+		Trc_SHR_CP_j9shr_storeClassPreloadList_StoreFailed(currentThread, classCount, dataLength);
+	} else {
+		Trc_SHR_CP_j9shr_storeClassPreloadList_Stored(currentThread, classCount, dataLength);
+	}
+	j9mem_free_memory(key);
+
+done:
+	j9mem_free_memory(data);
+	j9mem_free_memory(classes);
+}
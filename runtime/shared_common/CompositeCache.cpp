@@ -96,6 +96,13 @@
 #define FAILED_WRITEHASH_MAX_COUNT 20
 
 #define DEFAULT_READWRITE_BYTES_DIVISOR 150		/* 1/150 of cache is set aside for readWrite by default */
+#define CLASS_INDEX_CACHE_BYTES_PER_ENTRY 2000		/* Same estimate of classes per cache byte as the ROMClass manager hashtable */
+#define CLASS_INDEX_MIN_ENTRIES 100
+#define STARTUP_PAGE_MAP_DEFAULT_PAGE_SIZE 4096		/* Used when the OS page size is not known */
+#define STARTUP_PAGE_MAP_BITS_PER_WORD (sizeof(UDATA) * 8)
+#define STARTUP_PAGE_SIZE(pageSize) ((0 == (pageSize)) ? STARTUP_PAGE_MAP_DEFAULT_PAGE_SIZE : (pageSize))
+#define STARTUP_PAGE_MAP_GENERATIONS 2		/* The pages accessed by the last two JVMs which stored them */
+#define STARTUP_PAGE_RESIDENCY_CHUNK 64		/* Pages queried at a time for their residency */
 
 #define ALLOCATE_TYPE_BLOCK 1
 #define ALLOCATE_TYPE_AOT 2
@@ -114,6 +121,8 @@
 
 #define CC_READONLY_LOCK_VALUE (U_32)-1
 #define CC_MAX_READONLY_WAIT_FOR_CACHE_LOCK_MILLIS 100
+/* An uncontended write lock is acquired well within this time, so a longer wait means a writer in another JVM held it */
+#define CC_WRITE_MUTEX_CONTENDED_WAIT_MICROS 100
 
 #define CC_COULD_NOT_ENTER_STRINGTABLE_ON_STARTUP 0xdeadbeef
 
@@ -156,9 +165,10 @@ SH_CompositeCacheImpl::SH_SharedCacheHeaderInit::init(BlockPtr data, U_32 len, I
 	ca->writerCount = 0;
 	ca->softMaxBytes = softMaxBytes;
 	ca->cacheFullFlags = 0;
-	ca->unused8 = 0;
-	ca->unused9 = 0;
-	ca->unused10 = 0;
+	ca->writeMutexAcquireCount = 0;
+	ca->writeMutexContendedCount = 0;
+	ca->writeMutexWaitMicros = 0;
+	ca->writeMutexContendedWaitMicros = 0;
 	/* Note that the updateCountLockWord is only ever used single threaded, so no need to dereference this */
 	WSRP_SET(ca->updateCountPtr, &(ca->updateCount));
 	WSRP_SET(ca->corruptFlagPtr, &(ca->corruptFlag));
@@ -270,6 +280,11 @@ SH_CompositeCacheImpl::commonInit(J9JavaVM* vm)
 	_initializingNewCache = false;
 	_minimumAccessedShrCacheMetadata = 0;
 	_maximumAccessedShrCacheMetadata = 0;
+	_startupPagesTouched = NULL;
+	_startupPagesReadAhead = 0;
+	_startupPagesTouchedCount = 0;
+	_startupPagesTouchedReadAhead = 0;
+	_startupPagesStored = false;
 	_layer = 0;
 }
 
@@ -491,6 +506,12 @@ SH_CompositeCacheImpl::cleanup(J9VMThread* currentThread)
 		omrthread_tls_free(_commonCCInfo->writeMutexEntryCount);
 		_commonCCInfo->writeMutexEntryCount = 0;
 	}
+
+	if (NULL != _startupPagesTouched) {
+		PORT_ACCESS_FROM_PORT(_portlib);
+		j9mem_free_memory(_startupPagesTouched);
+		_startupPagesTouched = NULL;
+	}
 	
 	Trc_SHR_CC_cleanup_Exit(currentThread);
 }
@@ -669,6 +690,8 @@ SH_CompositeCacheImpl::setCacheAreaBoundaries(J9VMThread* currentThread, J9Share
 	BlockPtr finalSegmentStart;
 	U_32 numOfSharedNodes;
 	U_32 maxSharedStringTableSize;
+	U_32 classIndexBytes = 0;
+	U_32 startupPageMapBytes = 0;
 	
 	PORT_ACCESS_FROM_JAVAVM(vm);
 	
@@ -721,6 +744,18 @@ SH_CompositeCacheImpl::setCacheAreaBoundaries(J9VMThread* currentThread, J9Share
 		}
 	}
 
+	/* The startup page map and then the class index are placed after the shared string intern table, at the end of the readWrite area */
+	startupPageMapBytes = (U_32)SHC_PAD(((_theca->totalBytes / STARTUP_PAGE_SIZE(_osPageSize)) / 8) + 1, SHC_DOUBLEALIGN) * STARTUP_PAGE_MAP_GENERATIONS;
+	finalReadWriteSize = SHC_PAD(finalReadWriteSize, SHC_DOUBLEALIGN) + startupPageMapBytes;
+
+	classIndexBytes = srpHashTable_requiredMemorySize((_theca->totalBytes / CLASS_INDEX_CACHE_BYTES_PER_ENTRY) + CLASS_INDEX_MIN_ENTRIES, sizeof(J9SharedClassIndexEntry), TRUE);
+	if (PRIMENUMBERHELPER_OUTOFRANGE == classIndexBytes) {
+		classIndexBytes = 0;
+	} else {
+		classIndexBytes = SHC_PAD(classIndexBytes + sizeof(J9SharedClassIndexHeader), SHC_DOUBLEALIGN);
+		finalReadWriteSize = SHC_PAD(finalReadWriteSize, SHC_DOUBLEALIGN) + classIndexBytes;
+	}
+
 
 	/* Work out where the segment area will now start from */
 	finalSegmentStart = (BlockPtr)SHC_PAD(((UDATA)((BlockPtr)_theca) + finalReadWriteSize + sizeof(J9SharedCacheHeader)), SHC_WORDALIGN);
@@ -774,10 +809,18 @@ SH_CompositeCacheImpl::setCacheAreaBoundaries(J9VMThread* currentThread, J9Share
 		 * it can never be smaller than piConfig->sharedClassReadWriteBytes codewise.
 		 * Still we do assertion check here just to be sure.
 		 */
-		Trc_SHR_Assert_True(((IDATA)READWRITEAREASIZE(_theca)) >= piConfig->sharedClassReadWriteBytes);
+		Trc_SHR_Assert_True(((IDATA)(READWRITEAREASIZE(_theca) - classIndexBytes - startupPageMapBytes)) >= piConfig->sharedClassReadWriteBytes);
 		_theca->sharedInternTableBytes = piConfig->sharedClassReadWriteBytes;
 	} else {
-		_theca->sharedInternTableBytes = (IDATA)READWRITEAREASIZE(_theca);
+		_theca->sharedInternTableBytes = (IDATA)(READWRITEAREASIZE(_theca) - classIndexBytes - startupPageMapBytes);
+	}
+
+	/* The page map is all zeroes in a new cache */
+	_theca->startupPageMapSRP = _theca->readWriteBytes - classIndexBytes - startupPageMapBytes;
+	_theca->startupPageMapBytes = startupPageMapBytes;
+
+	if (0 != classIndexBytes) {
+		initClassIndex(currentThread, _theca->readWriteBytes - classIndexBytes, classIndexBytes);
 	}
 
 	/*
@@ -1720,6 +1763,7 @@ releaseLockCheck:
 			}
 		}
 		protectHeaderReadWriteArea(currentThread, false);
+		readAheadStartupPages(currentThread);
 	}
 	Trc_SHR_CC_startup_Exit5(currentThread, rc);
 	return rc;
@@ -1988,6 +2032,10 @@ SH_CompositeCacheImpl::nextEntry(J9VMThread* currentThread, UDATA* staleItems)
  * Allows only single-threaded writing to the cache.
  * Write mutex allows multiple concurrent readers, unless lockCache
  * is set to true, in which case it blocks until all readers have finished.
+ *
+ * Every store into the cache is serialized here. The acquisitions, the contended
+ * acquisitions and the time spent waiting are counted in the cache header, across
+ * all JVMs using the cache, and are shown by printStats.
  * 
  * @param [in] currentThread  Point to the J9VMThread struct for the current thread
  * @param [in] lockCache  Set to true if whole cache should be locked for this write
@@ -2001,6 +2049,10 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 	IDATA rc;
 	SH_OSCache* oscacheToUse = ((_ccHead == NULL) ? _oscache : _ccHead->_oscache); 
 	const char *fname = "enterWriteMutex";
+	bool contended = false;
+	U_64 waitStart = 0;
+	UDATA waitMicros = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
 
 	Trc_SHR_CC_enterWriteMutex_Enter(currentThread, lockCache, caller);
 	
@@ -2018,12 +2070,25 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 	Trc_SHR_Assert_NotEquals(currentThread, _commonCCInfo->hasReadWriteMutexThread);
 	Trc_SHR_Assert_NotEquals(currentThread, _commonCCInfo->hasRefreshMutexThread);
 
+	/* writeMutexWaiters counts the threads in this JVM holding or queued on the write mutex, so finding
+	 * another one there means this thread has to wait. Waits on writers in other JVMs are only visible
+	 * through the time spent acquiring the lock.
+	 */
+	contended = (1 < VM_AtomicSupport::add(&_commonCCInfo->writeMutexWaiters, 1));
+	waitStart = j9time_hires_clock();
 	if (oscacheToUse) {
 		rc = oscacheToUse->acquireWriteLock(_commonCCInfo->writeMutexID);
 	} else {
 		rc = omrthread_monitor_enter(_utMutex);
 	}
 	if (rc == 0) {
+		waitMicros = (UDATA)j9time_hires_delta(waitStart, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		if (waitMicros >= CC_WRITE_MUTEX_CONTENDED_WAIT_MICROS) {
+			contended = true;
+		}
+		if (contended) {
+			Trc_SHR_CC_enterWriteMutex_Contended(currentThread, waitMicros, caller);
+		}
 		_commonCCInfo->hasWriteMutexThread = currentThread;
 		if (*_runtimeFlags & J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES) {
 			/*Pass doDecWriteCounter=false b/c exitWriteMutex is being called without updating writerCount*/
@@ -2034,6 +2099,8 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 				doLockCache(currentThread);
 			}
 		}
+	} else {
+		VM_AtomicSupport::subtract(&_commonCCInfo->writeMutexWaiters, 1);
 	}
 	if ((UnitTest::unitTest != UnitTest::COMPOSITE_CACHE_TEST_SKIP_WRITE_COUNTER_UPDATE)
 			&& (true == _started) && (0 == rc)) {
@@ -2042,6 +2109,22 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 
 		this->_commonCCInfo->oldWriterCount = _theca->writerCount;
 		_theca->writerCount += 1;
+		/* The write mutex statistics are shared by every JVM using the cache and are only updated while holding it */
+		_theca->writeMutexAcquireCount += 1;
+		if (waitMicros > (UDATA_MAX - _theca->writeMutexWaitMicros)) {
+			_theca->writeMutexWaitMicros = UDATA_MAX;
+		} else {
+			_theca->writeMutexWaitMicros += waitMicros;
+		}
+		/* Uncontended acquisitions also take some time, which is left out of the average contended wait */
+		if (contended) {
+			_theca->writeMutexContendedCount += 1;
+			if (waitMicros > (UDATA_MAX - _theca->writeMutexContendedWaitMicros)) {
+				_theca->writeMutexContendedWaitMicros = UDATA_MAX;
+			} else {
+				_theca->writeMutexContendedWaitMicros += waitMicros;
+			}
+		}
 		protectHeaderReadWriteArea(currentThread, false);
 	}
 	if (rc == -1) {
@@ -2101,6 +2184,7 @@ SH_CompositeCacheImpl::exitWriteMutex(J9VMThread* currentThread, const char* cal
 	} else {
 		rc = omrthread_monitor_exit(_utMutex);
 	}
+	VM_AtomicSupport::subtract(&_commonCCInfo->writeMutexWaiters, 1);
 	if (0 != rc ) {
 		PORT_ACCESS_FROM_PORT(_portlib);
 		CC_ERR_TRACE1(J9NLS_SHRC_CC_FAILED_EXIT_MUTEX, rc);
@@ -3394,6 +3478,21 @@ SH_CompositeCacheImpl::getCacheHeaderAddress(void)
 	return _theca;
 }
 
+/**
+ * Utility function for finding the address of the OS cache header, which precedes the cache header
+ *
+ * @return Address of the start of the memory the cache is attached at
+ */
+void*
+SH_CompositeCacheImpl::getOSCacheStart(void)
+{
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return NULL;
+	}
+	return _oscache->getOSCacheStart();
+}
+
 /**
  * Utility function for finding the address of the start of the String Table
  * data which is currently the same as the start of the readWrite data.
@@ -3642,6 +3741,401 @@ SH_CompositeCacheImpl::getStringTableBytes(void)
 	return _theca->sharedInternTableBytes;
 }
 
+/**
+ * Lay out an empty class index in the readWrite area of a new cache
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] indexSRP Offset of the class index from the cache header
+ * @param [in] indexBytes Size of the class index, including its J9SharedClassIndexHeader
+ *
+ * Prereq: Cache header and readWrite area should be unprotected - this is only done during initialization
+ */
+void
+SH_CompositeCacheImpl::initClassIndex(J9VMThread* currentThread, UDATA indexSRP, U_32 indexBytes)
+{
+	J9SharedClassIndexHeader* indexHeader = (J9SharedClassIndexHeader*)((BlockPtr)_theca + indexSRP);
+	J9SRPHashTable layout;
+
+	indexHeader->indexedSRP = 0;
+	indexHeader->flags = 0;
+	if (NULL == srpHashTableReset(_portlib, J9_GET_CALLSITE(), &layout, CLASSINDEXTABLE(indexHeader), indexBytes - sizeof(J9SharedClassIndexHeader),
+			sizeof(J9SharedClassIndexEntry), 0, NULL, NULL, NULL, NULL)
+	) {
+		/* The cache is usable without a class index, it is just slower to start */
+		Trc_SHR_CC_initClassIndex_Failed(currentThread, indexSRP, indexBytes);
+		return;
+	}
+	_theca->classIndexSRP = indexSRP;
+	_theca->classIndexBytes = indexBytes;
+	setCacheHeaderExtraFlags(currentThread, J9SHR_EXTRA_FLAGS_CLASS_INDEX);
+	Trc_SHR_CC_initClassIndex_Event(currentThread, indexSRP, indexBytes);
+}
+
+/**
+ * Get the class index of this cache.
+ *
+ * @return The J9SharedClassIndexHeader of the class index, or NULL if the cache was created without one
+ */
+J9SharedClassIndexHeader*
+SH_CompositeCacheImpl::getClassIndexHeader(void)
+{
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return NULL;
+	}
+	/* The header words of the class index were unused in caches created before it */
+	if (J9_ARE_NO_BITS_SET(_theca->extraFlags, J9SHR_EXTRA_FLAGS_CLASS_INDEX) || (0 == _theca->classIndexSRP)) {
+		return NULL;
+	}
+	return (J9SharedClassIndexHeader*)((BlockPtr)_theca + _theca->classIndexSRP);
+}
+
+/**
+ * Get the ShcItemHdr of the first item in this cache which is not yet in the class index.
+ * All items with a ShcItemHdr at a higher address are in the class index.
+ *
+ * THREADING: Can be called without any locks. Index entries are written before the boundary is moved past them.
+ *
+ * @return The boundary of the class index. If there is no class index, nothing is indexed.
+ */
+ShcItemHdr*
+SH_CompositeCacheImpl::getClassIndexBoundary(void)
+{
+	J9SharedClassIndexHeader* indexHeader = getClassIndexHeader();
+	UDATA indexedSRP = 0;
+
+	if (NULL != indexHeader) {
+		indexedSRP = indexHeader->indexedSRP;
+		VM_AtomicSupport::readBarrier();
+	}
+	if (0 == indexedSRP) {
+		return (ShcItemHdr*)CCFIRSTENTRY(_theca);
+	}
+	return (ShcItemHdr*)((BlockPtr)_theca + indexedSRP);
+}
+
+/**
+ * Add the items committed to the cache since the last call to the class index.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] classIndex SRP hashtable recreated over the class index of this cache
+ * @param [in] hashFn Returns the name hash to index an item under, or 0 if the item should not be indexed
+ * @param [in] userData Passed to hashFn
+ *
+ * @return the number of items added to the class index
+ *
+ * THREADING: Must hold the cache write mutex
+ */
+UDATA
+SH_CompositeCacheImpl::updateClassIndex(J9VMThread* currentThread, J9SRPHashTable* classIndex, ClassIndexHashFn hashFn, void* userData)
+{
+	J9SharedClassIndexHeader* indexHeader = getClassIndexHeader();
+	ShcItemHdr* ih = NULL;
+	BlockPtr free = NULL;
+	UDATA added = 0;
+
+	Trc_SHR_Assert_True(hasWriteMutex(currentThread));
+
+	if ((NULL == indexHeader) || _readOnlyOSCache || J9_ARE_ANY_BITS_SET(indexHeader->flags, J9SHR_CLASS_INDEX_FULL)) {
+		return 0;
+	}
+	ih = getClassIndexBoundary();
+	free = UPDATEPTR(_theca);
+	if ((BlockPtr)ih <= free) {
+		return 0;
+	}
+
+	unprotectHeaderReadWriteArea(currentThread, true);
+	while ((BlockPtr)ih > free) {
+		UDATA maxCCItemLen = (((UDATA)ih) - ((UDATA)free)) + sizeof(struct ShcItemHdr);
+		ShcItem* item = NULL;
+		U_32 nameHash = 0;
+
+		if ((CCITEMLEN(ih) <= 0) || (CCITEMLEN(ih) > maxCCItemLen)) {
+			/* Leave reporting the corruption to the metadata walk in next() */
+			break;
+		}
+		item = (ShcItem*)CCITEM(ih);
+		nameHash = hashFn(item, userData);
+		if (0 != nameHash) {
+			J9SharedClassIndexEntry key;
+			J9SharedClassIndexEntry* entry = NULL;
+
+			key.nameHash = nameHash;
+			key.itemOffset = (U_32)((BlockPtr)item - (BlockPtr)_theca);
+			entry = (J9SharedClassIndexEntry*)srpHashTableAdd(classIndex, &key);
+			if (NULL == entry) {
+				/* Items from here on stay out of the class index and are read into the local hashtables at startup */
+				indexHeader->flags |= J9SHR_CLASS_INDEX_FULL;
+				Trc_SHR_CC_updateClassIndex_Full(currentThread, item, added);
+				break;
+			}
+			Trc_SHR_Assert_True(IS_NEW_ELEMENT(entry));
+			UNMARK_NEW_ELEMENT(entry, J9SharedClassIndexEntry*);
+			entry->nameHash = key.nameHash;
+			entry->itemOffset = key.itemOffset;
+			++added;
+		}
+		ih = CCITEMNEXT(ih);
+	}
+	/* Entries must be visible before the boundary moves past their items */
+	VM_AtomicSupport::writeBarrier();
+	indexHeader->indexedSRP = (UDATA)((BlockPtr)ih - (BlockPtr)_theca);
+	protectHeaderReadWriteArea(currentThread, true);
+
+	Trc_SHR_CC_updateClassIndex_Exit(currentThread, added, ih);
+	return added;
+}
+
+/**
+ * Get the startup page map of this cache. The map holds STARTUP_PAGE_MAP_GENERATIONS bitmaps of
+ * getStartupPageMapWords() words, the most recent first. Bit n of a bitmap is set if page n of the
+ * cache, counting from the cache header, was accessed during the startup of the JVM which stored it.
+ *
+ * @return The startup page map, or NULL if the cache was created without one
+ */
+UDATA*
+SH_CompositeCacheImpl::getStartupPageMap(void)
+{
+	if (0 == _theca->startupPageMapSRP) {
+		return NULL;
+	}
+	return (UDATA*)((BlockPtr)_theca + _theca->startupPageMapSRP);
+}
+
+/**
+ * Get the number of words in each generation of the startup page map.
+ */
+UDATA
+SH_CompositeCacheImpl::getStartupPageMapWords(void)
+{
+	return (_theca->startupPageMapBytes / STARTUP_PAGE_MAP_GENERATIONS) / sizeof(UDATA);
+}
+
+/**
+ * Mark the pages of a run about to be read ahead which are not in memory, as these are the
+ * pages the read ahead brings in from the cache file. If their residency can't be queried
+ * no pages are marked, so no faults are claimed to be avoided.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] runStart First page of the run
+ * @param [in] runEnd Page after the end of the run
+ */
+void
+SH_CompositeCacheImpl::markStartupPagesNotResident(J9VMThread* currentThread, UDATA runStart, UDATA runEnd)
+{
+	UDATA pageSize = STARTUP_PAGE_SIZE(_theca->osPageSize);
+	UDATA* pagesPrefetched = _startupPagesTouched + getStartupPageMapWords();
+	U_8 resident[STARTUP_PAGE_RESIDENCY_CHUNK];
+
+	for (UDATA chunk = runStart; chunk < runEnd; chunk += STARTUP_PAGE_RESIDENCY_CHUNK) {
+		UDATA pageCount = OMR_MIN(runEnd - chunk, STARTUP_PAGE_RESIDENCY_CHUNK);
+
+		if (!_oscache->getResidentPages(currentThread, (BlockPtr)_theca + (chunk * pageSize), pageSize, pageCount, resident)) {
+			return;
+		}
+		for (UDATA i = 0; i < pageCount; i++) {
+			if (0 == resident[i]) {
+				UDATA page = chunk + i;
+
+				pagesPrefetched[page / STARTUP_PAGE_MAP_BITS_PER_WORD] |= (UDATA)1 << (page % STARTUP_PAGE_MAP_BITS_PER_WORD);
+				_startupPagesReadAhead += 1;
+			}
+		}
+	}
+}
+
+/**
+ * Advise the OS to read ahead the pages that the last JVMs accessed during startup, and the
+ * metadata, which is walked at startup. Cache pages are then read with a few large I/Os
+ * rather than faulted in one at a time from a cold page cache.
+ * The startup pages which were not in memory before the read ahead are recorded, and the
+ * pages accessed during the startup of this JVM are recorded from here on.
+ *
+ * @param [in] currentThread The current thread
+ */
+void
+SH_CompositeCacheImpl::readAheadStartupPages(J9VMThread* currentThread)
+{
+	UDATA* pageMap = getStartupPageMap();
+	UDATA words = 0;
+	UDATA pageSize = STARTUP_PAGE_SIZE(_theca->osPageSize);
+	UDATA pageCount = 0;
+	UDATA runStart = 0;
+	bool inRun = false;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((NULL == _oscache) || (NULL == pageMap) || (NULL != _startupPagesTouched)) {
+		return;
+	}
+
+	/* The pages touched by this JVM are followed by the pages it read ahead which were not in memory */
+	words = getStartupPageMapWords();
+	_startupPagesTouched = (UDATA*)j9mem_allocate_memory(words * sizeof(UDATA) * 2, J9MEM_CATEGORY_CLASSES);
+	if (NULL == _startupPagesTouched) {
+		return;
+	}
+	memset(_startupPagesTouched, 0, words * sizeof(UDATA) * 2);
+
+	pageCount = OMR_MIN((_theca->totalBytes + pageSize - 1) / pageSize, words * STARTUP_PAGE_MAP_BITS_PER_WORD);
+	for (UDATA page = 0; page <= pageCount; page++) {
+		bool wasTouched = false;
+
+		if (page < pageCount) {
+			UDATA bit = (UDATA)1 << (page % STARTUP_PAGE_MAP_BITS_PER_WORD);
+
+			for (UDATA generation = 0; generation < STARTUP_PAGE_MAP_GENERATIONS; generation++) {
+				if (J9_ARE_ANY_BITS_SET(pageMap[(generation * words) + (page / STARTUP_PAGE_MAP_BITS_PER_WORD)], bit)) {
+					wasTouched = true;
+					break;
+				}
+			}
+		}
+
+		if (wasTouched) {
+			if (!inRun) {
+				runStart = page;
+				inRun = true;
+			}
+		} else if (inRun) {
+			BlockPtr start = (BlockPtr)_theca + (runStart * pageSize);
+			BlockPtr end = OMR_MIN((BlockPtr)_theca + (page * pageSize), CAEND(_theca));
+
+			/* Check the residency first, the read ahead may complete before madvise() returns */
+			markStartupPagesNotResident(currentThread, runStart, page);
+			_oscache->willNeed(currentThread, start, (size_t)(end - start));
+			inRun = false;
+		}
+	}
+
+	/* Read the metadata last, so that it does not hide which startup pages were already in memory */
+	_oscache->willNeed(currentThread, UPDATEPTR(_theca), (size_t)(CAEND(_theca) - UPDATEPTR(_theca)));
+
+	Trc_SHR_CC_readAheadStartupPages_Event(currentThread, _startupPagesReadAhead, pageSize);
+}
+
+/**
+ * Record that a ROMClass or AOT method in this cache was accessed during startup.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] address Start of the data accessed
+ * @param [in] length Length of the data accessed
+ *
+ * @return true if the address is in this cache, false otherwise
+ */
+bool
+SH_CompositeCacheImpl::recordStartupAccess(J9VMThread* currentThread, const void* address, UDATA length)
+{
+	UDATA* pagesTouched = _startupPagesTouched;
+	UDATA pageSize = 0;
+	UDATA page = 0;
+	UDATA lastPage = 0;
+
+	if (!isAddressInCache(address)) {
+		return false;
+	}
+	if ((NULL == pagesTouched) || _startupPagesStored || (0 == length)) {
+		return true;
+	}
+
+	pageSize = STARTUP_PAGE_SIZE(_theca->osPageSize);
+	page = ((UDATA)address - (UDATA)_theca) / pageSize;
+	lastPage = OMR_MIN((((UDATA)address + length - 1) - (UDATA)_theca) / pageSize, (getStartupPageMapWords() * STARTUP_PAGE_MAP_BITS_PER_WORD) - 1);
+	for (; page <= lastPage; page++) {
+		uintptr_t* word = (uintptr_t*)&pagesTouched[page / STARTUP_PAGE_MAP_BITS_PER_WORD];
+		uintptr_t bit = (uintptr_t)1 << (page % STARTUP_PAGE_MAP_BITS_PER_WORD);
+		uintptr_t oldValue = *word;
+
+		/* Other threads may be setting bits in the same word */
+		while (J9_ARE_NO_BITS_SET(oldValue, bit)) {
+			uintptr_t currentValue = compareAndSwapUDATA(word, oldValue, oldValue | bit);
+
+			if (currentValue == oldValue) {
+				break;
+			}
+			oldValue = currentValue;
+		}
+	}
+	return true;
+}
+
+/**
+ * Store the pages accessed during the startup of this JVM as the most recent generation of the
+ * startup page map of the cache, so that they are read ahead by later JVMs. The oldest generation
+ * is dropped, so pages which are no longer accessed at startup stop being read ahead once the
+ * application or the cache contents change. Recording stops when this is called.
+ *
+ * @param [in] currentThread The current thread
+ */
+void
+SH_CompositeCacheImpl::storeStartupPages(J9VMThread* currentThread)
+{
+	UDATA* pageMap = getStartupPageMap();
+	UDATA words = 0;
+
+	if ((NULL == pageMap) || (NULL == _startupPagesTouched) || _startupPagesStored) {
+		return;
+	}
+	/* Freeze the stats before the page map changes */
+	getStartupPageStats(&_startupPagesReadAhead, &_startupPagesTouchedCount, &_startupPagesTouchedReadAhead);
+	_startupPagesStored = true;
+
+	if (isRunningReadOnly() || (0 == _startupPagesTouchedCount)) {
+		return;
+	}
+	if (0 != enterWriteMutex(currentThread, false, "storeStartupPages")) {
+		return;
+	}
+	words = getStartupPageMapWords();
+	unprotectHeaderReadWriteArea(currentThread, true);
+	memmove(pageMap + words, pageMap, (STARTUP_PAGE_MAP_GENERATIONS - 1) * words * sizeof(UDATA));
+	memcpy(pageMap, _startupPagesTouched, words * sizeof(UDATA));
+	protectHeaderReadWriteArea(currentThread, true);
+	exitWriteMutex(currentThread, "storeStartupPages");
+
+	Trc_SHR_CC_storeStartupPages_Event(currentThread, _startupPagesTouchedCount, _startupPagesTouchedReadAhead);
+}
+
+/**
+ * Get the startup page statistics of this JVM.
+ *
+ * @param [out] pagesReadAhead Pages read ahead from the cache file because previous JVMs accessed them
+ * during startup. Pages which were already in memory are not counted.
+ * @param [out] pagesTouched Pages accessed during the startup of this JVM
+ * @param [out] pagesTouchedReadAhead Pages accessed during the startup of this JVM which were read ahead
+ * from the cache file. Each of these is a major fault avoided, unless the page was evicted again before
+ * it was accessed.
+ */
+void
+SH_CompositeCacheImpl::getStartupPageStats(UDATA* pagesReadAhead, UDATA* pagesTouched, UDATA* pagesTouchedReadAhead)
+{
+	UDATA* pageMap = getStartupPageMap();
+	UDATA words = 0;
+	UDATA touched = 0;
+	UDATA touchedReadAhead = 0;
+
+	*pagesReadAhead = _startupPagesReadAhead;
+	if (_startupPagesStored || (NULL == pageMap) || (NULL == _startupPagesTouched)) {
+		*pagesTouched = _startupPagesTouchedCount;
+		*pagesTouchedReadAhead = _startupPagesTouchedReadAhead;
+		return;
+	}
+	words = getStartupPageMapWords();
+	for (UDATA i = 0; i < words; i++) {
+		UDATA word = _startupPagesTouched[i];
+		UDATA readAheadWord = word & _startupPagesTouched[words + i];
+
+		for (; 0 != word; word &= word - 1) {
+			touched += 1;
+		}
+		for (; 0 != readAheadWord; readAheadWord &= readAheadWord - 1) {
+			touchedReadAhead += 1;
+		}
+	}
+	*pagesTouched = touched;
+	*pagesTouchedReadAhead = touchedReadAhead;
+}
+
 /**
  * Get the number of free bytes in the shared classes cache between segmentSRP and updateSRP
  *
@@ -4679,6 +5173,10 @@ SH_CompositeCacheImpl::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDe
 		descriptor->minJIT = _theca->minJIT;
 		descriptor->maxJIT = _theca->maxJIT;
 		descriptor->softMaxBytes = (UDATA)((U_32)-1 == _theca->softMaxBytes ? descriptor->cacheSize : _theca->softMaxBytes);
+		descriptor->writeMutexAcquireCount = _theca->writeMutexAcquireCount;
+		descriptor->writeMutexContendedCount = _theca->writeMutexContendedCount;
+		descriptor->writeMutexWaitMicros = _theca->writeMutexWaitMicros;
+		descriptor->writeMutexContendedWaitMicros = _theca->writeMutexContendedWaitMicros;
 
 		if ((NULL != _debugData) && !_debugData->getJavacoreData(vm, descriptor, _theca)) {
 			return 0;
@@ -165,6 +165,8 @@ public:
 	void* getBaseAddress(void);
 
 	J9SharedCacheHeader* getCacheHeaderAddress(void);
+
+	void* getOSCacheStart(void);
 	
 	void* getStringTableBase(void);
 	
@@ -219,6 +221,14 @@ public:
 	UDATA getReadWriteBytes(void);
 	
 	UDATA getStringTableBytes(void);
+
+	typedef U_32 (*ClassIndexHashFn)(const ShcItem* item, void* userData);
+
+	J9SharedClassIndexHeader* getClassIndexHeader(void);
+
+	ShcItemHdr* getClassIndexBoundary(void);
+
+	UDATA updateClassIndex(J9VMThread* currentThread, J9SRPHashTable* classIndex, ClassIndexHashFn hashFn, void* userData);
 	
 	UDATA testAndSetWriteHash(J9VMThread *currentThread, UDATA hash);
 
@@ -430,6 +440,12 @@ public:
 
 	bool isAddressInReleasedMetaDataBounds(J9VMThread* currentThread, UDATA metadataAddress) const;
 
+	bool recordStartupAccess(J9VMThread* currentThread, const void* address, UDATA length);
+
+	void storeStartupPages(J9VMThread* currentThread);
+
+	void getStartupPageStats(UDATA* pagesReadAhead, UDATA* pagesTouched, UDATA* pagesTouchedReadAhead);
+
 	const char* getCacheUniqueID(J9VMThread* currentThread) const;
 
 	const char* getCacheName(void) const;
@@ -535,6 +551,18 @@ private:
 	UDATA  _minimumAccessedShrCacheMetadata;
 
 	UDATA _maximumAccessedShrCacheMetadata;
+
+	/* Pages of the cache accessed during startup, in the same format as a generation of the startup page map in the cache,
+	 * followed by the pages read ahead which were not in memory */
+	UDATA* _startupPagesTouched;
+
+	UDATA _startupPagesReadAhead;
+
+	UDATA _startupPagesTouchedCount;
+
+	UDATA _startupPagesTouchedReadAhead;
+
+	bool _startupPagesStored;
 	
 	I_8 _layer;
 
@@ -604,6 +632,16 @@ private:
 #endif
 	void setCacheAreaBoundaries(J9VMThread* currentThread, J9SharedClassPreinitConfig* piConfig);
 
+	void initClassIndex(J9VMThread* currentThread, UDATA indexSRP, U_32 indexBytes);
+
+	void readAheadStartupPages(J9VMThread* currentThread);
+
+	UDATA* getStartupPageMap(void);
+
+	UDATA getStartupPageMapWords(void);
+
+	void markStartupPagesNotResident(J9VMThread* currentThread, UDATA runStart, UDATA runEnd);
+
 	void notifyPagesRead(BlockPtr start, BlockPtr end, UDATA expectedDirection, bool protect);
 	void notifyPagesCommitted(BlockPtr start, BlockPtr end, UDATA expectedDirection);
 
@@ -663,6 +701,7 @@ private:
 	friend IDATA testProtectSharedCacheData_test2(J9JavaVM* vm);
 	friend IDATA testProtectSharedCacheData_test3(J9JavaVM* vm);
 	friend class OpenCacheHelper;
+	friend class CompositeCacheTest;
 };
 
 #endif /* !defined(COMPOSITECACHEIMPL_H_INCLUDED) */
@@ -0,0 +1,798 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * The heap archive keeps the values of the "archived" static fields of bootstrap classes in the shared cache.
+ *
+ * JDK classes such as java.lang.Integer$IntegerCache call VM.initializeFromArchive() from their static initializer
+ * and only compute the value of their archived static fields if they are still null afterwards. The first JVM to
+ * initialize such a class records the values of those fields when the static initializer completes, and later JVMs
+ * recreate the objects from the cache instead of running the computation.
+ *
+ * Only a safe subset of objects is archived: Strings (which are interned when recreated), Byte, Short, Character,
+ * Integer and Long objects, and one dimensional arrays of them. A class is not archived if any archived field
+ * refers to another kind of object. The objects are recreated in the heap rather than mapped, so references
+ * are stored as indices into the record and need no relocation when the heap is at a different address.
+ *
+ * The heap archive is only used with -Xshareclasses:heapArchive.
+ */
+
+#include "shrinit.h"
+#include "CacheMap.hpp"
+#include "hashtable_api.h"
+#include "pool_api.h"
+#include "util_api.h"
+#include "ut_j9shr.h"
+#include <string.h>
+
+#define HEAP_ARCHIVE_FIELD_PREFIX "archived"
+
+/* Tags of the objects in a heap archive record */
+#define HEAP_ARCHIVE_TAG_OBJECT 0
+#define HEAP_ARCHIVE_TAG_STRING 1
+#define HEAP_ARCHIVE_TAG_BYTE 2
+#define HEAP_ARCHIVE_TAG_SHORT 3
+#define HEAP_ARCHIVE_TAG_CHARACTER 4
+#define HEAP_ARCHIVE_TAG_INTEGER 5
+#define HEAP_ARCHIVE_TAG_LONG 6
+#define HEAP_ARCHIVE_TAG_ARRAY 7
+#define HEAP_ARCHIVE_TAG_MAX_LEAF HEAP_ARCHIVE_TAG_LONG
+
+/* Limit on the number of objects archived for one class */
+#define HEAP_ARCHIVE_MAX_OBJECTS 65536
+
+#define HEAP_ARCHIVE_WORDS(bytes) (((bytes) + sizeof(U_32) - 1) / sizeof(U_32))
+
+typedef struct HeapArchiveObjectIndex {
+	j9object_t object;
+	U_32 index;
+} HeapArchiveObjectIndex;
+
+typedef struct HeapArchiveWriter {
+	J9VMThread* currentThread;
+	U_32* data;
+	UDATA length;
+	UDATA capacity;
+	J9HashTable* objectIndices;
+	U_32 objectCount;
+	bool failed;
+} HeapArchiveWriter;
+
+typedef struct HeapArchiveReader {
+	const U_32* cursor;
+	const U_32* end;
+	bool failed;
+} HeapArchiveReader;
+
+static J9Class* heapArchiveClassForTag(J9JavaVM* vm, U_32 tag);
+static U_32 heapArchiveTagForClass(J9JavaVM* vm, J9Class* clazz);
+static bool isArchivedField(J9ROMFieldShape* field);
+static J9UTF8* getHeapArchiveKey(J9ROMClass* romClass);
+static void writeWords(HeapArchiveWriter* writer, const U_32* words, UDATA count);
+static void writeBytes(HeapArchiveWriter* writer, const U_8* bytes, U_32 length);
+static U_32 writeLeafObject(HeapArchiveWriter* writer, j9object_t object, U_32 tag);
+static U_32 writeObject(HeapArchiveWriter* writer, j9object_t object);
+static bool readWords(HeapArchiveReader* reader, U_32* words, UDATA count);
+static const U_8* readBytes(HeapArchiveReader* reader, U_32* length);
+static j9object_t readObject(J9VMThread* currentThread, HeapArchiveReader* reader, jobject objectsRef, U_32 objectCount);
+static bool storeHeapArchive(J9VMThread* currentThread, J9Class* clazz);
+static bool removeHeapArchivePending(J9SharedClassConfig* config, J9Class* clazz);
+static UDATA heapArchiveObjectHashFn(void* entry, void* userData);
+static UDATA heapArchiveObjectHashEqualFn(void* left, void* right, void* userData);
+
+static J9Class*
+heapArchiveClassForTag(J9JavaVM* vm, U_32 tag)
+{
+	J9Class* clazz = NULL;
+
+	switch (tag) {
+	case HEAP_ARCHIVE_TAG_OBJECT:
+		clazz = J9VMJAVALANGOBJECT_OR_NULL(vm);
+		break;
+	case HEAP_ARCHIVE_TAG_STRING:
+		clazz = J9VMJAVALANGSTRING_OR_NULL(vm);
+		break;
+	case HEAP_ARCHIVE_TAG_BYTE:
+		clazz = J9VMJAVALANGBYTE_OR_NULL(vm);
+		break;
+	case HEAP_ARCHIVE_TAG_SHORT:
+		clazz = J9VMJAVALANGSHORT_OR_NULL(vm);
+		break;
+	case HEAP_ARCHIVE_TAG_CHARACTER:
+		clazz = J9VMJAVALANGCHARACTER_OR_NULL(vm);
+		break;
+	case HEAP_ARCHIVE_TAG_INTEGER:
+		clazz = J9VMJAVALANGINTEGER_OR_NULL(vm);
+		break;
+	case HEAP_ARCHIVE_TAG_LONG:
+		clazz = J9VMJAVALANGLONG_OR_NULL(vm);
+		break;
+	default:
+		break;
+	}
+	return clazz;
+}
+
+/* Returns the tag of an archivable non-array class or of java.lang.Object, or HEAP_ARCHIVE_TAG_ARRAY if clazz cannot be archived */
+static U_32
+heapArchiveTagForClass(J9JavaVM* vm, J9Class* clazz)
+{
+	for (U_32 tag = HEAP_ARCHIVE_TAG_OBJECT; tag <= HEAP_ARCHIVE_TAG_MAX_LEAF; tag++) {
+		if ((NULL != clazz) && (heapArchiveClassForTag(vm, tag) == clazz)) {
+			return tag;
+		}
+	}
+	return HEAP_ARCHIVE_TAG_ARRAY;
+}
+
+static bool
+isArchivedField(J9ROMFieldShape* field)
+{
+	J9UTF8* name = J9ROMFIELDSHAPE_NAME(field);
+	J9UTF8* signature = J9ROMFIELDSHAPE_SIGNATURE(field);
+	U_8 firstChar = J9UTF8_DATA(signature)[0];
+
+	return J9_ARE_ALL_BITS_SET(field->modifiers, J9AccStatic)
+		&& (('L' == firstChar) || ('[' == firstChar))
+		&& (J9UTF8_LENGTH(name) > LITERAL_STRLEN(HEAP_ARCHIVE_FIELD_PREFIX))
+		&& (0 == memcmp(J9UTF8_DATA(name), HEAP_ARCHIVE_FIELD_PREFIX, LITERAL_STRLEN(HEAP_ARCHIVE_FIELD_PREFIX)));
+}
+
+static J9UTF8*
+getHeapArchiveKey(J9ROMClass* romClass)
+{
+	return J9ROMCLASS_CLASSNAME(romClass);
+}
+
+static void
+writeWords(HeapArchiveWriter* writer, const U_32* words, UDATA count)
+{
+	if (writer->failed) {
+		return;
+	}
+	if ((writer->length + count) > writer->capacity) {
+		PORT_ACCESS_FROM_VMC(writer->currentThread);
+		UDATA newCapacity = OMR_MAX(writer->capacity * 2, writer->length + count);
+		U_32* newData = (U_32*)j9mem_allocate_memory(newCapacity * sizeof(U_32), J9MEM_CATEGORY_CLASSES);
+
+		if (NULL == newData) {
+			writer->failed = true;
+			return;
+		}
+		if (NULL != writer->data) {
+			memcpy(newData, writer->data, writer->length * sizeof(U_32));
+			j9mem_free_memory(writer->data);
+		}
+		writer->data = newData;
+		writer->capacity = newCapacity;
+	}
+	memcpy(writer->data + writer->length, words, count * sizeof(U_32));
+	writer->length += count;
+}
+
+static void
+writeBytes(HeapArchiveWriter* writer, const U_8* bytes, U_32 length)
+{
+	UDATA words = HEAP_ARCHIVE_WORDS(length);
+
+	writeWords(writer, &length, 1);
+	if (!writer->failed && (0 != words)) {
+		/* Reserve the padded space first, then copy the bytes over it */
+		U_32 zero = 0;
+		UDATA start = writer->length;
+
+		for (UDATA i = 0; i < words; i++) {
+			writeWords(writer, &zero, 1);
+		}
+		if (!writer->failed) {
+			memcpy(writer->data + start, bytes, length);
+		}
+	}
+}
+
+/* Writes a String or boxed primitive and returns its index in the record */
+static U_32
+writeLeafObject(HeapArchiveWriter* writer, j9object_t object, U_32 tag)
+{
+	J9VMThread* currentThread = writer->currentThread;
+	J9JavaVM* vm = currentThread->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	writeWords(writer, &tag, 1);
+	switch (tag) {
+	case HEAP_ARCHIVE_TAG_STRING:
+	{
+		UDATA utf8Length = (UDATA)vm->internalVMFunctions->getStringUTF8Length(currentThread, object);
+		U_8* utf8 = (U_8*)j9mem_allocate_memory(utf8Length + 1, J9MEM_CATEGORY_CLASSES);
+
+		if (NULL == utf8) {
+			writer->failed = true;
+			break;
+		}
+		vm->internalVMFunctions->copyStringToUTF8Helper(currentThread, object, J9_STR_NULL_TERMINATE_RESULT, 0, J9VMJAVALANGSTRING_LENGTH(currentThread, object), utf8, utf8Length + 1);
+		writeBytes(writer, utf8, (U_32)utf8Length);
+		j9mem_free_memory(utf8);
+		break;
+	}
+	case HEAP_ARCHIVE_TAG_BYTE:
+	{
+		U_32 value = (U_32)(I_32)J9VMJAVALANGBYTE_VALUE(currentThread, object);
+		writeWords(writer, &value, 1);
+		break;
+	}
+	case HEAP_ARCHIVE_TAG_SHORT:
+	{
+		U_32 value = (U_32)(I_32)J9VMJAVALANGSHORT_VALUE(currentThread, object);
+		writeWords(writer, &value, 1);
+		break;
+	}
+	case HEAP_ARCHIVE_TAG_CHARACTER:
+	{
+		U_32 value = (U_32)J9VMJAVALANGCHARACTER_VALUE(currentThread, object);
+		writeWords(writer, &value, 1);
+		break;
+	}
+	case HEAP_ARCHIVE_TAG_INTEGER:
+	{
+		U_32 value = (U_32)J9VMJAVALANGINTEGER_VALUE(currentThread, object);
+		writeWords(writer, &value, 1);
+		break;
+	}
+	case HEAP_ARCHIVE_TAG_LONG:
+	{
+		U_64 value = (U_64)J9VMJAVALANGLONG_VALUE(currentThread, object);
+		U_32 words[2];
+
+		words[0] = (U_32)value;
+		words[1] = (U_32)(value >> 32);
+		writeWords(writer, words, 2);
+		break;
+	}
+	default:
+		writer->failed = true;
+		break;
+	}
+	writer->objectCount += 1;
+	return writer->objectCount;
+}
+
+/* Writes object, and the objects it refers to before it, and returns its index in the record, 0 for null.
+ * An object which is referred to more than once is only written once.
+ * THREADING: The caller must have VM access. No objects are allocated so the objects do not move. */
+static U_32
+writeObject(HeapArchiveWriter* writer, j9object_t object)
+{
+	J9VMThread* currentThread = writer->currentThread;
+	J9JavaVM* vm = currentThread->javaVM;
+	HeapArchiveObjectIndex entry;
+	HeapArchiveObjectIndex* found = NULL;
+	J9Class* clazz = NULL;
+	U_32 tag = 0;
+	U_32 index = 0;
+
+	if ((NULL == object) || writer->failed) {
+		return 0;
+	}
+	entry.object = object;
+	found = (HeapArchiveObjectIndex*)hashTableFind(writer->objectIndices, &entry);
+	if (NULL != found) {
+		return found->index;
+	}
+	if (writer->objectCount >= HEAP_ARCHIVE_MAX_OBJECTS) {
+		writer->failed = true;
+		return 0;
+	}
+
+	clazz = J9OBJECT_CLAZZ(currentThread, object);
+	if (J9ROMCLASS_IS_ARRAY(clazz->romClass)) {
+		J9ArrayClass* arrayClass = (J9ArrayClass*)clazz;
+		U_32 componentTag = heapArchiveTagForClass(vm, arrayClass->componentType);
+		U_32 length = J9INDEXABLEOBJECT_SIZE(currentThread, object);
+		U_32* elements = NULL;
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+		/* Only one dimensional arrays of archivable objects, or of java.lang.Object, are archived */
+		if ((HEAP_ARCHIVE_TAG_ARRAY == componentTag) || (1 != arrayClass->arity)) {
+			Trc_SHR_HA_writeObject_NotArchivable(currentThread, J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(clazz->romClass)), J9UTF8_DATA(J9ROMCLASS_CLASSNAME(clazz->romClass)));
+			writer->failed = true;
+			return 0;
+		}
+		if (0 != length) {
+			elements = (U_32*)j9mem_allocate_memory(length * sizeof(U_32), J9MEM_CATEGORY_CLASSES);
+			if (NULL == elements) {
+				writer->failed = true;
+				return 0;
+			}
+		}
+		for (U_32 i = 0; (i < length) && !writer->failed; i++) {
+			j9object_t element = J9JAVAARRAYOFOBJECT_LOAD(currentThread, object, i);
+
+			if ((NULL != element) && J9ROMCLASS_IS_ARRAY(J9OBJECT_CLAZZ(currentThread, element)->romClass)) {
+				writer->failed = true;
+			} else {
+				elements[i] = writeObject(writer, element);
+			}
+		}
+		if (!writer->failed) {
+			U_32 header[3];
+
+			header[0] = HEAP_ARCHIVE_TAG_ARRAY;
+			header[1] = componentTag;
+			header[2] = length;
+			writeWords(writer, header, 3);
+			if (0 != length) {
+				writeWords(writer, elements, length);
+			}
+			writer->objectCount += 1;
+			index = writer->objectCount;
+		}
+		if (NULL != elements) {
+			j9mem_free_memory(elements);
+		}
+	} else {
+		tag = heapArchiveTagForClass(vm, clazz);
+		if ((HEAP_ARCHIVE_TAG_OBJECT == tag) || (HEAP_ARCHIVE_TAG_ARRAY == tag)) {
+			Trc_SHR_HA_writeObject_NotArchivable(currentThread, J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(clazz->romClass)), J9UTF8_DATA(J9ROMCLASS_CLASSNAME(clazz->romClass)));
+			writer->failed = true;
+			return 0;
+		}
+		index = writeLeafObject(writer, object, tag);
+	}
+
+	if (!writer->failed) {
+		entry.index = index;
+		if (NULL == hashTableAdd(writer->objectIndices, &entry)) {
+			writer->failed = true;
+		}
+	}
+	return index;
+}
+
+static bool
+readWords(HeapArchiveReader* reader, U_32* words, UDATA count)
+{
+	if (reader->failed || ((UDATA)(reader->end - reader->cursor) < count)) {
+		reader->failed = true;
+		return false;
+	}
+	memcpy(words, reader->cursor, count * sizeof(U_32));
+	reader->cursor += count;
+	return true;
+}
+
+static const U_8*
+readBytes(HeapArchiveReader* reader, U_32* length)
+{
+	const U_8* bytes = NULL;
+
+	if (readWords(reader, length, 1)) {
+		UDATA words = HEAP_ARCHIVE_WORDS(*length);
+
+		if ((UDATA)(reader->end - reader->cursor) < words) {
+			reader->failed = true;
+		} else {
+			bytes = (const U_8*)reader->cursor;
+			reader->cursor += words;
+		}
+	}
+	return bytes;
+}
+
+/* Recreates the next object in the record. The objects created so far are held in the Object[] referred to by objectsRef,
+ * which keeps them alive across the allocations.
+ * THREADING: The caller must have VM access */
+static j9object_t
+readObject(J9VMThread* currentThread, HeapArchiveReader* reader, jobject objectsRef, U_32 objectCount)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	J9MemoryManagerFunctions* mmFuncs = vm->memoryManagerFunctions;
+	j9object_t object = NULL;
+	U_32 tag = 0;
+
+	if (!readWords(reader, &tag, 1)) {
+		return NULL;
+	}
+	switch (tag) {
+	case HEAP_ARCHIVE_TAG_STRING:
+	{
+		U_32 length = 0;
+		const U_8* utf8 = readBytes(reader, &length);
+
+		if (NULL != utf8) {
+			object = mmFuncs->j9gc_createJavaLangString(currentThread, (U_8*)utf8, length, J9_STR_INTERN);
+		}
+		break;
+	}
+	case HEAP_ARCHIVE_TAG_BYTE:
+	case HEAP_ARCHIVE_TAG_SHORT:
+	case HEAP_ARCHIVE_TAG_CHARACTER:
+	case HEAP_ARCHIVE_TAG_INTEGER:
+	case HEAP_ARCHIVE_TAG_LONG:
+	{
+		U_32 words[2] = {0, 0};
+
+		if (readWords(reader, words, (HEAP_ARCHIVE_TAG_LONG == tag) ? 2 : 1)) {
+			object = mmFuncs->J9AllocateObject(currentThread, heapArchiveClassForTag(vm, tag), J9_GC_ALLOCATE_OBJECT_TENURED | J9_GC_ALLOCATE_OBJECT_NON_INSTRUMENTABLE);
+		}
+		if (NULL != object) {
+			switch (tag) {
+			case HEAP_ARCHIVE_TAG_BYTE:
+				J9VMJAVALANGBYTE_SET_VALUE(currentThread, object, (I_32)words[0]);
+				break;
+			case HEAP_ARCHIVE_TAG_SHORT:
+				J9VMJAVALANGSHORT_SET_VALUE(currentThread, object, (I_32)words[0]);
+				break;
+			case HEAP_ARCHIVE_TAG_CHARACTER:
+				J9VMJAVALANGCHARACTER_SET_VALUE(currentThread, object, words[0]);
+				break;
+			case HEAP_ARCHIVE_TAG_INTEGER:
+				J9VMJAVALANGINTEGER_SET_VALUE(currentThread, object, (I_32)words[0]);
+				break;
+			default:
+				J9VMJAVALANGLONG_SET_VALUE(currentThread, object, (I_64)(((U_64)words[1] << 32) | words[0]));
+				break;
+			}
+		}
+		break;
+	}
+	case HEAP_ARCHIVE_TAG_ARRAY:
+	{
+		U_32 header[2] = {0, 0};
+
+		if (readWords(reader, header, 2)) {
+			J9Class* componentClass = heapArchiveClassForTag(vm, header[0]);
+			J9Class* arrayClass = (NULL == componentClass) ? NULL : componentClass->arrayClass;
+			U_32 length = header[1];
+
+			if ((NULL == arrayClass) || ((UDATA)(reader->end - reader->cursor) < length)) {
+				reader->failed = true;
+				break;
+			}
+			object = mmFuncs->J9AllocateIndexableObject(currentThread, arrayClass, length, J9_GC_ALLOCATE_OBJECT_TENURED | J9_GC_ALLOCATE_OBJECT_NON_INSTRUMENTABLE);
+			if (NULL != object) {
+				j9object_t objects = J9_JNI_UNWRAP_REFERENCE(objectsRef);
+
+				for (U_32 i = 0; i < length; i++) {
+					U_32 elementIndex = reader->cursor[i];
+
+					/* Elements are always written before the array which refers to them */
+					if (elementIndex > objectCount) {
+						reader->failed = true;
+						break;
+					}
+					if (0 != elementIndex) {
+						j9object_t element = J9JAVAARRAYOFOBJECT_LOAD(currentThread, objects, elementIndex - 1);
+
+						if ((NULL == element) || !instanceOfOrCheckCast(J9OBJECT_CLAZZ(currentThread, element), componentClass)) {
+							reader->failed = true;
+							break;
+						}
+						J9JAVAARRAYOFOBJECT_STORE(currentThread, object, i, element);
+					}
+				}
+				reader->cursor += length;
+			}
+		}
+		break;
+	}
+	default:
+		reader->failed = true;
+		break;
+	}
+	if (reader->failed) {
+		object = NULL;
+	}
+	return object;
+}
+
+/**
+ * Sets the archived static fields of a bootstrap class from the heap archive record in the shared cache.
+ * Called from the static initializer of the class through VM.initializeFromArchive(). If there is no record
+ * the class is remembered, and its archived fields are stored in the cache when its initialization completes.
+ * Fields which cannot be restored are left null so that the static initializer computes them.
+ *
+ * THREADING: The caller must have VM access and be running a JNI native, as JNI local references are used
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] clazz The class being initialized
+ */
+void
+j9shr_initializeFromHeapArchive(J9VMThread* currentThread, J9Class* clazz)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	J9SharedClassConfig* config = vm->sharedClassConfig;
+	SH_CacheMap* cm = (SH_CacheMap*)config->sharedClassCache;
+	J9ROMClass* romClass = clazz->romClass;
+	J9UTF8* key = getHeapArchiveKey(romClass);
+	J9SharedDataDescriptor descriptor;
+	J9ShrOffset romClassOffset;
+	IDATA found = 0;
+
+	Trc_SHR_HA_initializeFromHeapArchive_Entry(currentThread, J9UTF8_LENGTH(key), J9UTF8_DATA(key));
+
+	memset(&romClassOffset, 0, sizeof(romClassOffset));
+	/* Only bootstrap classes whose ROMClass is in the cache are archived, so the record always matches the class */
+	if ((clazz->classLoader != vm->systemClassLoader)
+		|| (NULL == cm)
+		|| !cm->getROMClassOffset(romClass, &romClassOffset)
+	) {
+		Trc_SHR_HA_initializeFromHeapArchive_Exit_NotArchivable(currentThread);
+		return;
+	}
+
+	memset(&descriptor, 0, sizeof(descriptor));
+	found = config->findSharedData(currentThread, (const char*)J9UTF8_DATA(key), J9UTF8_LENGTH(key), J9SHR_DATA_TYPE_HEAPARCHIVE, FALSE, &descriptor, NULL);
+	if ((found > 0) && (sizeof(J9SharedHeapArchiveHeader) <= descriptor.length)) {
+		J9SharedHeapArchiveHeader header;
+		HeapArchiveReader reader;
+
+		memcpy(&header, descriptor.address, sizeof(header));
+		reader.cursor = (const U_32*)(descriptor.address + sizeof(header));
+		reader.end = (const U_32*)(descriptor.address + descriptor.length);
+		reader.failed = false;
+
+		if ((0 == memcmp(&header.romClassOffset, &romClassOffset, sizeof(romClassOffset)))
+			&& (header.objectCount <= HEAP_ARCHIVE_MAX_OBJECTS)
+		) {
+			J9InternalVMFunctions* vmFuncs = vm->internalVMFunctions;
+			J9Class* objectArrayClass = J9VMJAVALANGOBJECT_OR_NULL(vm)->arrayClass;
+			j9object_t objects = vm->memoryManagerFunctions->J9AllocateIndexableObject(currentThread, objectArrayClass, header.objectCount, J9_GC_ALLOCATE_OBJECT_NON_INSTRUMENTABLE);
+			jobject objectsRef = NULL;
+
+			/* On failure the static initializer computes the values instead */
+			if (NULL == objects) {
+				Trc_SHR_HA_initializeFromHeapArchive_Exit_Failed(currentThread);
+				return;
+			}
+			objectsRef = vmFuncs->j9jni_createLocalRef((JNIEnv*)currentThread, objects);
+			if (NULL == objectsRef) {
+				Trc_SHR_HA_initializeFromHeapArchive_Exit_Failed(currentThread);
+				return;
+			}
+
+			for (U_32 i = 0; (i < header.objectCount) && !reader.failed; i++) {
+				j9object_t object = readObject(currentThread, &reader, objectsRef, i);
+
+				if (NULL == object) {
+					reader.failed = true;
+				} else {
+					J9JAVAARRAYOFOBJECT_STORE(currentThread, J9_JNI_UNWRAP_REFERENCE(objectsRef), i, object);
+				}
+			}
+			if (NULL != currentThread->currentException) {
+				vmFuncs->j9jni_deleteLocalRef((JNIEnv*)currentThread, objectsRef);
+				currentThread->currentException = NULL;
+				Trc_SHR_HA_initializeFromHeapArchive_Exit_Failed(currentThread);
+				return;
+			}
+
+			for (U_32 i = 0; (i < header.fieldCount) && !reader.failed; i++) {
+				U_32 nameLength = 0;
+				U_32 signatureLength = 0;
+				U_32 objectIndex = 0;
+				const U_8* name = readBytes(&reader, &nameLength);
+				const U_8* signature = readBytes(&reader, &signatureLength);
+
+				if (readWords(&reader, &objectIndex, 1) && (0 != objectIndex) && (objectIndex <= header.objectCount)) {
+					J9Class* definingClass = NULL;
+					void* fieldAddress = vmFuncs->staticFieldAddress(currentThread, clazz, (U_8*)name, nameLength, (U_8*)signature, signatureLength, &definingClass, NULL, J9_LOOK_NO_JAVA, NULL);
+
+					if ((NULL != fieldAddress) && (definingClass == clazz)) {
+						j9object_t value = J9JAVAARRAYOFOBJECT_LOAD(currentThread, J9_JNI_UNWRAP_REFERENCE(objectsRef), objectIndex - 1);
+
+						if (NULL == J9STATIC_OBJECT_LOAD(currentThread, clazz, fieldAddress)) {
+							J9STATIC_OBJECT_STORE(currentThread, clazz, fieldAddress, value);
+						}
+					}
+				}
+			}
+			vmFuncs->j9jni_deleteLocalRef((JNIEnv*)currentThread, objectsRef);
+			if (reader.failed) {
+				Trc_SHR_HA_initializeFromHeapArchive_Exit_Corrupt(currentThread);
+			} else {
+				Trc_SHR_HA_initializeFromHeapArchive_Exit_Restored(currentThread, header.objectCount, header.fieldCount);
+			}
+			return;
+		}
+	}
+
+	/* Store the fields once the static initializer has computed them */
+	if (J9_ARE_NO_BITS_SET(config->runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY) && (NULL != config->heapArchivePending)) {
+		omrthread_monitor_enter(config->configMonitor);
+		J9Class** pending = (J9Class**)pool_newElement(config->heapArchivePending);
+		if (NULL != pending) {
+			*pending = clazz;
+		}
+		omrthread_monitor_exit(config->configMonitor);
+	}
+	Trc_SHR_HA_initializeFromHeapArchive_Exit_NotFound(currentThread);
+}
+
+/**
+ * Stores the archived static fields of clazz in the shared cache.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] clazz A class which has finished initialization
+ *
+ * @return true if a record was stored, false otherwise
+ */
+static bool
+storeHeapArchive(J9VMThread* currentThread, J9Class* clazz)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	J9SharedClassConfig* config = vm->sharedClassConfig;
+	SH_CacheMap* cm = (SH_CacheMap*)config->sharedClassCache;
+	J9ROMClass* romClass = clazz->romClass;
+	J9UTF8* key = getHeapArchiveKey(romClass);
+	J9SharedHeapArchiveHeader header;
+	HeapArchiveWriter writer;
+	J9ROMFieldWalkState walkState;
+	J9ROMFieldShape* field = NULL;
+	bool stored = false;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	memset(&header, 0, sizeof(header));
+	if (!cm->getROMClassOffset(romClass, &header.romClassOffset)) {
+		return false;
+	}
+
+	memset(&writer, 0, sizeof(writer));
+	writer.currentThread = currentThread;
+	writer.objectIndices = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 0, sizeof(HeapArchiveObjectIndex), sizeof(j9object_t), 0, J9MEM_CATEGORY_CLASSES, heapArchiveObjectHashFn, heapArchiveObjectHashEqualFn, NULL, NULL);
+	if (NULL == writer.objectIndices) {
+		return false;
+	}
+
+	/* Leave room for the header, which is filled in once the counts are known */
+	writeWords(&writer, (U_32*)&header, HEAP_ARCHIVE_WORDS(sizeof(header)));
+
+	/* The objects are written first, followed by the fields which refer to them */
+	field = romFieldsStartDo(romClass, &walkState);
+	while ((NULL != field) && !writer.failed) {
+		if (isArchivedField(field)) {
+			J9UTF8* name = J9ROMFIELDSHAPE_NAME(field);
+			J9UTF8* signature = J9ROMFIELDSHAPE_SIGNATURE(field);
+			void* fieldAddress = vm->internalVMFunctions->staticFieldAddress(currentThread, clazz, J9UTF8_DATA(name), J9UTF8_LENGTH(name), J9UTF8_DATA(signature), J9UTF8_LENGTH(signature), NULL, NULL, J9_LOOK_NO_JAVA, NULL);
+
+			if (NULL != fieldAddress) {
+				writeObject(&writer, J9STATIC_OBJECT_LOAD(currentThread, clazz, fieldAddress));
+			}
+		}
+		field = romFieldsNextDo(&walkState);
+	}
+	header.objectCount = writer.objectCount;
+
+	field = romFieldsStartDo(romClass, &walkState);
+	while ((NULL != field) && !writer.failed) {
+		if (isArchivedField(field)) {
+			J9UTF8* name = J9ROMFIELDSHAPE_NAME(field);
+			J9UTF8* signature = J9ROMFIELDSHAPE_SIGNATURE(field);
+			void* fieldAddress = vm->internalVMFunctions->staticFieldAddress(currentThread, clazz, J9UTF8_DATA(name), J9UTF8_LENGTH(name), J9UTF8_DATA(signature), J9UTF8_LENGTH(signature), NULL, NULL, J9_LOOK_NO_JAVA, NULL);
+
+			if (NULL != fieldAddress) {
+				/* Every object was already written, so this only looks up the index */
+				U_32 objectIndex = writeObject(&writer, J9STATIC_OBJECT_LOAD(currentThread, clazz, fieldAddress));
+
+				writeBytes(&writer, J9UTF8_DATA(name), J9UTF8_LENGTH(name));
+				writeBytes(&writer, J9UTF8_DATA(signature), J9UTF8_LENGTH(signature));
+				writeWords(&writer, &objectIndex, 1);
+				header.fieldCount += 1;
+			}
+		}
+		field = romFieldsNextDo(&walkState);
+	}
+
+	if (!writer.failed && (0 != header.fieldCount)) {
+		J9SharedDataDescriptor descriptor;
+
+		memcpy(writer.data, &header, sizeof(header));
+		descriptor.address = (U_8*)writer.data;
+		descriptor.length = writer.length * sizeof(U_32);
+		descriptor.type = J9SHR_DATA_TYPE_HEAPARCHIVE;
+		/* Replace a record stored for a different version of the class */
+		descriptor.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE_OVERWRITE;
+		stored = (NULL != config->storeSharedData(currentThread, (const char*)J9UTF8_DATA(key), J9UTF8_LENGTH(key), &descriptor));
+	}
+	Trc_SHR_HA_storeHeapArchive_Event(currentThread, J9UTF8_LENGTH(key), J9UTF8_DATA(key), header.objectCount, header.fieldCount, stored ? 1 : 0);
+
+	hashTableFree(writer.objectIndices);
+	if (NULL != writer.data) {
+		j9mem_free_memory(writer.data);
+	}
+	return stored;
+}
+
+/**
+ * Removes a class from the classes waiting for their static initializer to complete.
+ *
+ * @param [in] config The shared class config
+ * @param [in] clazz The class
+ *
+ * @return true if the class was waiting, false otherwise
+ */
+static bool
+removeHeapArchivePending(J9SharedClassConfig* config, J9Class* clazz)
+{
+	bool isPending = false;
+
+	if ((NULL == config) || (NULL == config->heapArchivePending) || (0 == pool_numElements(config->heapArchivePending))) {
+		return false;
+	}
+
+	omrthread_monitor_enter(config->configMonitor);
+	{
+		pool_state state;
+		J9Class** pending = (J9Class**)pool_startDo(config->heapArchivePending, &state);
+
+		while (NULL != pending) {
+			if (*pending == clazz) {
+				pool_removeElement(config->heapArchivePending, pending);
+				isPending = true;
+				break;
+			}
+			pending = (J9Class**)pool_nextDo(&state);
+		}
+	}
+	omrthread_monitor_exit(config->configMonitor);
+	return isPending;
+}
+
+/**
+ * J9HOOK_VM_CLASS_INITIALIZE handler which stores the archived static fields of the classes
+ * that found no heap archive record in j9shr_initializeFromHeapArchive().
+ */
+void
+hookStoreHeapArchive(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData)
+{
+	J9VMClassInitializeEvent* event = (J9VMClassInitializeEvent*)voidData;
+	J9VMThread* currentThread = event->currentThread;
+
+	if (removeHeapArchivePending(currentThread->javaVM->sharedClassConfig, event->clazz)) {
+		storeHeapArchive(currentThread, event->clazz);
+	}
+}
+
+/**
+ * J9HOOK_VM_CLASS_INITIALIZE_FAILED handler which forgets the classes whose static initializer
+ * threw, so that nothing is stored for them.
+ */
+void
+hookDiscardHeapArchive(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData)
+{
+	J9VMClassInitializeFailedEvent* event = (J9VMClassInitializeFailedEvent*)voidData;
+
+	if (removeHeapArchivePending(event->currentThread->javaVM->sharedClassConfig, event->clazz)) {
+		Trc_SHR_HA_hookDiscardHeapArchive_Event(event->currentThread, event->clazz);
+	}
+}
+
+static UDATA
+heapArchiveObjectHashFn(void* entry, void* userData)
+{
+	return (UDATA)((HeapArchiveObjectIndex*)entry)->object;
+}
+
+static UDATA
+heapArchiveObjectHashEqualFn(void* left, void* right, void* userData)
+{
+	return ((HeapArchiveObjectIndex*)left)->object == ((HeapArchiveObjectIndex*)right)->object;
+}
@@ -272,6 +272,8 @@ protected:
 	static UDATA hllHashFn(void* item, void *userData);
 	static UDATA hllHashEqualFn(void* left, void* right, void *userData);
 
+	static UDATA generateHash(J9InternalVMFunctions* internalFunctionTable, U_8* key, U_16 keySize);
+
 #if defined(J9SHR_CACHELET_SUPPORT)
 
 	struct CacheletHintCountData {
@@ -318,8 +320,6 @@ private:
 	bool isCacheletInList(SH_CompositeCache* cachelet);
 #endif
 
-	static UDATA generateHash(J9InternalVMFunctions* internalFunctionTable, U_8* key, U_16 keySize);
-
 #if defined(J9SHR_CACHELET_SUPPORT)
 	J9Pool* getCacheletListPool(void); 
 #endif
@@ -26,6 +26,13 @@
  */
 
 #include <string.h>
+#if defined(LINUX)
+#include <errno.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
 #include "j9cfg.h"
 #include "j9port.h"
 #include "pool_api.h"
@@ -43,6 +50,13 @@
 #endif /* J9SHR_CACHELET_SUPPORT */
 #include "CacheMap.hpp"
 
+#if defined(LINUX)
+/* Memory policy values from <numaif.h>, which is part of libnuma rather than the C library */
+#define OSCACHE_MPOL_INTERLEAVE 3
+#define OSCACHE_MPOL_F_MEMS_ALLOWED (1 << 2)
+#define OSCACHE_NUMA_NODE_MASK_WORDS (1024 / (sizeof(unsigned long) * 8))
+#endif /* defined(LINUX) */
+
 /**
  * Function which builds a cache filename from a cache name, version data and generation.
  * A cache file name is currently a composite of the cache name with a version prefix and generation postfix
@@ -364,6 +378,14 @@ SH_OSCache::commonStartup(J9JavaVM* vm, const char* ctrlDirName, UDATA cacheDirP
 	_createFlags = createFlag;
 	_runtimeFlags = runtimeFlags;
 	_isUserSpecifiedCacheDir = (J9_ARE_ALL_BITS_SET(_runtimeFlags, J9SHR_RUNTIMEFLAG_CACHEDIR_PRESENT));
+	if (NULL != vm->sharedCacheAPI) {
+		if (vm->sharedCacheAPI->hugePages) {
+			_mappingFlags |= J9SHR_MAPPING_HUGE_PAGES_REQUESTED;
+		}
+		if (vm->sharedCacheAPI->numaInterleave) {
+			_mappingFlags |= J9SHR_MAPPING_NUMA_INTERLEAVE_REQUESTED;
+		}
+	}
 
 	/* get the cacheDirName for the first time */
 	if (!(_cacheDirName = (char*)j9mem_allocate_memory(J9SH_MAXPATH, J9MEM_CATEGORY_CLASSES))) {
@@ -458,6 +480,122 @@ SH_OSCache::dontNeedMetadata(J9VMThread* currentThread, const void* startAddress
 	return;
 }
 
+void
+SH_OSCache::willNeed(J9VMThread* currentThread, const void* startAddress, size_t length) {
+	return;
+}
+
+/* override if the residency of the cache pages can be queried */
+bool
+SH_OSCache::getResidentPages(J9VMThread* currentThread, const void* startAddress, UDATA pageSize, UDATA pageCount, U_8* resident) {
+	return false;
+}
+
+/**
+ * Apply -Xshareclasses:hugePages and -Xshareclasses:numaInterleave to the memory the cache is attached at.
+ * This is called before the pages of a new cache are first touched, as the page size and node of a page
+ * are chosen when it is faulted in. If the operating system refuses, the cache keeps its default pages
+ * and memory policy, and getMappingStats() shows what was obtained.
+ *
+ * @param [in] start  The address the cache is attached at
+ * @param [in] length  The length of the attached cache
+ */
+void
+SH_OSCache::applyMappingOptions(void* start, UDATA length)
+{
+	_mappedStart = start;
+	_mappedLength = length;
+#if defined(LINUX)
+#if defined(MADV_HUGEPAGE)
+	if (J9_ARE_ANY_BITS_SET(_mappingFlags, J9SHR_MAPPING_HUGE_PAGES_REQUESTED)) {
+		/* Transparent huge pages back shared memory and tmpfs files, see /sys/kernel/mm/transparent_hugepage/shmem_enabled */
+		if (0 == madvise(start, length, MADV_HUGEPAGE)) {
+			_mappingFlags |= J9SHR_MAPPING_HUGE_PAGES_ADVISED;
+		} else {
+			Trc_SHR_OSC_applyMappingOptions_hugePagesFailed((UDATA)start, length, errno);
+		}
+	}
+#endif /* defined(MADV_HUGEPAGE) */
+#if defined(SYS_mbind) && defined(SYS_get_mempolicy)
+	if (J9_ARE_ANY_BITS_SET(_mappingFlags, J9SHR_MAPPING_NUMA_INTERLEAVE_REQUESTED)) {
+		unsigned long nodeMask[OSCACHE_NUMA_NODE_MASK_WORDS];
+		UDATA maxNode = sizeof(nodeMask) * 8;
+		UDATA i = 0;
+
+		/* Interleave across the nodes this process is allowed to allocate memory on */
+		memset(nodeMask, 0, sizeof(nodeMask));
+		if (0 != syscall(SYS_get_mempolicy, NULL, nodeMask, maxNode, NULL, OSCACHE_MPOL_F_MEMS_ALLOWED)) {
+			Trc_SHR_OSC_applyMappingOptions_numaInterleaveFailed((UDATA)start, length, errno);
+		} else if (0 != syscall(SYS_mbind, start, length, OSCACHE_MPOL_INTERLEAVE, nodeMask, maxNode, 0)) {
+			Trc_SHR_OSC_applyMappingOptions_numaInterleaveFailed((UDATA)start, length, errno);
+		} else {
+			_mappingFlags |= J9SHR_MAPPING_NUMA_INTERLEAVED;
+			_numaNodes = 0;
+			for (i = 0; i < maxNode; i++) {
+				if (0 != (nodeMask[i / (sizeof(unsigned long) * 8)] & (1UL << (i % (sizeof(unsigned long) * 8))))) {
+					_numaNodes += 1;
+				}
+			}
+		}
+	}
+#endif /* defined(SYS_mbind) && defined(SYS_get_mempolicy) */
+#endif /* defined(LINUX) */
+}
+
+/**
+ * Report the page size and NUMA placement of the attached cache in the javacore data.
+ * On Linux, when huge pages or NUMA interleaving were requested, the page size and the bytes backed by
+ * huge pages are read from /proc/self/smaps, summing every mapping of the cache as page protection
+ * splits it into several.
+ *
+ * @param [out] descriptor  The javacore data to fill in
+ */
+void
+SH_OSCache::getMappingStats(J9SharedClassJavacoreDataDescriptor* descriptor)
+{
+	descriptor->cacheMappingFlags = _mappingFlags;
+	descriptor->cacheNumaNodes = _numaNodes;
+	descriptor->cachePageSize = 0;
+	descriptor->cacheHugePageBytes = 0;
+#if defined(LINUX)
+	if ((NULL != _mappedStart)
+		&& J9_ARE_ANY_BITS_SET(_mappingFlags, J9SHR_MAPPING_HUGE_PAGES_REQUESTED | J9SHR_MAPPING_NUMA_INTERLEAVE_REQUESTED)
+	) {
+		PORT_ACCESS_FROM_PORT(_portLibrary);
+		IDATA smaps = j9file_open("/proc/self/smaps", EsOpenRead, 0);
+
+		if (-1 != smaps) {
+			UDATA cacheStart = (UDATA)_mappedStart;
+			UDATA cacheEnd = cacheStart + _mappedLength;
+			bool inCache = false;
+			char line[256];
+
+			while (NULL != j9file_read_text(smaps, line, sizeof(line))) {
+				unsigned long start = 0;
+				unsigned long end = 0;
+				unsigned long kiloBytes = 0;
+
+				if (2 == sscanf(line, "%lx-%lx ", &start, &end)) {
+					inCache = (start < cacheEnd) && (end > cacheStart);
+				} else if (inCache) {
+					if (1 == sscanf(line, "KernelPageSize: %lu kB", &kiloBytes)) {
+						descriptor->cachePageSize = OMR_MAX(descriptor->cachePageSize, (UDATA)kiloBytes * 1024);
+					} else if ((1 == sscanf(line, "AnonHugePages: %lu kB", &kiloBytes))
+						|| (1 == sscanf(line, "ShmemPmdMapped: %lu kB", &kiloBytes))
+						|| (1 == sscanf(line, "FilePmdMapped: %lu kB", &kiloBytes))
+						|| (1 == sscanf(line, "Shared_Hugetlb: %lu kB", &kiloBytes))
+						|| (1 == sscanf(line, "Private_Hugetlb: %lu kB", &kiloBytes))
+					) {
+						descriptor->cacheHugePageBytes += (UDATA)kiloBytes * 1024;
+					}
+				}
+			}
+			j9file_close(smaps);
+		}
+	}
+#endif /* defined(LINUX) */
+}
+
 /* Function that initializes class variables common to OSCache subclasses */
 void
 SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation, I_8 layer)
@@ -483,6 +621,10 @@ SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation, I_8 layer)
 	_runningReadOnly = false;
 	_doCheckBuildID = false;
 	_isUserSpecifiedCacheDir = false;
+	_mappingFlags = 0;
+	_numaNodes = 0;
+	_mappedStart = NULL;
+	_mappedLength = 0;
 }
 
 /* Function that cleans up resources common to OSCache subclasses */
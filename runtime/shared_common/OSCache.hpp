@@ -269,6 +269,10 @@ public:
 	virtual SH_CacheAccess isCacheAccessible(void) const { return J9SH_CACHE_ACCESS_ALLOWED; }
 
 	virtual void  dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
+
+	virtual void willNeed(J9VMThread* currentThread, const void* startAddress, size_t length);
+
+	virtual bool getResidentPages(J9VMThread* currentThread, const void* startAddress, UDATA pageSize, UDATA pageCount, U_8* resident);
 	
 	virtual IDATA detach(void) = 0;
 
@@ -302,6 +306,10 @@ protected:
 
 	static bool getCacheStatsCommon(J9JavaVM* vm, const char* ctrlDirName, UDATA groupPerm, SH_OSCache *cache, SH_OSCache_Info *cacheInfo, J9Pool **lowerLayerList);
 
+	void applyMappingOptions(void* start, UDATA length);
+
+	void getMappingStats(J9SharedClassJavacoreDataDescriptor* descriptor);
+
 	char* _cacheName;
 	/* Align the U_64 so we don't have too many platform specific structure padding
 	 * issues in the debug extensions. Note C++ adds a pointer variable at the start
@@ -330,6 +338,10 @@ protected:
 	IDATA _corruptionCode;
 	UDATA _corruptValue;
 	bool _isUserSpecifiedCacheDir;
+	UDATA _mappingFlags;
+	UDATA _numaNodes;
+	void* _mappedStart;
+	UDATA _mappedLength;
 	
 private:
 	void setEnableVerbose(J9PortLibrary* portLib, J9JavaVM* vm, J9PortShcVersion* versionData, char* cacheNameWithVGen);
@@ -26,6 +26,10 @@
  */
 
 #include <string.h>
+#if defined(LINUX)
+#include <errno.h>
+#include <sys/mman.h>
+#endif /* defined(LINUX) */
 #include "j2sever.h"
 #include "j9cfg.h"
 #include "j9port.h"
@@ -463,6 +467,56 @@ SH_OSCachemmap::dontNeedMetadata(J9VMThread* currentThread, const void* startAdd
 #endif
 }
 
+/**
+ * Advise the OS that a section of the shared classes cache will be accessed soon,
+ * so the file pages can be read ahead with large I/Os rather than faulted in one at a time.
+ */
+void
+SH_OSCachemmap::willNeed(J9VMThread* currentThread, const void* startAddress, size_t length) {
+#if defined(LINUX)
+	UDATA pageSize = getPermissionsRegionGranularity(_portLibrary);
+
+	if (0 != pageSize) {
+		UDATA alignedStart = ROUND_DOWN_TO(pageSize, (UDATA)startAddress);
+
+		length += (size_t)((UDATA)startAddress - alignedStart);
+		if (0 != madvise((void*)alignedStart, length, MADV_WILLNEED)) {
+			Trc_SHR_OSC_Mmap_willNeed_Failed(alignedStart, length, errno);
+		}
+	}
+#endif /* defined(LINUX) */
+}
+
+/**
+ * Find which pages of a section of the shared classes cache are in memory, so that
+ * the pages a read ahead actually brings in from the file can be told apart from
+ * those which were already in the page cache.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] startAddress Start of the section, aligned to pageSize
+ * @param [in] pageSize Size of the pages, which must be the OS page size
+ * @param [in] pageCount Number of pages in the section
+ * @param [out] resident One byte per page, set to 1 if the page is in memory and 0 otherwise
+ *
+ * @return true if the residency was found, false if it can't be queried
+ */
+bool
+SH_OSCachemmap::getResidentPages(J9VMThread* currentThread, const void* startAddress, UDATA pageSize, UDATA pageCount, U_8* resident) {
+#if defined(LINUX)
+	if ((pageSize == getPermissionsRegionGranularity(_portLibrary)) && (0 == ((UDATA)startAddress % pageSize))) {
+		if (0 == mincore((void*)startAddress, pageSize * pageCount, (unsigned char*)resident)) {
+			/* The other bits of each byte are reserved */
+			for (UDATA i = 0; i < pageCount; i++) {
+				resident[i] &= 1;
+			}
+			return true;
+		}
+		Trc_SHR_OSC_Mmap_getResidentPages_Failed((UDATA)startAddress, pageSize * pageCount, errno);
+	}
+#endif /* defined(LINUX) */
+	return false;
+}
+
 /**
  * Destroy a persistent shared classes cache
  *
@@ -1000,6 +1054,7 @@ SH_OSCachemmap::internalAttach(bool isNewCache, UDATA generation)
 	}
 	_headerStart = _mapFileHandle->pointer;
 	Trc_SHR_OSC_Mmap_internalAttach_goodmapfile(_headerStart);
+	applyMappingOptions(_headerStart, (UDATA)_actualFileLength);
 
 	if (!isNewCache) {
 		J9SRP* dataStartField;
@@ -1752,6 +1807,7 @@ SH_OSCachemmap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescripto
 	descriptor->cacheGen = _activeGeneration;
 	descriptor->shmid = descriptor->semid = -2;
 	descriptor->cacheDir = _cachePathName;
+	getMappingStats(descriptor);
 
 	return 1;
 }
@@ -94,6 +94,8 @@ public:
 
 	SH_CacheAccess isCacheAccessible(void) const;
 	virtual void dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
+	virtual void willNeed(J9VMThread* currentThread, const void* startAddress, size_t length);
+	virtual bool getResidentPages(J9VMThread* currentThread, const void* startAddress, UDATA pageSize, UDATA pageCount, U_8* resident);
 
 protected:
 	virtual void * getAttachedMemory();
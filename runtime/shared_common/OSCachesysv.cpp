@@ -907,6 +907,9 @@ SH_OSCachesysv::initializeHeader(const char* cacheDirName, J9PortShcVersion* ver
 		return OSCACHESYSV_FAILURE;
 	}
 
+	/* The pages of the new segment are first touched below, so apply the mapping options now */
+	applyMappingOptions(region, _cacheSize);
+
 	/* We can now setup the header */
 	_headerStart = region;
 	_dataStart = (void*)((UDATA)region + SHM_CACHEHEADERSIZE);
@@ -1020,6 +1023,8 @@ SH_OSCachesysv::attach(J9VMThread *currentThread, J9PortShcVersion* expectedVers
 	_dataStart = SHM_DATASTARTFROMHEADER(((OSCachesysv_header_version_current*)_headerStart));
 
 	_dataLength = SHM_CACHEDATASIZE(((OSCachesysv_header_version_current*)_headerStart)->oscHdr.size);
+	/* the segment may have been created by another JVM with a different size than requested, so use the size from the header */
+	applyMappingOptions(request, ((OSCachesysv_header_version_current*)_headerStart)->oscHdr.size);
 	_attach_count++;
 
 	if (_verboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE) {
@@ -2021,6 +2026,7 @@ SH_OSCachesysv::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescripto
 	}
 #endif
 	descriptor->cacheDir = _cachePathName;
+	getMappingStats(descriptor);
 	return 1;
 }
 
@@ -68,6 +68,10 @@ public:
 	virtual const J9ROMClass* findNextExisting(J9VMThread* currentThread, void * &findNextIterator, void * &firstFound, U_16 classnameLength, const char* classnameData) = 0;
 
 	virtual UDATA existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen) = 0;
+
+	virtual UDATA updateClassIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache) = 0;
+
+	virtual void getNumDeferredItems(UDATA* nonStaleItems, UDATA* staleItems) = 0;
 	
 };
 
@@ -34,10 +34,17 @@
 #include "j9consts.h"
 #include <string.h>
 
+/* Above the offset of any item, to find the first entry under a name hash */
+#define CLASS_INDEX_ITEM_OFFSET_END ((U_32)0xFFFFFFFF)
+
 SH_ROMClassManagerImpl::SH_ROMClassManagerImpl()
  : _tsm(0),
-   _linkedListImplPool(0)
+   _linkedListImplPool(0),
+   _classIndexLayerCount(0),
+   _deferredItems(0),
+   _deferredStaleItems(0)
 {
+	memset(_classIndexLayers, 0, sizeof(_classIndexLayers));
 }
 
 SH_ROMClassManagerImpl::~SH_ROMClassManagerImpl()
@@ -120,7 +127,7 @@ SH_ROMClassManagerImpl::localInitializePools(J9VMThread* currentThread)
 {
 	Trc_SHR_RMI_localInitializePools_Entry(currentThread);
 
-	_linkedListImplPool = pool_new(sizeof(SH_Manager::HashLinkedListImpl),  0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_CLASSES, POOL_FOR_PORT(_portlib));
+	_linkedListImplPool = pool_new(sizeof(SH_ROMClassManagerImpl::RcLinkedListImpl),  0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_CLASSES, POOL_FOR_PORT(_portlib));
 	if (!_linkedListImplPool) {
 		PORT_ACCESS_FROM_PORT(_portlib);
 		M_ERR_TRACE(J9NLS_SHRC_RMI_FAILED_CREATE_POOL);
@@ -141,9 +148,25 @@ SH_ROMClassManagerImpl::localTearDownPools(J9VMThread* currentThread)
 		pool_kill(_linkedListImplPool);
 		_linkedListImplPool = NULL;
 	}
+	clearClassIndexLayers();
 
 	Trc_SHR_RMI_localTearDownPools_Exit(currentThread);
 }
+
+/* Forget all class index layers. The items they deferred are read again along with the rest of the cache. */
+void
+SH_ROMClassManagerImpl::clearClassIndexLayers(void)
+{
+	for (UDATA i = 0; i <= J9SH_LAYER_NUM_MAX_VALUE; i++) {
+		if (NULL != _classIndexLayers[i].table) {
+			srpHashTableFree(_classIndexLayers[i].table);
+		}
+	}
+	memset(_classIndexLayers, 0, sizeof(_classIndexLayers));
+	_classIndexLayerCount = 0;
+	_deferredItems = 0;
+	_deferredStaleItems = 0;
+}
 	
 U_32
 SH_ROMClassManagerImpl::getHashTableEntriesFromCacheSize(UDATA cacheSizeBytes)
@@ -154,7 +177,9 @@ SH_ROMClassManagerImpl::getHashTableEntriesFromCacheSize(UDATA cacheSizeBytes)
 /**
  * Registers a new cached ROMClass with the SH_ROMClassManager
  *
- * Called when a new ROMClass has been identified in the cache
+ * Called when a new ROMClass has been identified in the cache.
+ * If the item is in the class index of its cache layer, it is not added to the local hashtable
+ * until a class of the same name is looked up.
  *
  * @see Manager.hpp
  * @param[in] currentThread The current thread
@@ -165,22 +190,53 @@ SH_ROMClassManagerImpl::getHashTableEntriesFromCacheSize(UDATA cacheSizeBytes)
 bool 
 SH_ROMClassManagerImpl::storeNew(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet)
 {
-	HashLinkedListImpl* result = NULL;
-	bool orphanReunited = false;
-	J9ROMClass* romClass = NULL;
+	ClassIndexLayer* layer = NULL;
 	J9UTF8* utf8Name = NULL;
+	bool result = false;
 
 	if (getState() != MANAGER_STATE_STARTED) {
 		return false;
 	}
-	Trc_SHR_RMI_storeNew_Entry(currentThread, itemInCache);
+	if (_isRunningNested) {
+		return storeItem(currentThread, itemInCache, cachelet);
+	}
 
-	if (ITEMTYPE(itemInCache) == TYPE_ORPHAN) {
-		romClass = (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(itemInCache))->romClassOffset));
+	if (!lockHashTable(currentThread, "storeNew")) {
+		PORT_ACCESS_FROM_PORT(_portlib);
+		M_ERR_TRACE(J9NLS_SHRC_M_FAILED_ENTER_HTMUTEX);
+		return false;
+	}
+	layer = getClassIndexLayer(currentThread, (SH_CompositeCacheImpl*)cachelet, true);
+	if ((NULL != layer) && (NULL != layer->boundary) && ((BlockPtr)ITEMEND(itemInCache) > (BlockPtr)layer->boundary)) {
+		++_deferredItems;
+		if (_cache->isStale(itemInCache)) {
+			++_deferredStaleItems;
+		}
+		Trc_SHR_RMI_storeNew_Deferred(currentThread, itemInCache);
+		result = true;
 	} else {
-		romClass = (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(itemInCache))->romClassOffset));
+		utf8Name = J9ROMCLASS_CLASSNAME(getROMClassForItem(itemInCache));
+		/* Items in the class index under the same name were added to the cache first, so they must be stored first */
+		if (readClassIndex(currentThread, (const char*)J9UTF8_DATA(utf8Name), getIndexedNameLength(utf8Name), (UDATA)((SH_CompositeCacheImpl*)cachelet)->getLayer())) {
+			result = storeItem(currentThread, itemInCache, cachelet);
+		}
 	}
+	unlockHashTable(currentThread, "storeNew");
+	return result;
+}
+
+/* Adds a ROMClass item to the local hashtable */
+bool 
+SH_ROMClassManagerImpl::storeItem(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet)
+{
+	HashLinkedListImpl* result = NULL;
+	bool orphanReunited = false;
+	J9ROMClass* romClass = NULL;
+	J9UTF8* utf8Name = NULL;
+
+	Trc_SHR_RMI_storeNew_Entry(currentThread, itemInCache);
 
+	romClass = getROMClassForItem(itemInCache);
 	utf8Name = J9ROMCLASS_CLASSNAME(romClass);
 
 	if (ITEMTYPE(itemInCache) == TYPE_ORPHAN) {
@@ -203,6 +259,288 @@ SH_ROMClassManagerImpl::storeNew(J9VMThread* currentThread, const ShcItem* itemI
  	return true;
 }
 
+J9ROMClass*
+SH_ROMClassManagerImpl::getROMClassForItem(const ShcItem* item)
+{
+	if (ITEMTYPE(item) == TYPE_ORPHAN) {
+		return (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(item))->romClassOffset));
+	}
+	return (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(item))->romClassOffset));
+}
+
+/**
+ * Get the class index of the cache layer an item was found in, recreating it on first use.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cache The cache layer
+ * @param[in] setBoundary true if items from the layer are about to be stored. The boundary is fixed the first time this is true.
+ *
+ * @return the ClassIndexLayer, or NULL if the layer number is out of range
+ *
+ * THREADING: Must hold the hashtable mutex
+ */
+SH_ROMClassManagerImpl::ClassIndexLayer*
+SH_ROMClassManagerImpl::getClassIndexLayer(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, bool setBoundary)
+{
+	I_8 layerNum = cache->getLayer();
+	ClassIndexLayer* layer = NULL;
+
+	if ((layerNum < 0) || (layerNum > J9SH_LAYER_NUM_MAX_VALUE)) {
+		return NULL;
+	}
+	layer = &_classIndexLayers[layerNum];
+	if (NULL == layer->cache) {
+		J9SharedClassIndexHeader* indexHeader = cache->getClassIndexHeader();
+
+		layer->cache = cache;
+		if (NULL != indexHeader) {
+			/* If this fails the layer has no class index and all of its items are stored in the local hashtable */
+			layer->table = srpHashTableRecreate(_portlib, J9_GET_CALLSITE(), CLASSINDEXTABLE(indexHeader), 
+					SH_ROMClassManagerImpl::classIndexHashFn, SH_ROMClassManagerImpl::classIndexHashEqualFn, NULL, NULL);
+		}
+	}
+	if (setBoundary && (NULL != layer->table) && (NULL == layer->boundary)) {
+		layer->boundary = cache->getClassIndexBoundary();
+		if ((UDATA)layerNum >= _classIndexLayerCount) {
+			_classIndexLayerCount = (UDATA)layerNum + 1;
+		}
+		Trc_SHR_RMI_getClassIndexLayer_SetBoundary(currentThread, (I_32)layerNum, layer->boundary);
+	}
+	return layer;
+}
+
+/**
+ * Looks up a class name in the local hashtable, first storing any items in the class index under that name.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] name The class name
+ * @param[in] nameLen Length of the class name
+ *
+ * @return the HashLinkedListImpl for the name, or NULL if there is none
+ */
+SH_Manager::HashLinkedListImpl*
+SH_ROMClassManagerImpl::classIndexLookup(J9VMThread* currentThread, const char* name, U_16 nameLen)
+{
+	HashLinkedListImpl* found = hllTableLookup(currentThread, name, nameLen, true);
+
+	if ((0 != _classIndexLayerCount)
+		&& ((NULL == found) || (((RcLinkedListImpl*)found)->_indexedLayers < _classIndexLayerCount))
+	) {
+		if (lockHashTable(currentThread, "classIndexLookup")) {
+			if (readClassIndex(currentThread, name, nameLen, _classIndexLayerCount - 1)) {
+				found = hllTableLookup(currentThread, name, nameLen, true);
+			}
+			unlockHashTable(currentThread, "classIndexLookup");
+		} else {
+			PORT_ACCESS_FROM_PORT(_portlib);
+			M_ERR_TRACE(J9NLS_SHRC_M_FAILED_ENTER_HTMUTEX);
+		}
+	}
+	return found;
+}
+
+/**
+ * Stores the deferred items under a class name from the class index of layers up to lastLayer,
+ * in the same order they would have been stored by reading the cache.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] name The class name
+ * @param[in] nameLen Length of the class name
+ * @param[in] lastLayer The highest cache layer to read the class index of
+ *
+ * @return true if successful, false if an item could not be stored
+ *
+ * THREADING: Must hold the hashtable mutex
+ */
+bool
+SH_ROMClassManagerImpl::readClassIndex(J9VMThread* currentThread, const char* name, U_16 nameLen, UDATA lastLayer)
+{
+	HashLinkedListImpl* found = hllTableLookup(currentThread, name, nameLen, false);
+	UDATA layerNum = (NULL == found) ? 0 : ((RcLinkedListImpl*)found)->_indexedLayers;
+	ClassIndexQuery query;
+
+	if ((layerNum > lastLayer) || (layerNum >= _classIndexLayerCount)) {
+		return true;
+	}
+	Trc_SHR_RMI_readClassIndex_Entry(currentThread, nameLen, name, layerNum, lastLayer);
+
+	query.key.nameHash = classIndexNameHash(currentThread->javaVM->internalVMFunctions, name, nameLen);
+	query.key.itemOffset = 0;
+
+	for (; (layerNum <= lastLayer) && (layerNum < _classIndexLayerCount); layerNum++) {
+		ClassIndexLayer* layer = &_classIndexLayers[layerNum];
+
+		if ((NULL != layer->table) && (NULL != layer->boundary)) {
+			J9SharedClassIndexEntry* entry = NULL;
+
+			/* Each find returns the next entry under the name hash, in the order the items were added to the cache */
+			query.belowItemOffset = CLASS_INDEX_ITEM_OFFSET_END;
+			while (NULL != (entry = (J9SharedClassIndexEntry*)srpHashTableFind(layer->table, &query))) {
+				U_32 itemOffset = entry->itemOffset;
+
+				if (!readClassIndexItem(currentThread, layer, name, nameLen, (const ShcItem*)((BlockPtr)layer->cache->getCacheHeaderAddress() + itemOffset))) {
+					Trc_SHR_RMI_readClassIndex_ExitFailed(currentThread, layerNum);
+					return false;
+				}
+				query.belowItemOffset = itemOffset;
+			}
+		}
+	}
+
+	found = hllTableLookup(currentThread, name, nameLen, false);
+	if (NULL != found) {
+		((RcLinkedListImpl*)found)->_indexedLayers = layerNum;
+	}
+	Trc_SHR_RMI_readClassIndex_Exit(currentThread, found);
+	return true;
+}
+
+/**
+ * Stores an item found in the class index if it was deferred and really has the name being looked up
+ *
+ * @return false if the item could not be stored, true otherwise
+ *
+ * THREADING: Must hold the hashtable mutex
+ */
+bool
+SH_ROMClassManagerImpl::readClassIndexItem(J9VMThread* currentThread, const ClassIndexLayer* layer, const char* name, U_16 nameLen, const ShcItem* item)
+{
+	J9UTF8* utf8Name = NULL;
+
+	if ((BlockPtr)ITEMEND(item) <= (BlockPtr)layer->boundary) {
+		/* Not deferred, this was stored when the cache was read */
+		return true;
+	}
+	utf8Name = J9ROMCLASS_CLASSNAME(getROMClassForItem(item));
+	if ((getIndexedNameLength(utf8Name) != nameLen) || (0 != memcmp(J9UTF8_DATA(utf8Name), name, nameLen))) {
+		/* A different name with the same hash */
+		return true;
+	}
+	if (!storeItem(currentThread, item, layer->cache)) {
+		return false;
+	}
+	if ((0 != _deferredStaleItems) && _cache->isStale(item)) {
+		--_deferredStaleItems;
+	}
+	--_deferredItems;
+	return true;
+}
+
+/**
+ * Adds the ROMClass items committed to a cache layer since the last call to its class index.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cache The cache layer
+ *
+ * @return the number of items added
+ *
+ * THREADING: Must hold the cache write mutex
+ */
+UDATA
+SH_ROMClassManagerImpl::updateClassIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache)
+{
+	J9SRPHashTable* table = NULL;
+	ClassIndexUpdate update;
+
+	if ((getState() != MANAGER_STATE_STARTED) || _isRunningNested) {
+		return 0;
+	}
+	if (lockHashTable(currentThread, "updateClassIndex")) {
+		ClassIndexLayer* layer = getClassIndexLayer(currentThread, cache, false);
+
+		if (NULL != layer) {
+			table = layer->table;
+		}
+		unlockHashTable(currentThread, "updateClassIndex");
+	}
+	if (NULL == table) {
+		return 0;
+	}
+	/* The table can only be freed by a reset, which also requires the cache write mutex */
+	update.manager = this;
+	update.currentThread = currentThread;
+	return cache->updateClassIndex(currentThread, table, SH_ROMClassManagerImpl::classIndexItemHashFn, &update);
+}
+
+void
+SH_ROMClassManagerImpl::getNumDeferredItems(UDATA* nonStaleItems, UDATA* staleItems)
+{
+	UDATA stale = _deferredStaleItems;
+	UDATA deferred = _deferredItems;
+
+	*staleItems = stale;
+	*nonStaleItems = (deferred > stale) ? (deferred - stale) : 0;
+}
+
+/* The length of the part of a class name used as a hashtable key. Lambda classes are keyed without their index number. */
+U_16
+SH_ROMClassManagerImpl::getIndexedNameLength(const J9UTF8* name)
+{
+	U_16 nameLen = J9UTF8_LENGTH(name);
+	char* end = getLastDollarSignOfLambdaClassName((const char*)J9UTF8_DATA(name), nameLen);
+
+	if (NULL != end) {
+		nameLen = (U_16)(end - (char*)J9UTF8_DATA(name) + 1);
+	}
+	return nameLen;
+}
+
+/* The hash a class name is indexed under. 0 is reserved to mean that an item is not indexed. */
+U_32
+SH_ROMClassManagerImpl::classIndexNameHash(J9InternalVMFunctions* internalFunctionTable, const char* name, U_16 nameLen)
+{
+	U_32 nameHash = (U_32)generateHash(internalFunctionTable, (U_8*)name, nameLen);
+
+	return (0 == nameHash) ? 1 : nameHash;
+}
+
+/* Called by SH_CompositeCacheImpl::updateClassIndex() for each item committed to the cache */
+U_32
+SH_ROMClassManagerImpl::classIndexItemHashFn(const ShcItem* item, void* userData)
+{
+	ClassIndexUpdate* update = (ClassIndexUpdate*)userData;
+	UDATA itemType = ITEMTYPE(item);
+	J9UTF8* utf8Name = NULL;
+
+	if ((TYPE_ROMCLASS != itemType) && (TYPE_ORPHAN != itemType) && (TYPE_SCOPED_ROMCLASS != itemType)) {
+		return 0;
+	}
+	utf8Name = J9ROMCLASS_CLASSNAME(update->manager->getROMClassForItem(item));
+	return classIndexNameHash(update->currentThread->javaVM->internalVMFunctions, (const char*)J9UTF8_DATA(utf8Name), getIndexedNameLength(utf8Name));
+}
+
+/* Hash function for the class index. The name hash is stored in the entry, so it is simply read back. */
+UDATA
+SH_ROMClassManagerImpl::classIndexHashFn(void* key, void* userData)
+{
+	return ((J9SharedClassIndexEntry*)key)->nameHash;
+}
+
+/**
+ * HashEqual function for the class index
+ *
+ * An entry being added never matches, so all entries with a name hash are kept in the order they were added.
+ * Items are added to the cache at decreasing offsets, so a ClassIndexQuery matches the first entry under its
+ * name hash whose item is below query->belowItemOffset: the next item in cache order.
+ *
+ * @param[in] existingEntry a J9SharedClassIndexEntry in the class index
+ * @param[in] key a J9SharedClassIndexEntry being added, or a ClassIndexQuery
+ */
+UDATA
+SH_ROMClassManagerImpl::classIndexHashEqualFn(void* existingEntry, void* key, void* userData)
+{
+	J9SharedClassIndexEntry* entry = (J9SharedClassIndexEntry*)existingEntry;
+	ClassIndexQuery* query = (ClassIndexQuery*)key;
+	U_32 itemOffset = 0;
+
+	if (0 != query->key.itemOffset) {
+		return 0;
+	}
+	/* Another JVM may be adding this entry. Entries for deferred items were complete before the layer boundary was read. */
+	itemOffset = entry->itemOffset;
+	return (0 != itemOffset) && (entry->nameHash == query->key.nameHash) && (itemOffset < query->belowItemOffset);
+}
+
 /* When an orphan is encountered in the cache, this is added to the hashtable with isOrphan==true. 
  * If a ROMClass entry is found which points to the same ROMClass as the orphan,
  * the hashtable entry should be re-used: The fact that we have an orphan is no longer relevant.
@@ -276,7 +614,7 @@ SH_ROMClassManagerImpl::findNextExisting(J9VMThread* currentThread, void * &find
 
 	if (findNextIterator == NULL) {
 		Trc_SHR_RMI_findNextROMClass_FirstElem_Event(currentThread);
-		walk = hllTableLookup(currentThread, classnameData, classnameLength, true);
+		walk = classIndexLookup(currentThread, classnameData, classnameLength);
 		firstFound = (void *)walk;
 		findNextIterator = (void *)walk;
 	} else {
@@ -338,7 +676,7 @@ SH_ROMClassManagerImpl::findNextExisting(J9VMThread* currentThread, void * &find
 UDATA
 SH_ROMClassManagerImpl::existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen)
 {
-	return (hllTableLookup(currentThread, path, (U_16)pathLen, true) != NULL);	
+	return (classIndexLookup(currentThread, path, (U_16)pathLen) != NULL);	
 }
 
 
@@ -399,7 +737,7 @@ SH_ROMClassManagerImpl::locateROMClass(J9VMThread* currentThread, const char* pa
 	result->foundAtIndex = -1;
 	result->staleCPEI = NULL;
 
-	found = hllTableLookup(currentThread, path, (U_16)pathLen, true);
+	found = classIndexLookup(currentThread, path, (U_16)pathLen);
 
 	if (!found) {
 		/*** NOTHING IS FOUND, TELL THE CALLER THAT IT MIGHT BE WORTH WAITING ***/
@@ -67,6 +67,10 @@ public:
 
 	virtual UDATA existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen);
 
+	virtual UDATA updateClassIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache);
+
+	virtual void getNumDeferredItems(UDATA* nonStaleItems, UDATA* staleItems);
+
 	void runExitCode(void) {};	
 
 protected:
@@ -85,7 +89,8 @@ protected:
 	virtual U_32 getHashTableEntriesFromCacheSize(UDATA cacheSizeBytes);	
 
 	HashLinkedListImpl* localHLLNewInstance(HashLinkedListImpl* memForConstructor) {
-		return new(memForConstructor) HashLinkedListImpl();
+		RcLinkedListImpl* newRLL = (RcLinkedListImpl*)memForConstructor;
+		return (HashLinkedListImpl*) new(newRLL) RcLinkedListImpl();
 	}
 
 #if defined(J9SHR_CACHELET_SUPPORT)
@@ -95,6 +100,46 @@ protected:
 #endif
 	
 private:
+	/**
+	 * The class index of one cache layer, which is read lazily.
+	 *
+	 * ROMClass items whose ShcItemHdr is above the boundary were in the class index when the layer was first read,
+	 * so they are not added to the local hashtable until a class of the same name is looked up.
+	 */
+	struct ClassIndexLayer {
+		SH_CompositeCacheImpl* cache;
+		J9SRPHashTable* table;
+		ShcItemHdr* boundary;
+	};
+
+	/**
+	 * Search key for a class index. An entry being added always has an itemOffset,
+	 * so an itemOffset of 0 tells classIndexHashEqualFn that belowItemOffset is present.
+	 */
+	struct ClassIndexQuery {
+		J9SharedClassIndexEntry key;
+		U_32 belowItemOffset;
+	};
+
+	/**
+	 * userData of classIndexItemHashFn
+	 */
+	struct ClassIndexUpdate {
+		SH_ROMClassManagerImpl* manager;
+		J9VMThread* currentThread;
+	};
+
+	/**
+	 * Link used by the ROMClass manager. Only the value in the link held by the hashtable is used.
+	 */
+	class RcLinkedListImpl : public SH_Manager::HashLinkedListImpl
+	{
+	public:
+		UDATA _indexedLayers;		/* class index layers [0, _indexedLayers) have been read for this name */
+
+		RcLinkedListImpl() : _indexedLayers(0) {}
+	};
+
 	SH_TimestampManager* _tsm;
 	
 	/**
@@ -111,6 +156,34 @@ private:
 	 */
 	J9Pool* _linkedListImplPool;
 
+	ClassIndexLayer _classIndexLayers[J9SH_LAYER_NUM_MAX_VALUE + 1];
+	UDATA _classIndexLayerCount;
+	UDATA _deferredItems;
+	UDATA _deferredStaleItems;
+
+	bool storeItem(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet);
+
+	J9ROMClass* getROMClassForItem(const ShcItem* item);
+
+	ClassIndexLayer* getClassIndexLayer(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, bool setBoundary);
+
+	HashLinkedListImpl* classIndexLookup(J9VMThread* currentThread, const char* name, U_16 nameLen);
+
+	bool readClassIndex(J9VMThread* currentThread, const char* name, U_16 nameLen, UDATA lastLayer);
+
+	bool readClassIndexItem(J9VMThread* currentThread, const ClassIndexLayer* layer, const char* name, U_16 nameLen, const ShcItem* item);
+
+	void clearClassIndexLayers(void);
+
+	static U_16 getIndexedNameLength(const J9UTF8* name);
+
+	static U_32 classIndexNameHash(J9InternalVMFunctions* internalFunctionTable, const char* name, U_16 nameLen);
+
+	static U_32 classIndexItemHashFn(const ShcItem* item, void* userData);
+
+	static UDATA classIndexHashFn(void* key, void* userData);
+
+	static UDATA classIndexHashEqualFn(void* existingEntry, void* key, void* userData);
 
 	bool checkTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, ROMClassWrapper* wrapper, const ShcItem* item);
 
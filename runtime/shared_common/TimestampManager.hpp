@@ -73,6 +73,24 @@ public:
 	 * 					(Contains the current timestamp)
 	 */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper) = 0;
+
+	/*
+	 * Starts caching the timestamps of checked files if -Xshareclasses:cachedTimestampChecks is set.
+	 * Cached timestamps are invalidated when the file system reports a change to the file.
+	 * If the cache cannot be set up, every check reads the timestamp from the file system.
+	 */
+	virtual void startup(J9VMThread* currentThread) = 0;
+
+	/*
+	 * Releases the resources used to cache timestamps
+	 */
+	virtual void cleanup(J9VMThread* currentThread) = 0;
+
+	/*
+	 * Returns the number of timestamp checks answered from the timestamp cache, the number
+	 * of checks which read the timestamp from the file system and the number of file change events received.
+	 */
+	virtual void getTimestampCheckStats(UDATA* checksCached, UDATA* checksPerformed, UDATA* changeEvents) = 0;
 protected:
 	/* - Virtual destructor has been added to avoid compile warnings. 
 	 * - Delete operator added to avoid linkage with C++ runtime libs 
@@ -25,6 +25,19 @@
 #include "ut_j9shr.h"
 #include <string.h>
 
+#if defined(LINUX)
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+
+/* Events which may change the timestamp of a watched file, or replace the file */
+#define TSM_WATCH_EVENTS (IN_ATTRIB | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVE_SELF | IN_DELETE_SELF)
+#define TSM_WATCH_BUFFER_SIZE 4096
+#define TSM_ALL_WATCHES -1
+#endif /* defined(LINUX) */
+
 SH_TimestampManagerImpl*
 SH_TimestampManagerImpl::newInstance(J9JavaVM* vm, SH_TimestampManagerImpl* memForConstructor, J9SharedClassConfig* sharedClassConfig)
 {
@@ -32,6 +45,20 @@ SH_TimestampManagerImpl::newInstance(J9JavaVM* vm, SH_TimestampManagerImpl* memF
 
 	new(newTSM) SH_TimestampManagerImpl();
 	newTSM->_sharedClassConfig = sharedClassConfig;
+	newTSM->_portlib = vm->portLibrary;
+	newTSM->_cachedTimestamps = NULL;
+	newTSM->_cachedTimestampsMutex = NULL;
+	newTSM->_watcherThread = NULL;
+	newTSM->_watchFD = -1;
+	newTSM->_wakeWatcherFDs[0] = -1;
+	newTSM->_wakeWatcherFDs[1] = -1;
+	newTSM->_cachingEnabled = false;
+	newTSM->_watchesExhausted = false;
+	newTSM->_invalidationCount = 0;
+	newTSM->_activeCallers = 0;
+	newTSM->_checksCached = 0;
+	newTSM->_checksPerformed = 0;
+	newTSM->_changeEvents = 0;
 
 	return newTSM;
 }
@@ -85,7 +112,7 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 	if (!pathBufPtr) {
 		return TIMESTAMP_DOES_NOT_EXIST;
 	}
-	current = j9file_lastmod(pathBufPtr);
+	current = getLastModified(currentThread, pathBufPtr);
 	if (doFreeBuffer) {
 		j9mem_free_memory(pathBufPtr);
 	}
@@ -104,4 +131,341 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 	}
 }
 
+/* Returns the last modified time of path, or -1 if it does not exist.
+ * If timestamp caching is enabled, the timestamp of a watched file is read from the file system only
+ * the first time it is checked and again after the file system reports a change to the file.
+ * THREADING: Can be called multi-threaded */
+I_64
+SH_TimestampManagerImpl::getLastModified(J9VMThread* currentThread, const char* path)
+{
+	I_64 lastModified = -1;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+#if defined(LINUX)
+	if (NULL != _cachedTimestampsMutex) {
+		CachedTimestamp dummy;
+		CachedTimestamp* entry = NULL;
+		UDATA invalidationCount = 0;
+		int watchDescriptor = -1;
+		bool cachingEnabled = false;
+
+		dummy._path = (char*)path;
+		dummy._pathLen = strlen(path);
+
+		omrthread_monitor_enter(_cachedTimestampsMutex);
+		cachingEnabled = _cachingEnabled;
+		if (cachingEnabled) {
+			entry = (CachedTimestamp*)hashTableFind(_cachedTimestamps, &dummy);
+			if ((NULL != entry) && entry->_isValid) {
+				lastModified = entry->_timestamp;
+				_checksCached += 1;
+				omrthread_monitor_exit(_cachedTimestampsMutex);
+				Trc_SHR_TMI_getLastModified_Cached(currentThread, path, lastModified);
+				return lastModified;
+			}
+		}
+		_checksPerformed += 1;
+		invalidationCount = _invalidationCount;
+		if (cachingEnabled) {
+			/* cleanup() waits for this caller to finish with _watchFD and _cachedTimestamps */
+			_activeCallers += 1;
+		}
+		omrthread_monitor_exit(_cachedTimestampsMutex);
+
+		if (cachingEnabled && !_watchesExhausted) {
+			/* Add the watch before reading the timestamp so that any later change to the file is reported */
+			watchDescriptor = inotify_add_watch((int)_watchFD, path, TSM_WATCH_EVENTS);
+			if ((-1 == watchDescriptor) && (ENOSPC == errno)) {
+				/* The inotify watch limit is reached, further files are checked on the file system every time */
+				_watchesExhausted = true;
+				Trc_SHR_TMI_getLastModified_WatchesExhausted(currentThread, path);
+			}
+		}
+		lastModified = j9file_lastmod(path);
+
+		if (cachingEnabled) {
+			omrthread_monitor_enter(_cachedTimestampsMutex);
+			/* If anything was invalidated since the watch was added, the change may have been to this file */
+			if ((-1 != watchDescriptor) && (-1 != lastModified) && _cachingEnabled && (invalidationCount == _invalidationCount)) {
+				entry = (CachedTimestamp*)hashTableFind(_cachedTimestamps, &dummy);
+				if (NULL == entry) {
+					char* pathCopy = (char*)j9mem_allocate_memory(dummy._pathLen + 1, J9MEM_CATEGORY_CLASSES);
+
+					if (NULL != pathCopy) {
+						memcpy(pathCopy, path, dummy._pathLen + 1);
+						dummy._path = pathCopy;
+						entry = (CachedTimestamp*)hashTableAdd(_cachedTimestamps, &dummy);
+						if (NULL == entry) {
+							j9mem_free_memory(pathCopy);
+						}
+					}
+				}
+				if (NULL != entry) {
+					entry->_timestamp = lastModified;
+					entry->_watchDescriptor = (I_32)watchDescriptor;
+					entry->_isValid = true;
+				}
+			}
+			_activeCallers -= 1;
+			if ((0 == _activeCallers) && !_cachingEnabled) {
+				omrthread_monitor_notify_all(_cachedTimestampsMutex);
+			}
+			omrthread_monitor_exit(_cachedTimestampsMutex);
+		}
+		return lastModified;
+	}
+#endif /* defined(LINUX) */
+
+	lastModified = j9file_lastmod(path);
+	return lastModified;
+}
+
+/**
+ * Starts the inotify watcher thread used to invalidate cached timestamps.
+ * Timestamp caching is only available on Linux. It is off by default because inotify
+ * does not report changes made to files on network file systems by other hosts.
+ *
+ * @param [in] currentThread The current thread
+ */
+void
+SH_TimestampManagerImpl::startup(J9VMThread* currentThread)
+{
+#if defined(LINUX)
+	J9JavaVM* vm = currentThread->javaVM;
+
+	if ((NULL == vm->sharedCacheAPI) || (0 == vm->sharedCacheAPI->cachedTimestampChecks) || (NULL != _cachedTimestampsMutex)) {
+		return;
+	}
+
+	Trc_SHR_TMI_startup_Entry(currentThread);
+
+	if (0 != omrthread_monitor_init(&_cachedTimestampsMutex, 0)) {
+		_cachedTimestampsMutex = NULL;
+		Trc_SHR_TMI_startup_Exit_Failed(currentThread, 0);
+		return;
+	}
+	_cachedTimestamps = hashTableNew(OMRPORT_FROM_J9PORT(_portlib), J9_GET_CALLSITE(), 0, sizeof(CachedTimestamp), sizeof(char *), 0, J9MEM_CATEGORY_CLASSES, cachedTimestampHashFn, cachedTimestampHashEqualFn, NULL, (void*)vm->internalVMFunctions);
+	if (NULL == _cachedTimestamps) {
+		Trc_SHR_TMI_startup_Exit_Failed(currentThread, 0);
+		goto fail;
+	}
+	_watchFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (-1 == _watchFD) {
+		Trc_SHR_TMI_startup_Exit_Failed(currentThread, errno);
+		goto fail;
+	}
+	{
+		int wakeWatcherFDs[2];
+
+		if (-1 == pipe2(wakeWatcherFDs, O_CLOEXEC)) {
+			Trc_SHR_TMI_startup_Exit_Failed(currentThread, errno);
+			goto fail;
+		}
+		_wakeWatcherFDs[0] = wakeWatcherFDs[0];
+		_wakeWatcherFDs[1] = wakeWatcherFDs[1];
+	}
+
+	omrthread_monitor_enter(_cachedTimestampsMutex);
+	_cachingEnabled = true;
+	if (0 != omrthread_create(&_watcherThread, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, 0, watcherThreadProc, this)) {
+		_watcherThread = NULL;
+		_cachingEnabled = false;
+		omrthread_monitor_exit(_cachedTimestampsMutex);
+		Trc_SHR_TMI_startup_Exit_Failed(currentThread, 0);
+		goto fail;
+	}
+	omrthread_monitor_exit(_cachedTimestampsMutex);
+
+	Trc_SHR_TMI_startup_Exit(currentThread);
+	return;
+
+fail:
+	cleanup(currentThread);
+#endif /* defined(LINUX) */
+}
+
+/**
+ * Stops the inotify watcher thread, waits for the callers of getLastModified() that are
+ * using the inotify instance to finish, and frees the cached timestamps.
+ *
+ * @param [in] currentThread The current thread
+ */
+void
+SH_TimestampManagerImpl::cleanup(J9VMThread* currentThread)
+{
+#if defined(LINUX)
+	if (NULL == _cachedTimestampsMutex) {
+		return;
+	}
+
+	omrthread_monitor_enter(_cachedTimestampsMutex);
+	_cachingEnabled = false;
+	if (NULL != _watcherThread) {
+		char wake = 0;
+
+		while ((-1 == write((int)_wakeWatcherFDs[1], &wake, 1)) && (EINTR == errno)) {}
+		while (NULL != _watcherThread) {
+			omrthread_monitor_wait(_cachedTimestampsMutex);
+		}
+	}
+	/* Callers that see _cachingEnabled false no longer touch _watchFD or _cachedTimestamps */
+	while (0 != _activeCallers) {
+		omrthread_monitor_wait(_cachedTimestampsMutex);
+	}
+	omrthread_monitor_exit(_cachedTimestampsMutex);
+
+	if (-1 != _wakeWatcherFDs[0]) {
+		close((int)_wakeWatcherFDs[0]);
+		close((int)_wakeWatcherFDs[1]);
+		_wakeWatcherFDs[0] = -1;
+		_wakeWatcherFDs[1] = -1;
+	}
+	if (-1 != _watchFD) {
+		/* Closing the inotify instance removes all of its watches */
+		close((int)_watchFD);
+		_watchFD = -1;
+	}
+	if (NULL != _cachedTimestamps) {
+		hashTableForEachDo(_cachedTimestamps, cachedTimestampFree, (void*)_portlib);
+		hashTableFree(_cachedTimestamps);
+		_cachedTimestamps = NULL;
+	}
+	omrthread_monitor_destroy(_cachedTimestampsMutex);
+	_cachedTimestampsMutex = NULL;
+#endif /* defined(LINUX) */
+}
+
+void
+SH_TimestampManagerImpl::getTimestampCheckStats(UDATA* checksCached, UDATA* checksPerformed, UDATA* changeEvents)
+{
+	*checksCached = 0;
+	*checksPerformed = 0;
+	*changeEvents = 0;
+
+	if (NULL != _cachedTimestampsMutex) {
+		omrthread_monitor_enter(_cachedTimestampsMutex);
+		*checksCached = _checksCached;
+		*checksPerformed = _checksPerformed;
+		*changeEvents = _changeEvents;
+		omrthread_monitor_exit(_cachedTimestampsMutex);
+	}
+}
+
+#if defined(LINUX)
+/* Marks the cached timestamps of the files watched by watchDescriptor as invalid,
+ * or all cached timestamps if watchDescriptor is TSM_ALL_WATCHES.
+ * THREADING: Must be called with _cachedTimestampsMutex held */
+void
+SH_TimestampManagerImpl::invalidateCachedTimestamps(I_32 watchDescriptor)
+{
+	hashTableForEachDo(_cachedTimestamps, cachedTimestampInvalidate, (void*)&watchDescriptor);
+	_invalidationCount += 1;
+}
+
+/* Reads inotify events and invalidates the cached timestamps of the files they report.
+ * Runs until cleanup() writes to the wake pipe, or until the inotify instance fails, after which
+ * timestamps are no longer cached. */
+int J9THREAD_PROC
+SH_TimestampManagerImpl::watcherThreadProc(void* entryArg)
+{
+	SH_TimestampManagerImpl* tsm = (SH_TimestampManagerImpl*)entryArg;
+	union {
+		struct inotify_event event;
+		char bytes[TSM_WATCH_BUFFER_SIZE];
+	} buffer;
+	struct pollfd pollFDs[2];
+
+	pollFDs[0].fd = (int)tsm->_watchFD;
+	pollFDs[0].events = POLLIN;
+	pollFDs[1].fd = (int)tsm->_wakeWatcherFDs[0];
+	pollFDs[1].events = POLLIN;
+
+	for (;;) {
+		pollFDs[0].revents = 0;
+		pollFDs[1].revents = 0;
+		if (-1 == poll(pollFDs, 2, -1)) {
+			if (EINTR == errno) {
+				continue;
+			}
+			break;
+		}
+		if (0 != pollFDs[1].revents) {
+			break;
+		}
+		if (J9_ARE_ANY_BITS_SET(pollFDs[0].revents, POLLIN)) {
+			ssize_t bytesRead = read(pollFDs[0].fd, buffer.bytes, sizeof(buffer.bytes));
+
+			if (bytesRead <= 0) {
+				if ((-1 == bytesRead) && ((EAGAIN == errno) || (EINTR == errno))) {
+					continue;
+				}
+				break;
+			}
+			omrthread_monitor_enter(tsm->_cachedTimestampsMutex);
+			for (char* cursor = buffer.bytes; cursor < (buffer.bytes + bytesRead);) {
+				struct inotify_event* event = (struct inotify_event*)cursor;
+
+				tsm->_changeEvents += 1;
+				if (J9_ARE_ANY_BITS_SET(event->mask, IN_Q_OVERFLOW)) {
+					/* Events were lost, so any cached timestamp may be out of date */
+					tsm->invalidateCachedTimestamps(TSM_ALL_WATCHES);
+				} else {
+					tsm->invalidateCachedTimestamps((I_32)event->wd);
+				}
+				cursor += sizeof(struct inotify_event) + event->len;
+			}
+			omrthread_monitor_exit(tsm->_cachedTimestampsMutex);
+		} else if (0 != pollFDs[0].revents) {
+			break;
+		}
+	}
+
+	omrthread_monitor_enter(tsm->_cachedTimestampsMutex);
+	/* Without the watcher the cached timestamps can no longer be trusted */
+	tsm->_cachingEnabled = false;
+	tsm->_watcherThread = NULL;
+	omrthread_monitor_notify_all(tsm->_cachedTimestampsMutex);
+	omrthread_exit(tsm->_cachedTimestampsMutex);
+	return 0;
+}
+
+UDATA
+SH_TimestampManagerImpl::cachedTimestampHashFn(void* item, void* userData)
+{
+	CachedTimestamp* itemValue = (CachedTimestamp*)item;
+	J9InternalVMFunctions* internalFunctionTable = (J9InternalVMFunctions*)userData;
+
+	return internalFunctionTable->computeHashForUTF8((U_8*)itemValue->_path, itemValue->_pathLen);
+}
+
+UDATA
+SH_TimestampManagerImpl::cachedTimestampHashEqualFn(void* left, void* right, void* userData)
+{
+	CachedTimestamp* leftItem = (CachedTimestamp*)left;
+	CachedTimestamp* rightItem = (CachedTimestamp*)right;
+
+	return ((leftItem->_pathLen == rightItem->_pathLen) && (0 == memcmp(leftItem->_path, rightItem->_path, leftItem->_pathLen)));
+}
+
+UDATA
+SH_TimestampManagerImpl::cachedTimestampInvalidate(void* entry, void* userData)
+{
+	CachedTimestamp* cachedTimestamp = (CachedTimestamp*)entry;
+	I_32 watchDescriptor = *(I_32*)userData;
 
+	if ((TSM_ALL_WATCHES == watchDescriptor) || (cachedTimestamp->_watchDescriptor == watchDescriptor)) {
+		cachedTimestamp->_isValid = false;
+	}
+	return FALSE; /* don't remove entry */
+}
+
+UDATA
+SH_TimestampManagerImpl::cachedTimestampFree(void* entry, void* userData)
+{
+	CachedTimestamp* cachedTimestamp = (CachedTimestamp*)entry;
+	PORT_ACCESS_FROM_PORT((J9PortLibrary*)userData);
+
+	j9mem_free_memory(cachedTimestamp->_path);
+	return FALSE; /* hashTableFree() frees the entry */
+}
+#endif /* defined(LINUX) */
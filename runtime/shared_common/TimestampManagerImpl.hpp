@@ -56,10 +56,51 @@ public:
 	/* @see TimestampManager.hpp */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper);
 
+	/* @see TimestampManager.hpp */
+	virtual void startup(J9VMThread* currentThread);
+
+	/* @see TimestampManager.hpp */
+	virtual void cleanup(J9VMThread* currentThread);
+
+	/* @see TimestampManager.hpp */
+	virtual void getTimestampCheckStats(UDATA* checksCached, UDATA* checksPerformed, UDATA* changeEvents);
+
 private:
 
+	typedef struct CachedTimestamp {
+		char* _path;
+		UDATA _pathLen;
+		I_64 _timestamp;
+		I_32 _watchDescriptor;
+		bool _isValid;
+	} CachedTimestamp;
+
 	I_64 localCheckTimeStamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, const char* className, UDATA classNameLen, ROMClassWrapper* rcWrapper);
+	I_64 getLastModified(J9VMThread* currentThread, const char* path);
+#if defined(LINUX)
+	void invalidateCachedTimestamps(I_32 watchDescriptor);
+
+	static int J9THREAD_PROC watcherThreadProc(void* entryArg);
+	static UDATA cachedTimestampHashFn(void* item, void* userData);
+	static UDATA cachedTimestampHashEqualFn(void* left, void* right, void* userData);
+	static UDATA cachedTimestampInvalidate(void* entry, void* userData);
+	static UDATA cachedTimestampFree(void* entry, void* userData);
+#endif /* defined(LINUX) */
+
 	J9SharedClassConfig* _sharedClassConfig;
+	J9PortLibrary* _portlib;
+	J9HashTable* _cachedTimestamps;
+	omrthread_monitor_t _cachedTimestampsMutex;
+	omrthread_t _watcherThread;
+	IDATA _watchFD;
+	IDATA _wakeWatcherFDs[2];
+	bool _cachingEnabled;
+	bool _watchesExhausted;
+	UDATA _invalidationCount;
+	UDATA _activeCallers;
+	UDATA _checksCached;
+	UDATA _checksPerformed;
+	UDATA _changeEvents;
 };
 
 #endif /* !defined(TIMESTAMPMANAGERIMPL_HPP_INCLUDED) */
@@ -73,6 +73,7 @@ extern "C" {
 
 #include "hookhelpers.hpp"
 #include "CacheLifecycleManager.hpp"
+#include "CacheSnapshot.hpp"
 #include "CacheMap.hpp"
 #include "OSCacheFile.hpp"
 #include "SCImplementedAPI.hpp"
@@ -198,6 +199,8 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	HELPTEXT_NEWLINE,
 #endif
 	{OPTION_LISTALLCACHES, J9NLS_SHRC_SHRINIT_HELPTEXT_LISTALLCACHES, 0, 0},
+	{HELPTEXT_EXPORT_SNAPSHOT_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_EXPORT_SNAPSHOT, 0, 0},
+	{HELPTEXT_IMPORT_SNAPSHOT_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_IMPORT_SNAPSHOT, 0, 0},
 	{HELPTEXT_PRINTSTATS_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_PRINTSTATS_2, 0, 0},
 #if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
 	{HELPTEXT_OPTION_PRINT_TOP_LAYER_STATS, J9NLS_SHRC_SHRINIT_HELPTEXT_PRINT_TOP_LAYER_STATS, 0, 0},
@@ -265,6 +268,11 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	{OPTION_CREATE_LAYER, J9NLS_SHRC_SHRINIT_HELPTEXT_CREATE_LAYER, 0, 0},
 #endif /* J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE */
 	{OPTION_NO_TIMESTAMP_CHECKS, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_TIMESTAMP_CHECKS_V1, 0, 0},
+	{OPTION_CACHED_TIMESTAMP_CHECKS, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_CACHED_TIMESTAMP_CHECKS},
+	{OPTION_HEAP_ARCHIVE, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_HEAP_ARCHIVE},
+	{OPTION_HUGE_PAGES, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_HUGE_PAGES},
+	{OPTION_NUMA_INTERLEAVE, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NUMA_INTERLEAVE},
+	{OPTION_PRELOAD_CLASSES, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_PRELOAD_CLASSES},
 	{OPTION_NO_URL_TIMESTAMP_CHECK, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_URL_TIMESTAMP_CHECK},
 	{OPTION_URL_TIMESTAMP_CHECK, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_URL_TIMESTAMP_CHECK},
 	{OPTION_NO_CLASSPATH_CACHEING, 0, 0, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_CLASSPATH_CACHEING},
@@ -309,6 +317,11 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_PRINTALLSTATS, PARSE_TYPE_EXACT, RESULT_DO_PRINTALLSTATS, 0},
 	{ OPTION_PRINTALLSTATS_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_PRINTALLSTATS_EQUALS, 0},
 	{ OPTION_NO_TIMESTAMP_CHECKS, PARSE_TYPE_EXACT, RESULT_DO_REMOVE_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_ENABLE_TIMESTAMP_CHECKS},
+	{ OPTION_CACHED_TIMESTAMP_CHECKS, PARSE_TYPE_EXACT, RESULT_DO_CACHED_TIMESTAMP_CHECKS, 0},
+	{ OPTION_HEAP_ARCHIVE, PARSE_TYPE_EXACT, RESULT_DO_HEAP_ARCHIVE, 0},
+	{ OPTION_HUGE_PAGES, PARSE_TYPE_EXACT, RESULT_DO_HUGE_PAGES, 0},
+	{ OPTION_NUMA_INTERLEAVE, PARSE_TYPE_EXACT, RESULT_DO_NUMA_INTERLEAVE, 0},
+	{ OPTION_PRELOAD_CLASSES, PARSE_TYPE_EXACT, RESULT_DO_PRELOAD_CLASSES, 0},
 	{ OPTION_NO_CLASSPATH_CACHEING, PARSE_TYPE_EXACT, RESULT_DO_REMOVE_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_ENABLE_LOCAL_CACHEING},
 	{ OPTION_NO_REDUCE_STORE_CONTENTION, PARSE_TYPE_EXACT, RESULT_DO_REMOVE_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_ENABLE_REDUCE_STORE_CONTENTION},
 	{ OPTION_VERBOSE, PARSE_TYPE_EXACT, RESULT_DO_ADD_VERBOSEFLAG, J9SHR_VERBOSEFLAG_ENABLE_VERBOSE},
@@ -389,6 +402,8 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_CREATE_LAYER, PARSE_TYPE_EXACT, RESULT_DO_CREATE_LAYER, 0 },
 #endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
 	{ OPTION_NO_PERSISTENT_DISK_SPACE_CHECK, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_NO_PERSISTENT_DISK_SPACE_CHECK},
+	{ OPTION_EXPORT_SNAPSHOT_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_EXPORT_SNAPSHOT_EQUALS, J9SHR_RUNTIMEFLAG_DO_NOT_CREATE_CACHE},
+	{ OPTION_IMPORT_SNAPSHOT_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_IMPORT_SNAPSHOT_EQUALS, 0},
 	{ NULL, 0, 0 }
 };
 
@@ -413,7 +428,6 @@ static IDATA checkIfCacheExists(J9JavaVM* vm, const char* ctrlDirName, char* cac
 static bool isClassFromPatchedModule(J9VMThread* vmThread, J9Module *j9module, U_8* className, UDATA classNameLength, J9ClassLoader* classLoader);
 static J9Module* getModule(J9VMThread* vmThread, U_8* className, UDATA classNameLength, J9ClassLoader* classLoader);
 static bool isFreeDiskSpaceLow(J9JavaVM *vm, U_64* maxsize, U_64 runtimeFlags);
-static char* generateStartupHintsKey(J9JavaVM *vm);
 static void fetchStartupHintsFromSharedCache(J9VMThread* vmThread);
 static void findExistingCacheLayerNumbers(J9JavaVM* vm, const char* ctrlDirName, const char* cacheName, U_64 runtimeFlags, I_8 *maxLayerNo);
 
@@ -594,7 +608,7 @@ recoverMethodSpecSeparator(char* string, char* end)
 
 UDATA
 parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, UDATA* verboseFlags, char** cacheName,
-		char** modContext, char** expireTime, char** ctrlDirName, char **cacheDirPerm, char** methodSpecs, UDATA* printStatsOptions, UDATA* storageKeyTesting)
+		char** modContext, char** expireTime, char** ctrlDirName, char **cacheDirPerm, char** methodSpecs, char** snapshotFile, UDATA* printStatsOptions, UDATA* storageKeyTesting)
 {
 	UDATA returnAction = 0;
 	PORT_ACCESS_FROM_JAVAVM(vm);
@@ -705,6 +719,31 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, UDATA* verboseFlags,
 			vm->sharedCacheAPI->layer = SHRINIT_CREATE_NEW_LAYER;
 			break;
 		}
+		case RESULT_DO_CACHED_TIMESTAMP_CHECKS:
+		{
+			vm->sharedCacheAPI->cachedTimestampChecks = TRUE;
+			break;
+		}
+		case RESULT_DO_HEAP_ARCHIVE:
+		{
+			vm->sharedCacheAPI->heapArchive = TRUE;
+			break;
+		}
+		case RESULT_DO_HUGE_PAGES:
+		{
+			vm->sharedCacheAPI->hugePages = TRUE;
+			break;
+		}
+		case RESULT_DO_NUMA_INTERLEAVE:
+		{
+			vm->sharedCacheAPI->numaInterleave = TRUE;
+			break;
+		}
+		case RESULT_DO_PRELOAD_CLASSES:
+		{
+			vm->sharedCacheAPI->preloadClasses = TRUE;
+			break;
+		}
 		case RESULT_DO_ADJUST_SOFTMX_EQUALS:
 		case RESULT_DO_ADJUST_MINAOT_EQUALS:
 		case RESULT_DO_ADJUST_MAXAOT_EQUALS:
@@ -755,6 +794,14 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, UDATA* verboseFlags,
 			options += strlen(OPTION_CACHEDIRPERM_EQUALS)+strlen(*cacheDirPerm)+1;
 			continue;
 
+		case RESULT_DO_EXPORT_SNAPSHOT_EQUALS:
+		case RESULT_DO_IMPORT_SNAPSHOT_EQUALS:
+			*runtimeFlags |= J9SHAREDCLASSESOPTIONS[i].flag;
+			*snapshotFile = options + strlen(J9SHAREDCLASSESOPTIONS[i].option);
+			options += strlen(J9SHAREDCLASSESOPTIONS[i].option) + strlen(*snapshotFile) + 1;
+			returnAction = J9SHAREDCLASSESOPTIONS[i].action;
+			continue;
+
 		case RESULT_DO_MPROTECT_EQUALS:
 			tempStr = options + strlen(OPTION_MPROTECT_EQUALS);
 			if (0 == strcmp(tempStr, SUB_OPTION_MPROTECT_NONE)) {
@@ -1765,6 +1812,27 @@ j9shr_getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor* descrip
 	return 0;
 }
 
+/**
+ * Copies the counters of the shared cache lookups made by this JVM
+ *
+ * @param[in] vm  The Java VM
+ * @param[out] stats  The struct to fill with the counters, zeroed if there is no cache
+ */
+void
+j9shr_getLookupStats(J9JavaVM* vm, J9SharedCacheLookupStats* stats)
+{
+	SH_CacheMap* cm = NULL;
+
+	if (NULL != vm->sharedClassConfig) {
+		cm = (SH_CacheMap*)vm->sharedClassConfig->sharedClassCache;
+	}
+	if (NULL != cm) {
+		cm->getLookupStats(stats);
+	} else {
+		memset(stats, 0, sizeof(J9SharedCacheLookupStats));
+	}
+}
+
 /**
  * Peeks to see whether compiled code exists for a given ROMMethod in the CompiledMethodManager hashtable
  *
@@ -2011,17 +2079,21 @@ j9shr_storeAttachedData(J9VMThread* currentThread, const void* addressInCache, c
 		return J9SHR_RESOURCE_STORE_ERROR;
 	}
 
-	if (localRuntimeFlags & J9SHR_RUNTIMEFLAG_JIT_SPACE_FULL) {
-		Trc_SHR_INIT_storeAttachedData_exit_CacheFull(currentThread);
-		return J9SHR_RESOURCE_STORE_FULL;
-	}
-
 	if ((J9SHR_ATTACHED_DATA_TYPE_JITPROFILE != data->type)
-		&& (J9SHR_ATTACHED_DATA_TYPE_JITHINT != data->type)) {
+		&& (J9SHR_ATTACHED_DATA_TYPE_JITHINT != data->type)
+		&& (J9SHR_ATTACHED_DATA_TYPE_VERIFICATION != data->type)) {
 		Trc_SHR_INIT_storeAttachedData_exit_TypeUnknown(currentThread, data->type);
 		return J9SHR_RESOURCE_PARAMETER_ERROR;
 	}
 
+	/* Verification data is keyed by a ROMClass and stored in the block data area, JIT data in the JIT area */
+	if (((J9SHR_ATTACHED_DATA_TYPE_VERIFICATION == data->type) && J9_ARE_ANY_BITS_SET(localRuntimeFlags, J9SHR_RUNTIMEFLAG_BLOCK_SPACE_FULL))
+		|| ((J9SHR_ATTACHED_DATA_TYPE_VERIFICATION != data->type) && J9_ARE_ANY_BITS_SET(localRuntimeFlags, J9SHR_RUNTIMEFLAG_JIT_SPACE_FULL))
+	) {
+		Trc_SHR_INIT_storeAttachedData_exit_CacheFull(currentThread);
+		return J9SHR_RESOURCE_STORE_FULL;
+	}
+
 	if (J9SHR_ATTACHED_DATA_NO_FLAGS != data->flags) {
 		Trc_SHR_INIT_storeAttachedData_exit_FlagErr(currentThread, data->flags);
 		return J9SHR_RESOURCE_PARAMETER_ERROR;
@@ -2545,6 +2617,28 @@ performSharedClassesCommandLineAction(J9JavaVM* vm, J9SharedClassConfig* sharedC
 	case RESULT_DO_LISTALLCACHES:
 		j9shr_list_caches(vm, sharedClassConfig->ctrlDirName, groupPerm, verboseFlags);
 		break;
+	case RESULT_DO_EXPORT_SNAPSHOT_EQUALS:
+	case RESULT_DO_IMPORT_SNAPSHOT_EQUALS:
+		if (J9PORT_SHR_CACHE_TYPE_PERSISTENT != cacheType) {
+			/* Only persistent caches are backed by a file that can be exported or created from a snapshot */
+			const char *optionName = (RESULT_DO_EXPORT_SNAPSHOT_EQUALS == command) ? OPTION_EXPORT_SNAPSHOT_EQUALS : OPTION_IMPORT_SNAPSHOT_EQUALS;
+			SHRINIT_ERR_TRACE2(verboseFlags, J9NLS_SHRC_SHRINIT_OTHER_PERS_TYPE_CACHE_EXISTS, optionName, cacheName);
+			break;
+		}
+		if (RESULT_DO_EXPORT_SNAPSHOT_EQUALS == command) {
+			if (1 != checkIfCacheExists(vm, sharedClassConfig->ctrlDirName, cacheDirName, cacheName, &versionData, cacheType, layer)) {
+				SHRINIT_ERR_TRACE2(verboseFlags, J9NLS_SHRC_SHRINIT_FAILURE_EXPORT_SNAPSHOT, cacheName, vm->sharedCacheAPI->snapshotFile);
+			} else {
+				return J9VMDLLMAIN_OK;
+			}
+		} else {
+			if (0 == j9shr_import_snapshot(vm, sharedClassConfig->ctrlDirName, runtimeFlags, verboseFlags, cacheName, vm->sharedCacheAPI->snapshotFile)) {
+				SHRINIT_TRACE2(verboseFlags, J9NLS_SHRC_SHRINIT_SUCCESS_IMPORT_SNAPSHOT, cacheName, vm->sharedCacheAPI->snapshotFile);
+			} else {
+				SHRINIT_ERR_TRACE2(verboseFlags, J9NLS_SHRC_SHRINIT_FAILURE_IMPORT_SNAPSHOT, cacheName, vm->sharedCacheAPI->snapshotFile);
+			}
+		}
+		break;
 	case RESULT_DO_EXPIRE:
 		/**
 		 * Stop to expire cache for the option "expire=" if the runtime flag for the Tenant mode is set,
@@ -3284,6 +3378,10 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 		}
 	}
 
+	if (RESULT_DO_IMPORT_SNAPSHOT_EQUALS == parseResult) {
+		/* An imported cache has the size it was exported with, so keep any size requested before the default is applied */
+		vm->sharedCacheAPI->snapshotCacheSize = piconfig->sharedClassCacheSize;
+	}
 	if (ensureCorrectCacheSizes(vm, vm->portLibrary, runtimeFlags, verboseFlags, piconfig) != 0) {
 		goto _error;
 	}
@@ -3539,6 +3637,27 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 		config->findGCHints = j9shr_findGCHints;
 		config->storeGCHints = j9shr_storeGCHints;
 		config->updateClasspathOpenState = j9shr_updateClasspathOpenState;
+		config->getLookupStats = j9shr_getLookupStats;
+
+		/* The archived static fields of bootstrap classes are only stored by a JVM which can write to the cache */
+		config->heapArchivePending = NULL;
+		config->initializeFromHeapArchive = NULL;
+		if (vm->sharedCacheAPI->heapArchive && J9_ARE_NO_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_STATS)) {
+			config->initializeFromHeapArchive = j9shr_initializeFromHeapArchive;
+			if (J9_ARE_NO_BITS_SET(config->runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY)) {
+				config->heapArchivePending = pool_new(sizeof(J9Class*), 0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_CLASSES, POOL_FOR_PORT(vm->portLibrary));
+				if (NULL == config->heapArchivePending) {
+					SHRINIT_ERR_TRACE(verboseFlags, J9NLS_SHRC_SHRINIT_FAILURE_CREATE_POOL);
+					goto _error;
+				}
+			}
+		}
+
+		/* Preloading is only an optimization, so the JVM starts without it if its state cannot be allocated */
+		config->classPreloader = NULL;
+		if (vm->sharedCacheAPI->preloadClasses && J9_ARE_NO_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_STATS)) {
+			j9shr_createClassPreloader(vm);
+		}
 
 		config->sharedAPIObject = initializeSharedAPI(vm);
 		if (config->sharedAPIObject == NULL) {
@@ -3548,6 +3667,14 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 
 		/* Register hooks */
 		(*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_FIND_LOCALLY_DEFINED_CLASS, hookFindSharedClass, OMR_GET_CALLSITE(), NULL);
+		if (NULL != config->heapArchivePending) {
+			(*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_CLASS_INITIALIZE, hookStoreHeapArchive, OMR_GET_CALLSITE(), NULL);
+			(*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_CLASS_INITIALIZE_FAILED, hookDiscardHeapArchive, OMR_GET_CALLSITE(), NULL);
+		}
+		if (NULL != config->classPreloader) {
+			(*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_INITIALIZED, hookStartClassPreload, OMR_GET_CALLSITE(), NULL);
+			(*hook)->J9HookRegisterWithCallSite(hook, J9HOOK_VM_SHUTTING_DOWN, hookStopClassPreload, OMR_GET_CALLSITE(), NULL);
+		}
 
 #if defined(J9SHR_CACHELET_SUPPORT)
 		if (runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_NESTED) {
@@ -3786,6 +3913,16 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 		returnVal = J9VMDLLMAIN_SILENT_EXIT_VM;
 	}
 
+	if (RESULT_DO_EXPORT_SNAPSHOT_EQUALS == parseResult) {
+		*nonfatal = 0;
+		if (0 == j9shr_export_snapshot(vm, cacheName, vm->sharedCacheAPI->snapshotFile)) {
+			SHRINIT_TRACE2(verboseFlags, J9NLS_SHRC_SHRINIT_SUCCESS_EXPORT_SNAPSHOT, cacheName, vm->sharedCacheAPI->snapshotFile);
+		} else {
+			SHRINIT_ERR_TRACE2(verboseFlags, J9NLS_SHRC_SHRINIT_FAILURE_EXPORT_SNAPSHOT, cacheName, vm->sharedCacheAPI->snapshotFile);
+		}
+		returnVal = J9VMDLLMAIN_SILENT_EXIT_VM;
+	}
+
 	if ((RESULT_DO_ADJUST_SOFTMX_EQUALS == parseResult)
 		|| (RESULT_DO_ADJUST_MINAOT_EQUALS == parseResult)
 		|| (RESULT_DO_ADJUST_MAXAOT_EQUALS == parseResult)
@@ -4108,6 +4245,15 @@ j9shr_guaranteed_exit(J9JavaVM *vm, BOOLEAN exitForDebug)
 			 */
 			J9HookInterface** hook = vm->internalVMFunctions->getVMHookInterface(vm);
 			(*hook)->J9HookUnregister(hook, J9HOOK_VM_FIND_LOCALLY_DEFINED_CLASS, hookFindSharedClass, NULL);
+			if (NULL != vm->sharedClassConfig->heapArchivePending) {
+				(*hook)->J9HookUnregister(hook, J9HOOK_VM_CLASS_INITIALIZE, hookStoreHeapArchive, NULL);
+				(*hook)->J9HookUnregister(hook, J9HOOK_VM_CLASS_INITIALIZE_FAILED, hookDiscardHeapArchive, NULL);
+			}
+			if (NULL != vm->sharedClassConfig->classPreloader) {
+				(*hook)->J9HookUnregister(hook, J9HOOK_VM_INITIALIZED, hookStartClassPreload, NULL);
+				(*hook)->J9HookUnregister(hook, J9HOOK_VM_SHUTTING_DOWN, hookStopClassPreload, NULL);
+			}
+			vm->sharedClassConfig->initializeFromHeapArchive = NULL;
 
 #if defined(J9SHR_CACHELET_SUPPORT)
 			if (vm->sharedClassConfig->runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_NESTED) {
@@ -4164,6 +4310,9 @@ j9shr_shutdown(J9JavaVM *vm)
 		if (NULL != vm->sharedCacheAPI->methodSpecs) {
 			j9mem_free_memory(vm->sharedCacheAPI->methodSpecs);
 		}
+		if (NULL != vm->sharedCacheAPI->snapshotFile) {
+			j9mem_free_memory(vm->sharedCacheAPI->snapshotFile);
+		}
 		j9mem_free_memory(vm->sharedCacheAPI);
 	}
 	if (vm->sharedInvariantInternTable != NULL) {
@@ -4181,11 +4330,14 @@ j9shr_shutdown(J9JavaVM *vm)
 		struct J9Pool* urlCachePool = config->jclURLCache;
 		struct J9Pool* j9ClassPathEntryPool = config->jclJ9ClassPathEntryPool;
 		struct J9Pool* classnameFilterPool = config->classnameFilterPool;
+		struct J9Pool* heapArchivePending = config->heapArchivePending;
 		J9SharedStringFarm* jclStringFarm = config->jclStringFarm;
 		J9HashTable* urlHashTable = config->jclURLHashTable;
 		J9HashTable* utfHashTable = config->jclUTF8HashTable;
 		J9VMThread* currentThread = vm->internalVMFunctions->currentVMThread(vm);
 
+		j9shr_destroyClassPreloader(vm);
+
 		/* Free all of the cached ClasspathItems */
 
 		freeClasspathItemsForPool(vm, cpCachePool, TRUE);
@@ -4222,6 +4374,9 @@ j9shr_shutdown(J9JavaVM *vm)
 		if (classnameFilterPool) {
 			freeStoreFilterPool(vm, classnameFilterPool);
 		}
+		if (heapArchivePending) {
+			pool_kill(heapArchivePending);
+		}
 		if (urlHashTable) {
 			hashTableFree(urlHashTable);
 		}
@@ -4954,9 +5109,11 @@ j9shr_jvmPhaseChange(J9VMThread *currentThread, UDATA phase)
 		/* OpenJ9 issue; https://github.com/eclipse/openj9/issues/3743
 		 * GC decides whether to calls vm->sharedClassConfig->storeGCHints() to store the GC hints into the shared cache. */
 		storeStartupHintsToSharedCache(currentThread);
+		j9shr_storeClassPreloadList(currentThread);
 		if (J9_ARE_NO_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_MPROTECT_PARTIAL_PAGES_ON_STARTUP)) {
 			((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->protectPartiallyFilledPages(currentThread);
 		}
+		((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->storeStartupPages(currentThread);
 		((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->dontNeedMetadata(currentThread);
 	}
 	return;
@@ -5116,7 +5273,7 @@ done:
  *
  * @return A string of all the commandline arguments, NULL if an error occurs.
  */
-static char*
+char*
 generateStartupHintsKey(J9JavaVM* vm)
 {
 	JavaVMInitArgs *actualArgs = vm->vmArgsArray->actualVMArgs;
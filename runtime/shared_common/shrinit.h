@@ -34,6 +34,7 @@ UDATA j9shr_updateAttachedUDATA(J9VMThread* currentThread, const void* addressIn
 void j9shr_freeAttachedDataDescriptor(J9VMThread* currentThread, J9SharedDataDescriptor* data);
 const U_8* j9shr_storeCompiledMethod(J9VMThread* currentThread, const J9ROMMethod* romMethod, const U_8* dataStart, UDATA dataSize, const U_8* codeStart, UDATA codeSize, UDATA forceReplace);
 UDATA j9shr_getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor* descriptor);
+void j9shr_getLookupStats(J9JavaVM* vm, J9SharedCacheLookupStats* stats);
 IDATA j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal);
 IDATA j9shr_lateInit(J9JavaVM *vm, UDATA* nonfatal);
 IDATA j9shr_sharedClassesFinishInitialization(J9JavaVM *vm);
@@ -45,6 +46,14 @@ void j9shr_updateClasspathOpenState(J9JavaVM* vm, J9ClassPathEntry* classPathEnt
 void hookFindSharedClass(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData);
 void hookSerializeSharedCache(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData);
 void hookStoreSharedClass(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData);
+void hookStoreHeapArchive(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData);
+void hookDiscardHeapArchive(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData);
+void j9shr_initializeFromHeapArchive(J9VMThread* currentThread, J9Class* clazz);
+void hookStartClassPreload(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData);
+void hookStopClassPreload(J9HookInterface** hookInterface, UDATA eventNum, void* voidData, void* userData);
+bool j9shr_createClassPreloader(J9JavaVM* vm);
+void j9shr_destroyClassPreloader(J9JavaVM* vm);
+void j9shr_storeClassPreloadList(J9VMThread* currentThread);
 UDATA j9shr_getCacheSizeBytes(J9JavaVM *vm);
 UDATA j9shr_getTotalUsableCacheBytes(J9JavaVM *vm);
 void j9shr_getMinMaxBytes(J9JavaVM *vm, U_32 *softmx, I_32 *minAOT, I_32 *maxAOT, I_32 *minJIT, I_32 *maxJIT);
@@ -60,7 +69,7 @@ void j9shr_populatePreinitConfigDefaults(J9JavaVM *vm, J9SharedClassPreinitConfi
 BOOLEAN j9shr_isPlatformDefaultPersistent(struct J9JavaVM* vm);
 UDATA j9shr_isBCIEnabled(J9JavaVM *vm);
 UDATA ensureCorrectCacheSizes(J9JavaVM *vm, J9PortLibrary* portlib, U_64 runtimeFlags, UDATA verboseFlags, J9SharedClassPreinitConfig* piconfig);
-UDATA parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, UDATA* verboseFlags, char** cacheName, char** modContext, char** expireTime, char** ctrlDirName, char** cacheDirPerm, char** methodSpecs, UDATA* printStatsOptions, UDATA* storageKeyTesting);
+UDATA parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, UDATA* verboseFlags, char** cacheName, char** modContext, char** expireTime, char** ctrlDirName, char** cacheDirPerm, char** methodSpecs, char** snapshotFile, UDATA* printStatsOptions, UDATA* storageKeyTesting);
 UDATA convertPermToDecimal(J9JavaVM *vm, const char *permStr);
 SCAbstractAPI * initializeSharedAPI(J9JavaVM *vm);
 U_64 getDefaultRuntimeFlags(void);
@@ -71,6 +80,7 @@ void j9shr_jvmPhaseChange(J9VMThread* currentThread, UDATA phase);
 void j9shr_storeGCHints(J9VMThread* currentThread, UDATA heapSize1, UDATA heapSize2, BOOLEAN forceReplace);
 IDATA j9shr_findGCHints(J9VMThread* currentThread, UDATA *heapSize1, UDATA *heapSize2);
 const U_8* storeStartupHintsToSharedCache(J9VMThread* currentThread);
+char* generateStartupHintsKey(J9JavaVM* vm);
 IDATA j9shr_getCacheDir(J9JavaVM* vm, const char* ctrlDirName, char* buffer, UDATA bufferSize, U_32 cacheType);
 U_32 getCacheTypeFromRuntimeFlags(U_64 runtimeFlags);
 
@@ -90,6 +100,11 @@ typedef struct J9SharedClassesOptions {
 } J9SharedClassesOptions;
 
 #define OPTION_NO_TIMESTAMP_CHECKS "noTimestampChecks"
+#define OPTION_CACHED_TIMESTAMP_CHECKS "cachedTimestampChecks"
+#define OPTION_HEAP_ARCHIVE "heapArchive"
+#define OPTION_HUGE_PAGES "hugePages"
+#define OPTION_NUMA_INTERLEAVE "numaInterleave"
+#define OPTION_PRELOAD_CLASSES "preloadClasses"
 #define OPTION_NO_CLASSPATH_CACHEING "noClasspathCacheing"
 #define OPTION_NO_REDUCE_STORE_CONTENTION "noReduceStoreContention"
 #define OPTION_PRINTSTATS "printStats"
@@ -194,6 +209,8 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_LAYER_EQUALS "layer="
 #define OPTION_CREATE_LAYER "createLayer"
 #define OPTION_NO_PERSISTENT_DISK_SPACE_CHECK "noPersistentDiskSpaceCheck"
+#define OPTION_EXPORT_SNAPSHOT_EQUALS "exportSnapshot="
+#define OPTION_IMPORT_SNAPSHOT_EQUALS "importSnapshot="
 
 /* public options for printallstats= and printstats=  */
 #define SUB_OPTION_PRINTSTATS_ALL "all"
@@ -274,6 +291,13 @@ typedef struct J9SharedClassesOptions {
 #define RESULT_DO_CREATE_LAYER 52
 #define RESULT_DO_PRINT_TOP_LAYER_STATS 53
 #define RESULT_DO_PRINT_TOP_LAYER_STATS_EQUALS 54
+#define RESULT_DO_CACHED_TIMESTAMP_CHECKS 55
+#define RESULT_DO_HEAP_ARCHIVE 56
+#define RESULT_DO_HUGE_PAGES 57
+#define RESULT_DO_NUMA_INTERLEAVE 58
+#define RESULT_DO_EXPORT_SNAPSHOT_EQUALS 59
+#define RESULT_DO_IMPORT_SNAPSHOT_EQUALS 60
+#define RESULT_DO_PRELOAD_CLASSES 61
 
 #define PARSE_TYPE_EXACT 1
 #define PARSE_TYPE_STARTSWITH 2
@@ -285,6 +309,8 @@ typedef struct J9SharedClassesOptions {
 #define HELPTEXT_MODIFIEDEQUALS_OPTION OPTION_MODIFIED_EQUALS"<modContext>"
 #define HELPTEXT_CACHEDIR_OPTION OPTION_CACHEDIR_EQUALS"<directory>"
 #define HELPTEXT_CACHEDIRPERM_OPTION OPTION_CACHEDIRPERM_EQUALS"<permission>"
+#define HELPTEXT_EXPORT_SNAPSHOT_OPTION OPTION_EXPORT_SNAPSHOT_EQUALS"<file>"
+#define HELPTEXT_IMPORT_SNAPSHOT_OPTION OPTION_IMPORT_SNAPSHOT_EQUALS"<file>"
 #if defined(J9ZOS390) || defined(AIXPPC)
 #define HELPTEXT_MPROTECTEQUALS_PUBLIC_OPTION OPTION_MPROTECT_EQUALS "[" SUB_OPTION_MPROTECT_ALL "|" SUB_OPTION_MPROTECT_DEF "|" SUB_OPTION_MPROTECT_NONE "]"
 #define HELPTEXT_MPROTECTEQUALS_PARTIAL_PAGES_PRIVATE_OPTION OPTION_MPROTECT_EQUALS "" SUB_OPTION_MPROTECT_PARTIAL_PAGES
@@ -430,3 +430,48 @@ Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC(JNIEnv * env, jclass c
 	(*env)->ReleasePrimitiveArrayCritical(env, array, elems1, 0);
 	return result;
 }
+
+jboolean JNICALL
+Java_j9vm_test_jni_CriticalRegionPinningTest_acquireAndCollect(JNIEnv * env, jclass clazz, jbyteArray array, jlongArray addresses, jboolean global)
+{
+	void* elems1;
+	void* elems2;
+	jlong* addressesElems;
+	jmethodID collectMID;
+	jboolean isCopy;
+	jboolean result = JNI_FALSE;
+
+	collectMID = (*env)->GetStaticMethodID(env, clazz, "collect", "(Z)V");
+	if(NULL == collectMID) {
+		return JNI_FALSE;
+	}
+
+	elems1 = (*env)->GetPrimitiveArrayCritical(env, array, &isCopy);
+	if(NULL == elems1 || isCopy == JNI_TRUE) {
+		return JNI_FALSE;
+	}
+
+	/* partial collections copy-forward the eden regions, global ones mark and compact the whole heap */
+	(*env)->CallStaticVoidMethod(env, clazz, collectMID, global);
+
+	elems2 = (*env)->GetPrimitiveArrayCritical(env, array, &isCopy);
+	if(NULL == elems2 || isCopy == JNI_TRUE) {
+		(*env)->ReleasePrimitiveArrayCritical(env, array, elems1, 0);
+		return JNI_FALSE;
+	}
+
+	if(elems1 == elems2) {
+		result = JNI_TRUE;
+	}
+
+	addressesElems = (jlong*)(*env)->GetPrimitiveArrayCritical(env, addresses, &isCopy);
+	if(NULL != addressesElems) {
+		addressesElems[0] = (jlong)(UDATA)elems1;
+		addressesElems[1] = (jlong)(UDATA)elems2;
+		(*env)->ReleasePrimitiveArrayCritical(env, addresses, (void*)addressesElems, 0);
+	}
+
+	(*env)->ReleasePrimitiveArrayCritical(env, array, elems2, 0);
+	(*env)->ReleasePrimitiveArrayCritical(env, array, elems1, 0);
+	return result;
+}
@@ -224,6 +224,7 @@ omr_add_exports(j9ben
 	Java_j9vm_test_jni_CriticalRegionTest_acquireAndSleep
 	Java_j9vm_test_jni_CriticalRegionTest_acquireAndCallIn
 	Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC
+	Java_j9vm_test_jni_CriticalRegionPinningTest_acquireAndCollect
 	Java_j9vm_test_jni_Utf8Test_testAttachCurrentThreadAsDaemon
 	Java_j9vm_test_memory_MemoryAllocator_allocateMemory
 	Java_j9vm_test_memory_MemoryAllocator_allocateMemory32
@@ -2145,6 +2145,9 @@ Java_j9vm_test_jni_CriticalRegionTest_acquireAndCallIn(JNIEnv * env, jclass claz
 jboolean JNICALL
 Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC(JNIEnv * env, jclass clazz, jbyteArray array, jlongArray addresses);
 
+jboolean JNICALL
+Java_j9vm_test_jni_CriticalRegionPinningTest_acquireAndCollect(JNIEnv * env, jclass clazz, jbyteArray array, jlongArray addresses, jboolean global);
+
 
 #ifdef __cplusplus
 }
@@ -47,6 +47,7 @@ static jvmtiTest jvmtiTestList[] =
 	{ "fer003", fer003, "com.ibm.jvmti.tests.forceEarlyReturn.fer003", "ForceEarlyReturn - check return values" },
 	{ "ioioc001", ioioc001, "com.ibm.jvmti.tests.iterateOverInstancesOfClass.ioioc001", "IterateOverInstancesOfClass " },
 	{ "ith001", ith001, "com.ibm.jvmti.tests.iterateThroughHeap.ith001", "IterateThroughHeap" },
+	{ "ith002", ith002, "com.ibm.jvmti.tests.iterateThroughHeap.ith002", "IterateThroughHeap - concurrent callbacks" },
 	{ "ioh001", ioh001, "com.ibm.jvmti.tests.iterateOverHeap.ioh001", "IterateOverHeap" },
 	{ "re001", re001, "com.ibm.jvmti.tests.resourceExhausted.re001", "ResourceExhausted OutOfMemory" },
 	{ "re002", re002, "com.ibm.jvmti.tests.resourceExhausted.re002", "ResourceExhausted Thread" },
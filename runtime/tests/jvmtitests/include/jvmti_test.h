@@ -160,6 +160,7 @@ jint JNICALL fer002(agentEnv *env, char *args);
 jint JNICALL fer003(agentEnv *env, char *args);
 jint JNICALL ioioc001(agentEnv * env, char * args);
 jint JNICALL ith001(agentEnv * env, char * args);
+jint JNICALL ith002(agentEnv * env, char * args);
 jint JNICALL ioh001(agentEnv * env, char * args);
 jint JNICALL ta001(agentEnv * env, char * args);
 jint JNICALL rc001(agentEnv * env, char * args);
@@ -0,0 +1,224 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#include <string.h>
+
+#include "ibmjvmti.h"
+#include "jvmti_test.h"
+
+#define ITH002_CLASS_TAG ((jlong) 0xc0de0200)
+#define ITH002_FIRST_OBJECT_TAG ((jlong) 0x10000)
+
+static agentEnv * env;
+static jrawMonitorID dataLock;
+
+typedef struct testConcurrentHeapData {
+	jint          visited;
+	jint          badClassTags;
+	jlong         nextTag;
+	jint          count;
+	unsigned char * seen;
+	jint          badTags;
+} testConcurrentHeapData;
+
+jint JNICALL
+ith002(agentEnv * agent_env, char * args)
+{
+	jvmtiError err;
+	jvmtiCapabilities capabilities;
+	JVMTI_ACCESS_FROM_AGENT(agent_env);
+
+	if (!ensureVersion(agent_env, JVMTI_VERSION_1_1)) {
+		return JNI_ERR;
+	}
+
+	env = agent_env;
+
+	memset(&capabilities, 0, sizeof(jvmtiCapabilities));
+	capabilities.can_tag_objects = 1;
+	err = (*jvmti_env)->AddCapabilities(jvmti_env, &capabilities);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to AddCapabilities");
+		return JNI_ERR;
+	}
+
+	err = (*jvmti_env)->CreateRawMonitor(jvmti_env, "ith002 data lock", &dataLock);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to CreateRawMonitor");
+		return JNI_ERR;
+	}
+
+	return JNI_OK;
+}
+
+/**
+ * Called concurrently from the GC threads. Counts the object under the raw monitor,
+ * then tags it outside of it, so that several threads update the tag table at once.
+ */
+static jint JNICALL
+testConcurrentIteration_tagCallback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data)
+{
+	testConcurrentHeapData *userData = (testConcurrentHeapData *) user_data;
+	jlong tag;
+	JVMTI_ACCESS_FROM_AGENT(env);
+
+	(*jvmti_env)->RawMonitorEnter(jvmti_env, dataLock);
+	if (class_tag != ITH002_CLASS_TAG) {
+		userData->badClassTags++;
+	}
+	userData->visited++;
+	tag = userData->nextTag++;
+	(*jvmti_env)->RawMonitorExit(jvmti_env, dataLock);
+
+	*tag_ptr = tag;
+
+	return JVMTI_VISIT_OBJECTS;
+}
+
+/**
+ * Called serially. Checks that every object was tagged exactly once by the concurrent walk.
+ */
+static jint JNICALL
+testConcurrentIteration_checkCallback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data)
+{
+	testConcurrentHeapData *userData = (testConcurrentHeapData *) user_data;
+	jlong index = *tag_ptr - ITH002_FIRST_OBJECT_TAG;
+
+	if ((index < 0) || (index >= userData->count) || (0 != userData->seen[index])) {
+		userData->badTags++;
+	} else {
+		userData->seen[index] = 1;
+	}
+
+	return JVMTI_VISIT_OBJECTS;
+}
+
+static jint JNICALL
+testConcurrentIteration_abortCallback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data)
+{
+	testConcurrentHeapData *userData = (testConcurrentHeapData *) user_data;
+	JVMTI_ACCESS_FROM_AGENT(env);
+
+	(*jvmti_env)->RawMonitorEnter(jvmti_env, dataLock);
+	userData->visited++;
+	(*jvmti_env)->RawMonitorExit(jvmti_env, dataLock);
+
+	return JVMTI_VISIT_ABORT;
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_iterateThroughHeap_ith002_iterateConcurrently(JNIEnv * jni_env, jclass clazz, jclass klass, jint count)
+{
+	jvmtiError err;
+	jvmtiHeapCallbacks callbacks;
+	testConcurrentHeapData userData;
+	jboolean result = JNI_TRUE;
+	jint i;
+	JVMTI_ACCESS_FROM_AGENT(env);
+
+	memset(&userData, 0x00, sizeof(testConcurrentHeapData));
+	userData.nextTag = ITH002_FIRST_OBJECT_TAG;
+	userData.count = count;
+
+	err = (*jvmti_env)->SetTag(jvmti_env, klass, ITH002_CLASS_TAG);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to SetTag");
+		return JNI_FALSE;
+	}
+
+	/* Tag every instance from the concurrent callbacks */
+	memset(&callbacks, 0x00, sizeof(jvmtiHeapCallbacks));
+	callbacks.heap_iteration_callback = testConcurrentIteration_tagCallback;
+	err = (*jvmti_env)->IterateThroughHeap(jvmti_env, JVMTI_HEAP_FILTER_TAGGED | COM_IBM_HEAP_FILTER_CONCURRENT_CALLBACKS, klass, &callbacks, &userData);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to IterateThroughHeap with concurrent callbacks");
+		return JNI_FALSE;
+	}
+	if (userData.visited != count) {
+		error(env, JVMTI_ERROR_INTERNAL, "Concurrent IterateThroughHeap reported %d instances, expected %d", userData.visited, count);
+		result = JNI_FALSE;
+	}
+	if (0 != userData.badClassTags) {
+		error(env, JVMTI_ERROR_INTERNAL, "Concurrent IterateThroughHeap reported %d incorrect class tags", userData.badClassTags);
+		result = JNI_FALSE;
+	}
+
+	/* Every tag set concurrently must have been stored in the tag table */
+	err = (*jvmti_env)->Allocate(jvmti_env, count, &userData.seen);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to Allocate");
+		return JNI_FALSE;
+	}
+	memset(userData.seen, 0, count);
+	callbacks.heap_iteration_callback = testConcurrentIteration_checkCallback;
+	err = (*jvmti_env)->IterateThroughHeap(jvmti_env, JVMTI_HEAP_FILTER_UNTAGGED, klass, &callbacks, &userData);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to IterateThroughHeap");
+		result = JNI_FALSE;
+	} else {
+		if (0 != userData.badTags) {
+			error(env, JVMTI_ERROR_INTERNAL, "%d instances have a tag which was not set exactly once", userData.badTags);
+			result = JNI_FALSE;
+		}
+		for (i = 0; i < count; i++) {
+			if (0 == userData.seen[i]) {
+				error(env, JVMTI_ERROR_INTERNAL, "Tag 0x%llx set by a concurrent callback was lost", ITH002_FIRST_OBJECT_TAG + i);
+				result = JNI_FALSE;
+				break;
+			}
+		}
+	}
+	(*jvmti_env)->Deallocate(jvmti_env, userData.seen);
+
+	return result;
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_iterateThroughHeap_ith002_iterateConcurrentlyAndAbort(JNIEnv * jni_env, jclass clazz, jclass klass, jint count)
+{
+	jvmtiError err;
+	jvmtiHeapCallbacks callbacks;
+	testConcurrentHeapData userData;
+	JVMTI_ACCESS_FROM_AGENT(env);
+
+	memset(&userData, 0x00, sizeof(testConcurrentHeapData));
+
+	err = (*jvmti_env)->SetTag(jvmti_env, klass, ITH002_CLASS_TAG);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to SetTag");
+		return JNI_FALSE;
+	}
+
+	/* Each thread stops at the first instance it reports, and the others claim no further units */
+	memset(&callbacks, 0x00, sizeof(jvmtiHeapCallbacks));
+	callbacks.heap_iteration_callback = testConcurrentIteration_abortCallback;
+	err = (*jvmti_env)->IterateThroughHeap(jvmti_env, COM_IBM_HEAP_FILTER_CONCURRENT_CALLBACKS, klass, &callbacks, &userData);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to IterateThroughHeap with concurrent callbacks");
+		return JNI_FALSE;
+	}
+	if ((0 == userData.visited) || (userData.visited >= count)) {
+		error(env, JVMTI_ERROR_INTERNAL, "Aborted concurrent IterateThroughHeap reported %d of %d instances", userData.visited, count);
+		return JNI_FALSE;
+	}
+
+	return JNI_TRUE;
+}
@@ -226,11 +226,11 @@ test2(J9JavaVM* vm)
 		goto done;
 	}
 
-	/* Currently all the read write bytes are used for string intern table.
-	 * Unless string table bytes set externally with -Xitsn option, read/write are bytes and string table bytes must be same.
+	/* The read write bytes are used for string intern table, followed by the startup page map and the class index.
+	 * Unless string table bytes set externally with -Xitsn option, the string table gets all the rest of the read/write area.
 	 *
 	 */
-	if (testCC->getStringTableBytes() != testCC->getReadWriteBytes()){
+	if ((testCC->getStringTableBytes() + testCC->getCacheHeaderAddress()->startupPageMapBytes + testCC->getCacheHeaderAddress()->classIndexBytes) != testCC->getReadWriteBytes()){
 		ERRPRINTF(("Read/write area size and string table bytes are not same.\n"));
 		retval = TEST_ERROR;
 		goto done;
@@ -291,9 +291,10 @@ test3(J9JavaVM* vm)
 		goto done;
 	}
 
-	if (testCC->getReadWriteBytes() != maxSharedStringTableSize){
+	/* The startup page map and the class index follow the string table, at a double word boundary */
+	if (testCC->getStringTableBytes() != SHC_PAD(maxSharedStringTableSize, SHC_DOUBLEALIGN)){
 		ERRPRINTF(("Read/write area size incorrect.\n"));
-		j9tty_printf(PORTLIB, "testCC->getReadWriteBytes()=%u", testCC->getReadWriteBytes());
+		j9tty_printf(PORTLIB, "testCC->getStringTableBytes()=%u", testCC->getStringTableBytes());
 		j9tty_printf(PORTLIB, "maxSharedStringTableSize=%u", maxSharedStringTableSize);
 		retval = TEST_ERROR;
 		goto done;
@@ -48,10 +48,15 @@ class CompositeCacheTest {
 		static IDATA writeHashTest(J9JavaVM* vm, IDATA testCacheSize, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
 		static IDATA crashCntrTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
 		static IDATA corruptTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
+		static IDATA classIndexTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
+		static IDATA writeMutexStatsTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a);
 	private:
 		static IDATA localTestStats(J9JavaVM* vm, IDATA testCacheSize, UDATA metaBytes, UDATA allocBytes, UDATA AOTBytes, UDATA JITBytes, UDATA updateCntr, SH_CompositeCacheImpl* cc, char* cacheBase);
 		static IDATA checkUpdateResults(J9JavaVM* vm, SH_CompositeCacheImpl* cc, UDATA expectedCheckUpdates, bool tryNextEntry, char* expectedNextEntry, 
 				bool useStaleItems, UDATA expectedStale, bool expectSegment, char* segment);
+		static U_32 classIndexItemHashFn(const ShcItem* item, void* userData);
+		static UDATA classIndexHashFn(void* key, void* userData);
+		static UDATA classIndexHashEqualFn(void* existingEntry, void* key, void* userData);
 };
 
 IDATA
@@ -175,6 +180,7 @@ IDATA
 CompositeCacheTest::localTestStats(J9JavaVM* vm, IDATA testCacheSize, UDATA metaBytes, UDATA allocBytes, UDATA AOTBytes,  UDATA JITBytes, UDATA updateCntr, SH_CompositeCacheImpl* cc, char* cacheBase)
 {
 	void* baseAddress = cc->getBaseAddress();
+	UDATA readWriteBytes = cc->getReadWriteBytes();
 	void* endAddress = cc->getCacheEndAddress();
 	void* segmentAllocPtr = cc->getSegmentAllocPtr();
 	UDATA aotResult = cc->getAOTBytes();
@@ -190,7 +196,8 @@ CompositeCacheTest::localTestStats(J9JavaVM* vm, IDATA testCacheSize, UDATA meta
 
 	j9tty_printf(PORTLIB, "Testing stats for cache of size %d, with allocBytes=%d and metaBytes=%d\n", testCacheSize, allocBytes, metaBytes);
 
-	vResult = (cacheBase + sizeof(struct J9SharedCacheHeader));
+	/* The read/write area always holds the startup page map and the class index */
+	vResult = (cacheBase + sizeof(struct J9SharedCacheHeader) + readWriteBytes);
 	if (baseAddress != vResult) {
 		j9tty_printf(PORTLIB, "1.) Got %p expected %p\n", baseAddress, vResult);
 		return 1;
@@ -222,7 +229,7 @@ CompositeCacheTest::localTestStats(J9JavaVM* vm, IDATA testCacheSize, UDATA meta
 			return 6;
 		}
 
-	uResult = (expectedTotalCacheSize - allocBytes - (debugBytes + metaBytes + AOTBytes + JITBytes + (updateCntr * sizeof(ShcItemHdr))));
+	uResult = (expectedTotalCacheSize - readWriteBytes - allocBytes - (debugBytes + metaBytes + AOTBytes + JITBytes + (updateCntr * sizeof(ShcItemHdr))));
 	if (freeBytes != uResult) {
 		j9tty_printf(PORTLIB, "7.) Got %d expected %d\n", freeBytes, uResult);
 		return 7;
@@ -1012,6 +1019,209 @@ CompositeCacheTest::crashCntrTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_C
 	return PASS;
 }
 
+U_32
+CompositeCacheTest::classIndexItemHashFn(const ShcItem* item, void* userData)
+{
+	/* Index ROMClass items under their length, so the test can look them up without a name */
+	if (TYPE_ROMCLASS == item->dataType) {
+		return item->dataLen;
+	}
+	return 0;
+}
+
+UDATA
+CompositeCacheTest::classIndexHashFn(void* key, void* userData)
+{
+	return ((J9SharedClassIndexEntry*)key)->nameHash;
+}
+
+UDATA
+CompositeCacheTest::classIndexHashEqualFn(void* existingEntry, void* key, void* userData)
+{
+	J9SharedClassIndexEntry* entry = (J9SharedClassIndexEntry*)existingEntry;
+	J9SharedClassIndexEntry* query = (J9SharedClassIndexEntry*)key;
+
+	return (entry->nameHash == query->nameHash) && (entry->itemOffset == query->itemOffset);
+}
+
+IDATA
+CompositeCacheTest::classIndexTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a)
+{
+	J9SharedClassIndexHeader* indexHeader = cc1->getClassIndexHeader();
+	J9SharedCacheHeader* ca = cc1->getCacheHeaderAddress();
+	J9SRPHashTable* classIndex = NULL;
+	ShcItem* items[3];
+	ShcItem item;
+	ShcItem* itemPtr = &item;
+	IDATA result = PASS;
+	UDATA i = 0;
+
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	/* IMPORTANT: cc1 and cc1a are two views on the same cache */
+
+	if ((NULL == indexHeader) || (indexHeader != cc1a->getClassIndexHeader())) {
+		j9tty_printf(PORTLIB, "Class index header %p does not match %p\n", indexHeader, cc1a->getClassIndexHeader());
+		return 1;
+	}
+	if (J9_ARE_NO_BITS_SET(ca->extraFlags, J9SHR_EXTRA_FLAGS_CLASS_INDEX)) {
+		j9tty_printf(PORTLIB, "Cache with a class index should have J9SHR_EXTRA_FLAGS_CLASS_INDEX set\n");
+		return 2;
+	}
+
+	/* A cache created before the class index has no flag, and its class index header words may hold anything */
+	ca->extraFlags &= ~J9SHR_EXTRA_FLAGS_CLASS_INDEX;
+	if (NULL != cc1a->getClassIndexHeader()) {
+		result = 3;
+	}
+	ca->extraFlags |= J9SHR_EXTRA_FLAGS_CLASS_INDEX;
+	if (PASS != result) {
+		j9tty_printf(PORTLIB, "Class index header should not be used without J9SHR_EXTRA_FLAGS_CLASS_INDEX\n");
+		return result;
+	}
+
+	classIndex = srpHashTableRecreate(PORTLIB, J9_GET_CALLSITE(), CLASSINDEXTABLE(indexHeader),
+			classIndexHashFn, classIndexHashEqualFn, NULL, NULL);
+	if (NULL == classIndex) {
+		return 4;
+	}
+
+	memset(itemPtr, 0, sizeof(ShcItem));
+
+	cc1->enterWriteMutex(vm->mainThread, false, "classIndexTest");
+
+	/* Index whatever earlier tests left in the cache, none of which are ROMClasses */
+	if (0 != cc1->updateClassIndex(vm->mainThread, classIndex, classIndexItemHashFn, NULL)) {
+		result = 5;
+		goto _done;
+	}
+
+	itemPtr->dataType = TYPE_ROMCLASS;
+	for (i = 0; i < 3; i++) {
+		itemPtr->dataLen = (U_32)(24 + (i * 8));
+		items[i] = (ShcItem*)cc1->allocateBlock(vm->mainThread, itemPtr, SHC_WORDALIGN, 0);
+		if (NULL == items[i]) {
+			result = 6;
+			goto _done;
+		}
+		cc1->commitUpdate(vm->mainThread, false);
+	}
+
+	if (3 != cc1->updateClassIndex(vm->mainThread, classIndex, classIndexItemHashFn, NULL)) {
+		result = 7;
+		goto _done;
+	}
+	/* Items are only indexed once */
+	if (0 != cc1->updateClassIndex(vm->mainThread, classIndex, classIndexItemHashFn, NULL)) {
+		result = 8;
+		goto _done;
+	}
+	if (3 != srpHashTableGetCount(classIndex)) {
+		result = 9;
+		goto _done;
+	}
+
+	for (i = 0; i < 3; i++) {
+		J9SharedClassIndexEntry key;
+
+		key.nameHash = items[i]->dataLen;
+		key.itemOffset = (U_32)((U_8*)items[i] - (U_8*)ca);
+		if (NULL == srpHashTableFind(classIndex, &key)) {
+			j9tty_printf(PORTLIB, "Item %p with dataLen %d is not in the class index\n", items[i], items[i]->dataLen);
+			result = 10;
+			goto _done;
+		}
+	}
+
+	if (cc1->getClassIndexBoundary() != cc1a->getClassIndexBoundary()) {
+		j9tty_printf(PORTLIB, "Class index boundary %p does not match %p\n", cc1->getClassIndexBoundary(), cc1a->getClassIndexBoundary());
+		result = 11;
+		goto _done;
+	}
+
+_done:
+	cc1->exitWriteMutex(vm->mainThread, "classIndexTest");
+	srpHashTableFree(classIndex);
+	return result;
+}
+
+IDATA
+CompositeCacheTest::writeMutexStatsTest(J9JavaVM* vm, SH_CompositeCacheImpl* cc1, SH_CompositeCacheImpl* cc1a)
+{
+	J9SharedCacheHeader* ca = cc1->getCacheHeaderAddress();
+	UDATA acquireCount = ca->writeMutexAcquireCount;
+	UDATA contendedCount = ca->writeMutexContendedCount;
+	UDATA waitMicros = ca->writeMutexWaitMicros;
+	UDATA contendedWaitMicros = ca->writeMutexContendedWaitMicros;
+	UDATA i = 0;
+
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	/* IMPORTANT: cc1 and cc1a are two views on the same cache */
+
+	if (ca != cc1a->getCacheHeaderAddress()) {
+		j9tty_printf(PORTLIB, "Cache header %p does not match %p\n", ca, cc1a->getCacheHeaderAddress());
+		return 1;
+	}
+	if (0 == acquireCount) {
+		j9tty_printf(PORTLIB, "The earlier tests entered the write mutex, but no acquisitions were counted\n");
+		return 2;
+	}
+
+	/* Each acquisition through either view is counted. An uncontended acquisition may still be slow enough to count as contended. */
+	for (i = 0; i < 2; i++) {
+		SH_CompositeCacheImpl* cc = (0 == i) ? cc1 : cc1a;
+
+		if (0 != cc->enterWriteMutex(vm->mainThread, false, "writeMutexStatsTest")) {
+			return 3;
+		}
+		cc->exitWriteMutex(vm->mainThread, "writeMutexStatsTest");
+	}
+	if ((acquireCount + 2) != ca->writeMutexAcquireCount) {
+		j9tty_printf(PORTLIB, "Write mutex acquisitions %zu, expected %zu\n", ca->writeMutexAcquireCount, acquireCount + 2);
+		return 4;
+	}
+	if ((ca->writeMutexContendedCount - contendedCount) > 2) {
+		j9tty_printf(PORTLIB, "Write mutex contended acquisitions grew from %zu to %zu\n", contendedCount, ca->writeMutexContendedCount);
+		return 5;
+	}
+	contendedCount = ca->writeMutexContendedCount;
+
+	/* Another thread of this JVM queued on the write mutex makes the acquisition contended, however quick it is */
+	cc1->_commonCCInfo->writeMutexWaiters += 1;
+	if (0 != cc1->enterWriteMutex(vm->mainThread, false, "writeMutexStatsTest")) {
+		cc1->_commonCCInfo->writeMutexWaiters -= 1;
+		return 6;
+	}
+	cc1->exitWriteMutex(vm->mainThread, "writeMutexStatsTest");
+	cc1->_commonCCInfo->writeMutexWaiters -= 1;
+
+	if ((acquireCount + 3) != ca->writeMutexAcquireCount) {
+		j9tty_printf(PORTLIB, "Write mutex acquisitions %zu, expected %zu\n", ca->writeMutexAcquireCount, acquireCount + 3);
+		return 7;
+	}
+	if ((contendedCount + 1) != ca->writeMutexContendedCount) {
+		j9tty_printf(PORTLIB, "Write mutex contended acquisitions %zu, expected %zu\n", ca->writeMutexContendedCount, contendedCount + 1);
+		return 8;
+	}
+	if (0 != cc1->_commonCCInfo->writeMutexWaiters) {
+		j9tty_printf(PORTLIB, "%zu threads are still counted as holding or waiting for the write mutex\n", cc1->_commonCCInfo->writeMutexWaiters);
+		return 9;
+	}
+
+	/* The wait times only grow, and the contended waits are part of the total */
+	if ((ca->writeMutexWaitMicros < waitMicros) || (ca->writeMutexContendedWaitMicros < contendedWaitMicros)) {
+		j9tty_printf(PORTLIB, "Write mutex wait times went back from %zu/%zu to %zu/%zu\n",
+				waitMicros, contendedWaitMicros, ca->writeMutexWaitMicros, ca->writeMutexContendedWaitMicros);
+		return 10;
+	}
+	if (ca->writeMutexContendedWaitMicros > ca->writeMutexWaitMicros) {
+		j9tty_printf(PORTLIB, "Write mutex contended wait %zu is more than the total wait %zu\n", ca->writeMutexContendedWaitMicros, ca->writeMutexWaitMicros);
+		return 11;
+	}
+	return PASS;
+}
+
 IDATA 
 testCompositeCache(J9JavaVM* vm)
 {
@@ -1034,6 +1244,8 @@ testCompositeCache(J9JavaVM* vm)
 	SHC_TEST_ASSERT("basicMutexTest", CompositeCacheTest::basicMutexTest(vm, testCache1, testCache1a), success, rc);
 	/* use testCache2 and testCache2a because 1 and 1a have now got stuff in */
 	SHC_TEST_ASSERT("updateTest", CompositeCacheTest::updateTest(vm, testCacheSize, testCache2, testCache2a), success, rc);
+	SHC_TEST_ASSERT("classIndexTest", CompositeCacheTest::classIndexTest(vm, testCache2, testCache2a), success, rc);
+	SHC_TEST_ASSERT("writeMutexStatsTest", CompositeCacheTest::writeMutexStatsTest(vm, testCache2, testCache2a), success, rc);
 	/* TODO: Test made temporarily invalid by static _vmID
 	SHC_TEST_ASSERT("writeHashTest", CompositeCacheTest::writeHashTest(vm, testCacheSize, testCache2, testCache2a), success, rc); */
 	SHC_TEST_ASSERT("crashCntrTest", CompositeCacheTest::crashCntrTest(vm, testCache1, testCache1a), success, rc);
@@ -60,6 +60,7 @@ import javax.management.ReflectionException;
 import javax.management.openmbean.CompositeData;
 
 import com.ibm.lang.management.MemoryMXBean;
+import com.ibm.oti.shared.SharedClassStatistics;
 
 import org.openj9.test.util.process.Task;
 
@@ -512,6 +513,23 @@ public class TestMemoryMXBean {
 			Assert.fail("Unexpected InstanceNotFoundException occurred (setSharedClassCacheMaxJitDataBytes): "
 					+ e.getCause().getMessage());
 		}
+
+		try {
+			// Test the operation getSharedClassCacheLookupCount
+			retVal = mbs.invoke(objName, "getSharedClassCacheLookupCount",
+					new Object[] { SharedClassStatistics.LOOKUP_FIND_ROMCLASS, SharedClassStatistics.RESULT_HIT },
+					new String[] { int.class.getName(), int.class.getName() });
+			AssertJUnit.assertTrue(((Long)(retVal)).longValue() > -1);
+		} catch (MBeanException e) {
+			Assert.fail("Unexpected MBeanException occurred (getSharedClassCacheLookupCount): "
+					+ e.getCause().getMessage());
+		} catch (ReflectionException e) {
+			Assert.fail("Unexpected ReflectionException occurred (getSharedClassCacheLookupCount): "
+					+ e.getCause().getMessage());
+		} catch (InstanceNotFoundException e) {
+			Assert.fail("Unexpected InstanceNotFoundException occurred (getSharedClassCacheLookupCount): "
+					+ e.getCause().getMessage());
+		}
 	}
 
 	@Test
@@ -723,10 +741,10 @@ public class TestMemoryMXBean {
 		AssertJUnit.assertNotNull(constructors);
 		AssertJUnit.assertTrue(constructors.length == 0);
 
-		// One public operation (JLM) + five from CILM.
+		// One public operation (JLM) + eight from CILM.
 		MBeanOperationInfo[] operations = mbi.getOperations();
 		AssertJUnit.assertNotNull(operations);
-		AssertJUnit.assertTrue(operations.length == 6);
+		AssertJUnit.assertTrue(operations.length == 9);
 
 		// One notification
 		MBeanNotificationInfo[] notifications = mbi.getNotifications();
@@ -1000,6 +1018,154 @@ public class TestMemoryMXBean {
 		AssertJUnit.assertTrue(((Long)cd.get("count")) > 0);
 	}
 
+	/* Only loaded by testSharedClassCacheLookupCounters(), so that its lookup is counted there */
+	static class ClassForTestSharedClassCacheLookup {
+	}
+
+	private static long sumLookupCounts(ExtendedMemoryMXBeanImpl bean, int operation) {
+		long count = 0;
+		for (int result = SharedClassStatistics.RESULT_HIT; result <= SharedClassStatistics.RESULT_ERROR; result++) {
+			count += bean.getSharedClassCacheLookupCount(operation, result);
+		}
+		return count;
+	}
+
+	private static long sumStatisticsLookupCounts(int operation) {
+		long count = 0;
+		for (int result = SharedClassStatistics.RESULT_HIT; result <= SharedClassStatistics.RESULT_ERROR; result++) {
+			count += SharedClassStatistics.lookupCount(operation, result);
+		}
+		return count;
+	}
+
+	private static long sumRomClassLookupCounts() {
+		long count = 0;
+		for (int loader = SharedClassStatistics.LOADER_BOOTSTRAP; loader <= SharedClassStatistics.LOADER_TOKEN; loader++) {
+			for (int result = SharedClassStatistics.RESULT_HIT; result <= SharedClassStatistics.RESULT_ERROR; result++) {
+				count += SharedClassStatistics.romClassLookupCount(loader, result);
+			}
+		}
+		return count;
+	}
+
+	private static long sum(long[] values) {
+		long total = 0;
+		for (int i = 0; i < values.length; i++) {
+			total += values[i];
+		}
+		return total;
+	}
+
+	@Test
+	public final void testSharedClassCacheLookupCounters() throws Exception {
+		final int operation = SharedClassStatistics.LOOKUP_FIND_ROMCLASS;
+		long count = sumLookupCounts(mb, operation);
+		long statisticsCount = sumStatisticsLookupCounts(operation);
+		long loaderCount = sumRomClassLookupCounts();
+		long micros = mb.getSharedClassCacheLookupMicros(operation);
+		long histogramCount = sum(mb.getSharedClassCacheLookupLatencyHistogram(operation));
+
+		// The class is named as a string so that it is first loaded here.
+		Class.forName(TestMemoryMXBean.class.getName() + "$ClassForTestSharedClassCacheLookup");
+
+		long newCount = sumLookupCounts(mb, operation);
+		long newStatisticsCount = sumStatisticsLookupCounts(operation);
+		long newLoaderCount = sumRomClassLookupCounts();
+		long newMicros = mb.getSharedClassCacheLookupMicros(operation);
+		long newHistogramCount = sum(mb.getSharedClassCacheLookupLatencyHistogram(operation));
+		logger.debug("Shared class cache ROMClass lookups : " + count + " -> " + newCount + ", "
+				+ micros + " -> " + newMicros + " usec");
+
+		if (mb.getSharedClassCacheSize() > 0) {
+			// Other threads may load classes too, so the counters only have to grow.
+			AssertJUnit.assertTrue(newCount > count);
+			AssertJUnit.assertTrue(newStatisticsCount > statisticsCount);
+			AssertJUnit.assertTrue(newLoaderCount > loaderCount);
+			AssertJUnit.assertTrue(newHistogramCount > histogramCount);
+			AssertJUnit.assertTrue(newMicros >= micros);
+		} else {
+			AssertJUnit.assertEquals(0, newCount);
+			AssertJUnit.assertEquals(0, newMicros);
+			AssertJUnit.assertEquals(0, newHistogramCount);
+		}
+	}
+
+	@Test
+	public final void testSharedClassCacheLookupArguments() {
+		final int[] badOperations = { -1, SharedClassStatistics.LOOKUP_FIND_ATTACHED_DATA + 1 };
+		final int[] badResults = { -1, SharedClassStatistics.RESULT_ERROR + 1 };
+		final int[] badLoaders = { -1, SharedClassStatistics.LOADER_TOKEN + 1 };
+
+		for (int operation : badOperations) {
+			try {
+				mb.getSharedClassCacheLookupCount(operation, SharedClassStatistics.RESULT_HIT);
+				Assert.fail("getSharedClassCacheLookupCount(" + operation + ", 0): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+			try {
+				mb.getSharedClassCacheLookupMicros(operation);
+				Assert.fail("getSharedClassCacheLookupMicros(" + operation + "): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+			try {
+				mb.getSharedClassCacheLookupLatencyHistogram(operation);
+				Assert.fail("getSharedClassCacheLookupLatencyHistogram(" + operation + "): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+			try {
+				SharedClassStatistics.lookupCount(operation, SharedClassStatistics.RESULT_HIT);
+				Assert.fail("SharedClassStatistics.lookupCount(" + operation + ", 0): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+			try {
+				SharedClassStatistics.lookupMicros(operation);
+				Assert.fail("SharedClassStatistics.lookupMicros(" + operation + "): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+			try {
+				SharedClassStatistics.lookupLatencyHistogram(operation);
+				Assert.fail("SharedClassStatistics.lookupLatencyHistogram(" + operation + "): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+		}
+
+		for (int result : badResults) {
+			try {
+				mb.getSharedClassCacheLookupCount(SharedClassStatistics.LOOKUP_FIND_ROMCLASS, result);
+				Assert.fail("getSharedClassCacheLookupCount(0, " + result + "): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+			try {
+				SharedClassStatistics.lookupCount(SharedClassStatistics.LOOKUP_FIND_ROMCLASS, result);
+				Assert.fail("SharedClassStatistics.lookupCount(0, " + result + "): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+			try {
+				SharedClassStatistics.romClassLookupCount(SharedClassStatistics.LOADER_BOOTSTRAP, result);
+				Assert.fail("SharedClassStatistics.romClassLookupCount(0, " + result + "): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+		}
+
+		for (int loader : badLoaders) {
+			try {
+				SharedClassStatistics.romClassLookupCount(loader, SharedClassStatistics.RESULT_HIT);
+				Assert.fail("SharedClassStatistics.romClassLookupCount(" + loader + ", 0): should throw IllegalArgumentException");
+			} catch (IllegalArgumentException e) {
+				logger.debug("IllegalArgumentException thrown, as expected.");
+			}
+		}
+	}
+
 	@Test
 	public final void testGetNotificationInfo() {
 		AssertJUnit.assertTrue(mb instanceof NotificationEmitter);
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package j9vm.test.jni;
+
+/**
+ * Runs CriticalRegionTest with Balanced pinning the regions of JNI critical arrays
+ * (see CriticalRegionPinningTestRunner), then checks that an array held in a critical
+ * section stays in place across copy-forward partial collections and global collections
+ * run while it is held.
+ */
+public class CriticalRegionPinningTest {
+	private static final int ALLOCATION_SIZE = 64 * 1024;
+	private static final int ALLOCATION_TOTAL = 256 * 1024 * 1024;
+
+	private static byte[][] garbage;
+	private static Object sink;
+
+	private static native boolean acquireAndCollect(byte[] array, long[] addresses, boolean global);
+
+	/* called back by acquireAndCollect while the array is held */
+	private static void collect(boolean global)
+	{
+		garbage = null;
+		if (global) {
+			System.gc();
+			System.gc();
+		} else {
+			/* allocate several edens worth, so that partial collections run */
+			for (int allocated = 0; allocated < ALLOCATION_TOTAL; allocated += ALLOCATION_SIZE) {
+				sink = new byte[ALLOCATION_SIZE];
+			}
+		}
+	}
+
+	private static void testObjectMovement(boolean global)
+	{
+		String testName = global ? "testObjectMovementGlobal" : "testObjectMovementPartial";
+
+		garbage = new byte[128][1024];
+		byte[] keeper = garbage[garbage.length / 2];
+		long[] addresses = { 0, 0 };
+
+		if (!acquireAndCollect(keeper, addresses, global)) {
+			throw new RuntimeException(testName + ": object moved during critical region from " + Long.toHexString(addresses[0]) + " to " + Long.toHexString(addresses[1]));
+		}
+		System.out.println(testName + ": passed");
+	}
+
+	public static void main(String[] args)
+	{
+		CriticalRegionTest.main(args);
+
+		testObjectMovement(false);
+		testObjectMovement(true);
+	}
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.lang.management.ManagementFactory;
+
+import com.ibm.lang.management.MemoryMXBean;
+
+/**
+ * This test expands the heap, drops the objects and then watches the soft maximum heap size, which the memory pressure monitor
+ * (-Xgc:memoryPressureMonitor) lowers while the process is under memory pressure and restores once the pressure is gone.
+ * Run with -Xgc:fvtest=forceMemoryPressure=<samples> so that the pressure comes and goes whatever the memory of the machine.
+ * Takes one argument: the number of seconds to wait for the soft maximum heap size to be lowered and restored.
+ */
+public class MemoryPressureRelief
+{
+	public static Object[] _objectHolder;
+
+	public static void main(String[] args) throws InterruptedException
+	{
+		if (1 != args.length)
+		{
+			System.err.println("Missing argument for the number of seconds to wait for the soft maximum heap size to be lowered and restored.");
+			System.exit(1);
+		}
+		MemoryMXBean bean = (MemoryMXBean)ManagementFactory.getMemoryMXBean();
+		/* -Xmx, since no soft maximum heap size has been set yet */
+		long maxHeapSize = bean.getMaxHeapSize();
+
+		/* expand the heap, then drop the objects so that the monitor has free memory to give back */
+		_objectHolder = new Object[64];
+		for (int i = 0; i < _objectHolder.length; i++)
+		{
+			_objectHolder[i] = new byte[1024 * 1024];
+		}
+		long expandedHeapSize = Runtime.getRuntime().totalMemory();
+		_objectHolder = null;
+
+		boolean lowered = false;
+		boolean restored = false;
+		long finishTime = System.currentTimeMillis() + (Integer.parseInt(args[0]) * 1000);
+		while (!restored && (System.currentTimeMillis() < finishTime))
+		{
+			long softMx = bean.getMaxHeapSize();
+			if (softMx < maxHeapSize)
+			{
+				if (!lowered)
+				{
+					System.out.println("Soft maximum heap size lowered to " + softMx);
+					lowered = true;
+				}
+			}
+			else if (lowered)
+			{
+				restored = true;
+			}
+			Thread.sleep(10);
+		}
+
+		System.out.println("Heap size " + expandedHeapSize + " before the memory pressure, " + Runtime.getRuntime().totalMemory() + " after");
+		if (!lowered)
+		{
+			System.out.println("Soft maximum heap size not lowered");
+		}
+		else if (restored)
+		{
+			System.out.println("Soft maximum heap size restored to " + maxHeapSize);
+		}
+		else
+		{
+			System.out.println("Soft maximum heap size not restored");
+		}
+	}
+}
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.io.BufferedInputStream;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+
+/**
+ * Helper for the opts=PHD+PARALLEL heap dump tests.
+ * <ul>
+ * <li><code>populate &lt;megabytes&gt;</code> keeps a graph of objects of about the given size alive and exits,
+ * so that the heap dump agents run at vmstop over a heap with regions large enough to be split.</li>
+ * <li><code>compare &lt;file1&gt; &lt;file2&gt;</code> checks that two dumps of the same heap are identical.
+ * The parallel walk appends its units in address order, so it must produce the same bytes as the serial walk.</li>
+ * </ul>
+ */
+public class ParallelHeapDump
+{
+	public static Object[] _roots;
+
+	public static void main(String[] args) throws IOException
+	{
+		if ((2 == args.length) && "populate".equals(args[0])) {
+			populate(Integer.parseInt(args[1]));
+			System.out.println("Heap populated");
+		} else if ((3 == args.length) && "compare".equals(args[0])) {
+			if (compare(args[1], args[2])) {
+				System.out.println("Heap dumps match");
+			} else {
+				System.exit(1);
+			}
+		} else {
+			System.err.println("Usage: ParallelHeapDump populate <megabytes> | compare <file1> <file2>");
+			System.exit(2);
+		}
+	}
+
+	/**
+	 * Allocate a mix of plain objects, reference arrays and primitive arrays, linked to each other,
+	 * so that the dump has records of every kind and references crossing unit boundaries.
+	 */
+	private static void populate(int megabytes)
+	{
+		long bytes = (long)megabytes * 1024 * 1024;
+		int count = (int)(bytes / 256);
+		_roots = new Object[count];
+		Object previous = null;
+		for (int i = 0; i < count; i++) {
+			switch (i % 4) {
+			case 0:
+				previous = new Object[] { previous, _roots, Integer.valueOf(i) };
+				break;
+			case 1:
+				previous = new byte[64 + (i % 512)];
+				break;
+			case 2:
+				previous = "string " + i;
+				break;
+			default:
+				previous = new Object[] { previous, _roots[i / 2] };
+				break;
+			}
+			_roots[i] = previous;
+		}
+	}
+
+	private static boolean compare(String name1, String name2) throws IOException
+	{
+		InputStream in1 = new BufferedInputStream(new FileInputStream(name1));
+		InputStream in2 = new BufferedInputStream(new FileInputStream(name2));
+		try {
+			long offset = 0;
+			for (;;) {
+				int byte1 = in1.read();
+				int byte2 = in2.read();
+				if (byte1 != byte2) {
+					System.out.println("Heap dumps differ at offset " + offset + ": " + byte1 + " != " + byte2);
+					return false;
+				}
+				if (-1 == byte1) {
+					break;
+				}
+				offset += 1;
+			}
+			if (offset < 1024) {
+				System.out.println("Heap dumps are too small (" + offset + " bytes)");
+				return false;
+			}
+			return true;
+		} finally {
+			in1.close();
+			in2.close();
+		}
+	}
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (c) 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.jvmti.tests.iterateThroughHeap;
+
+public class ith002
+{
+	static final int INSTANCE_COUNT = 20000;
+
+	static class Instance
+	{
+		int value;
+
+		Instance(int value)
+		{
+			this.value = value;
+		}
+	}
+
+	Instance instances[];
+	byte fillers[][];
+
+	public static native boolean iterateConcurrently(Class klass, int count);
+
+	public static native boolean iterateConcurrentlyAndAbort(Class klass, int count);
+
+	public boolean setup(String args)
+	{
+		instances = new Instance[INSTANCE_COUNT];
+		fillers = new byte[INSTANCE_COUNT / 10][];
+
+		/* spread the instances out, so that the walk splits them between several units */
+		for (int i = 0; i < INSTANCE_COUNT; i++) {
+			instances[i] = new Instance(i);
+			if (0 == (i % 10)) {
+				fillers[i / 10] = new byte[2048];
+			}
+		}
+
+		return true;
+	}
+
+	public boolean testConcurrentIterationAbort()
+	{
+		return iterateConcurrentlyAndAbort(Instance.class, INSTANCE_COUNT);
+	}
+
+	public String helpConcurrentIterationAbort()
+	{
+		return "Tests that aborting an IterateThroughHeap() call with concurrent callbacks stops all the walking threads";
+	}
+
+	public boolean testConcurrentIteration()
+	{
+		return iterateConcurrently(Instance.class, INSTANCE_COUNT);
+	}
+
+	public String helpConcurrentIteration()
+	{
+		return "Tests IterateThroughHeap() with COM_IBM_HEAP_FILTER_CONCURRENT_CALLBACKS, tagging each object from the concurrent callbacks";
+	}
+}